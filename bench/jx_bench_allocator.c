@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_bench_allocator.c                                            */
+/*  @brief Bump arena versus slab allocator benchmark (JsonX)             */
+/*                                                                        */
+/*  Desktop-only measurement tool. Not part of the firmware build.        */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "jx_slab_allocator.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#define JX_BENCH_POOL_SIZE      (64U * 1024U)
+#define JX_BENCH_ROUNDS         20000U
+#define JX_BENCH_LIVE_SLOTS     32U
+
+static uint32_t jx_bench_pool[JX_BENCH_POOL_SIZE / sizeof(uint32_t)];
+
+/* Request sizes typical for short strings, scratch keys and small nodes. */
+static const size_t jx_bench_sizes[] = { 12U, 24U, 40U, 64U, 100U, 16U, 200U, 48U };
+#define JX_BENCH_SIZE_COUNT (sizeof(jx_bench_sizes) / sizeof(jx_bench_sizes[0]))
+
+static double jx_bench_seconds(clock_t start)
+{
+    return (double)(clock() - start) / (double)CLOCKS_PER_SEC;
+}
+
+/*
+ * Bump pool: the only way to reclaim memory is a reset, so each round
+ * allocates a batch and resets afterwards.
+ */
+static void jx_bench_bump(void)
+{
+    JX_ARENA arena;
+    unsigned long operations = 0UL;
+    clock_t start;
+
+    (void)jx_arena_init(&arena, jx_bench_pool, sizeof(jx_bench_pool));
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_ROUNDS; ++round)
+    {
+        for (uint32_t i = 0U; i < JX_BENCH_LIVE_SLOTS; ++i)
+        {
+            volatile uint8_t *block = jx_arena_alloc(&arena, jx_bench_sizes[(round + i) % JX_BENCH_SIZE_COUNT]);
+            if (block != NULL)
+            {
+                block[0] = (uint8_t)i;
+            }
+            operations++;
+        }
+        jx_arena_reset(&arena);
+    }
+
+    printf("bump  alloc+reset     %10lu ops  %8.2f ns/op\n",
+           operations, (jx_bench_seconds(start) * 1e9) / (double)operations);
+}
+
+/*
+ * Slab pool: a rolling window of live blocks where every allocation frees
+ * the oldest one, the pattern a bump pool cannot sustain without reset.
+ */
+static void jx_bench_slab(void)
+{
+    jx_slab_allocator_t *slab;
+    void *live[JX_BENCH_LIVE_SLOTS] = { 0 };
+    JX_ALLOCATOR_STATS stats;
+    unsigned long operations = 0UL;
+    clock_t start;
+
+    slab = jx_slab_allocator_init(jx_bench_pool, sizeof(jx_bench_pool));
+    if (slab == NULL)
+    {
+        return;
+    }
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_ROUNDS; ++round)
+    {
+        for (uint32_t i = 0U; i < JX_BENCH_LIVE_SLOTS; ++i)
+        {
+            volatile uint8_t *block;
+
+            jx_slab_free(slab, live[i]);
+            block = jx_slab_malloc(slab, jx_bench_sizes[(round + i) % JX_BENCH_SIZE_COUNT]);
+            if (block != NULL)
+            {
+                block[0] = (uint8_t)i;
+            }
+            live[i] = (void *)(uintptr_t)block;
+            operations++;
+        }
+    }
+
+    printf("slab  free+alloc      %10lu ops  %8.2f ns/op\n",
+           operations, (jx_bench_seconds(start) * 1e9) / (double)operations);
+
+    jx_slab_get_stats(slab, &stats);
+    printf("slab  pool %lu B, carved %lu B, live %lu B in %lu B blocks, free lists %lu B, failed %lu\n",
+           (unsigned long)stats.pool_size,
+           (unsigned long)stats.carved_bytes,
+           (unsigned long)stats.live_bytes,
+           (unsigned long)stats.live_block_bytes,
+           (unsigned long)stats.free_list_bytes,
+           (unsigned long)stats.failed_allocations);
+}
+
+int main(void)
+{
+    jx_bench_bump();
+    jx_bench_slab();
+    return 0;
+}
@@ -0,0 +1,97 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_bench_corpus.h                                               */
+/*  @brief Shared JSON corpus and mapping for benchmarks and tests        */
+/*                                                                        */
+/*  Device telemetry documents in the shapes JsonX meets in the field:   */
+/*  minified, formatted, escaped, partial and with unknown members.       */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef JX_BENCH_CORPUS_H
+#define JX_BENCH_CORPUS_H
+
+#include "jx_api.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define JX_BENCH_SAMPLE_COUNT   4U
+
+typedef struct
+{
+    uint32_t id;
+    char     name[24];
+    int32_t  temperature;
+    uint64_t uptime_ms;
+    bool     online;
+    uint32_t samples[JX_BENCH_SAMPLE_COUNT];
+    char     ssid[24];
+    int32_t  rssi;
+} JX_BENCH_DEVICE;
+
+typedef struct
+{
+    JX_ELEMENT samples[JX_BENCH_SAMPLE_COUNT];
+    JX_ELEMENT network[2];
+    JX_ELEMENT root[7];
+} JX_BENCH_MAPPING;
+
+#define JX_BENCH_ROOT_COUNT     (sizeof(((JX_BENCH_MAPPING *)0)->root) / sizeof(JX_ELEMENT))
+
+static const char *const jx_bench_corpus[] =
+{
+    "{\"id\":1,\"name\":\"sensor-01\",\"temperature\":21,\"uptime_ms\":86400000,"
+    "\"online\":true,\"samples\":[10,20,30,40],\"network\":{\"ssid\":\"plant-a\",\"rssi\":-61}}",
+
+    "{\n"
+    "  \"id\": 2,\n"
+    "  \"name\": \"sensor-02\",\n"
+    "  \"temperature\": -7,\n"
+    "  \"uptime_ms\": 4294967296123,\n"
+    "  \"online\": false,\n"
+    "  \"samples\": [ 1, 2, 3, 4 ],\n"
+    "  \"network\": { \"ssid\": \"plant-b\", \"rssi\": -88 }\n"
+    "}",
+
+    "{\"id\":3,\"name\":\"tab\\tquote\\\"slash\\/\",\"temperature\":0,\"uptime_ms\":0,"
+    "\"online\":true,\"samples\":[0,0,0,0],\"network\":{\"ssid\":\"esc\\\\aped\",\"rssi\":0}}",
+
+    "{\"id\":4,\"temperature\":35,\"online\":true}",
+
+    "{\"fw\":\"2.0.0\",\"id\":5,\"tags\":[\"a\",{\"b\":null}],\"name\":\"sensor-05\","
+    "\"temperature\":18,\"extra\":{\"x\":1.5e3,\"y\":[true,false,null]},\"uptime_ms\":5000,"
+    "\"online\":false,\"samples\":[5,6,7,8],\"network\":{\"ssid\":\"plant-c\",\"rssi\":-45,\"bssid\":\"00:11\"}}",
+
+    "{\"id\":4294967295,\"name\":\"max\",\"temperature\":-2147483648,\"uptime_ms\":18446744073709551615,"
+    "\"online\":true,\"samples\":[4294967295,0,1,2],\"network\":{\"ssid\":\"\",\"rssi\":2147483647}}"
+};
+
+#define JX_BENCH_CORPUS_COUNT   (sizeof(jx_bench_corpus) / sizeof(jx_bench_corpus[0]))
+
+/**
+ * @brief Bind @p mapping to the fields of @p device.
+ */
+static inline void jx_bench_bind(JX_BENCH_MAPPING *mapping, JX_BENCH_DEVICE *device)
+{
+    for (size_t i = 0U; i < JX_BENCH_SAMPLE_COUNT; ++i)
+    {
+        mapping->samples[i] = (JX_ELEMENT)JX_U32_VAL(device->samples[i]);
+    }
+
+    mapping->network[0] = (JX_ELEMENT)JX_PROPERTY_STRING_BUFFER("ssid", device->ssid);
+    mapping->network[1] = (JX_ELEMENT)JX_PROPERTY_I32("rssi", device->rssi);
+
+    mapping->root[0] = (JX_ELEMENT)JX_PROPERTY_U32("id", device->id);
+    mapping->root[1] = (JX_ELEMENT)JX_PROPERTY_STRING_BUFFER("name", device->name);
+    mapping->root[2] = (JX_ELEMENT)JX_PROPERTY_I32("temperature", device->temperature);
+    mapping->root[3] = (JX_ELEMENT)JX_PROPERTY_U64("uptime_ms", device->uptime_ms);
+    mapping->root[4] = (JX_ELEMENT)JX_PROPERTY_BOOLEAN("online", device->online);
+    mapping->root[5] = (JX_ELEMENT)JX_PROPERTY_ARRAY("samples", mapping->samples);
+    mapping->root[6] = (JX_ELEMENT)JX_PROPERTY_OBJECT("network", mapping->network);
+}
+
+#endif /* JX_BENCH_CORPUS_H */
@@ -0,0 +1,306 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_bench_parallel.c                                             */
+/*  @brief Parallel record array and batch benchmark (JsonX)              */
+/*                                                                        */
+/*  Desktop-only measurement tool. Not part of the firmware build.        */
+/*  Usage: jsonx_bench_parallel [max_threads]                             */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "jx_api.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define JX_BENCH_RECORDS        3000000U
+#define JX_BENCH_RANGE_SIZE     4096U
+#define JX_BENCH_RECORD_BYTES   64U
+#define JX_BENCH_MAX_THREADS    64U
+#define JX_BENCH_BATCH_JOBS     200000U
+#define JX_BENCH_BATCH_BYTES    64U
+#define JX_BENCH_BATCH_RANGE    64U
+
+typedef struct
+{
+    uint32_t id;
+    int32_t  temperature;
+    uint64_t timestamp;
+    char     source[16];
+} JX_BENCH_RECORD;
+
+static JX_BENCH_RECORD *jx_bench_records;
+static JX_RECORDS jx_bench_set;
+static JX_ELEMENT jx_bench_template[3];
+static JX_ELEMENT jx_bench_root[1];
+static JX_RANGE_JOB jx_bench_job;
+static char *jx_bench_output;
+static size_t *jx_bench_lengths;
+
+static JX_BENCH_RECORD *jx_bench_parsed;
+static JX_RECORDS jx_bench_parsed_set;
+static JX_ELEMENT jx_bench_parsed_template[3];
+static JX_ELEMENT jx_bench_parsed_root[1];
+static char *jx_bench_document;
+static const char *jx_bench_bulk;
+static size_t jx_bench_bulk_size;
+static JX_SPAN *jx_bench_items;
+static volatile int jx_bench_failed;
+
+static JX_ELEMENT (*jx_bench_batch_maps)[3];
+static JX_BATCH_JOB *jx_bench_batch_jobs;
+static char *jx_bench_batch_output;
+
+static double jx_bench_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static void *jx_bench_worker(void *argument)
+{
+    size_t index;
+    size_t first;
+    size_t count;
+
+    (void)argument;
+
+    /* Each range owns a fixed output slot, so workers never contend. */
+    while (jx_range_job_claim(&jx_bench_job, &index, &first, &count))
+    {
+        (void)jx_struct_to_json_range(jx_bench_root, 1U, &jx_bench_root[0], first, count,
+                                      &jx_bench_output[index * JX_BENCH_RANGE_SIZE * JX_BENCH_RECORD_BYTES],
+                                      JX_BENCH_RANGE_SIZE * JX_BENCH_RECORD_BYTES,
+                                      JX_MINIFIED, &jx_bench_lengths[index]);
+    }
+
+    return NULL;
+}
+
+static void *jx_bench_parse_worker(void *argument)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_ELEMENT template[3];
+    JX_ELEMENT records_element = jx_bench_parsed_root[0];
+    size_t index;
+    size_t first;
+    size_t count;
+
+    (void)argument;
+
+    /* Parsing updates mapping status, so every worker owns its template. */
+    memcpy(template, jx_bench_parsed_template, sizeof(template));
+    records_element.element = template;
+
+    while (jx_range_job_claim(&jx_bench_job, &index, &first, &count))
+    {
+        if (jx_records_parse_items(&context, jx_bench_bulk, jx_bench_items, first, count,
+                                   &records_element, JX_MODE_STRICT) != JX_SUCCESS)
+        {
+            jx_bench_failed = 1;
+        }
+    }
+
+    return NULL;
+}
+
+static double jx_bench_spawn(unsigned threads, void *(*worker)(void *))
+{
+    pthread_t workers[JX_BENCH_MAX_THREADS];
+    double start = jx_bench_now();
+
+    for (unsigned i = 0U; i < threads; ++i)
+    {
+        (void)pthread_create(&workers[i], NULL, worker, NULL);
+    }
+    for (unsigned i = 0U; i < threads; ++i)
+    {
+        (void)pthread_join(workers[i], NULL);
+    }
+
+    return jx_bench_now() - start;
+}
+
+static void *jx_bench_batch_worker(void *argument)
+{
+    (void)argument;
+
+    if (jx_struct_to_json_batch_shared(&jx_bench_job, jx_bench_batch_jobs) != JX_SUCCESS)
+    {
+        jx_bench_failed = 1;
+    }
+
+    return NULL;
+}
+
+static void jx_bench_run_batch(unsigned threads)
+{
+    double seconds;
+
+    (void)jx_range_job_init(&jx_bench_job, JX_BENCH_BATCH_JOBS, JX_BENCH_BATCH_RANGE);
+    seconds = jx_bench_spawn(threads, jx_bench_batch_worker);
+
+    printf("batch %2u thread(s)  %lu jobs     %8.1f ms  %8.0f ns/job%s\n",
+           threads,
+           (unsigned long)JX_BENCH_BATCH_JOBS,
+           seconds * 1e3,
+           (seconds * 1e9) / (double)JX_BENCH_BATCH_JOBS,
+           jx_bench_failed ? "  FAILED" : "");
+}
+
+static void jx_bench_run_parse(unsigned threads, size_t items)
+{
+    double seconds;
+
+    (void)jx_range_job_init(&jx_bench_job, items, JX_BENCH_RANGE_SIZE);
+    memset(jx_bench_parsed, 0, JX_BENCH_RECORDS * sizeof(JX_BENCH_RECORD));
+    seconds = jx_bench_spawn(threads, jx_bench_parse_worker);
+
+    printf("parse %2u thread(s)  %lu records  %8.1f ms  %8.1f MB/s%s\n",
+           threads,
+           (unsigned long)items,
+           seconds * 1e3,
+           ((double)jx_bench_bulk_size / (1024.0 * 1024.0)) / seconds,
+           jx_bench_failed ? "  FAILED" : "");
+}
+
+static void jx_bench_run(unsigned threads)
+{
+    size_t ranges;
+    size_t bytes = 0U;
+    double seconds;
+
+    (void)jx_range_job_init(&jx_bench_job, JX_BENCH_RECORDS, JX_BENCH_RANGE_SIZE);
+    ranges = jx_range_job_count(&jx_bench_job);
+    seconds = jx_bench_spawn(threads, jx_bench_worker);
+
+    for (size_t i = 0U; i < ranges; ++i)
+    {
+        bytes += jx_bench_lengths[i];
+    }
+
+    printf("write %2u thread(s)  %lu records  %8.1f ms  %8.1f MB/s\n",
+           threads,
+           (unsigned long)JX_BENCH_RECORDS,
+           seconds * 1e3,
+           ((double)bytes / (1024.0 * 1024.0)) / seconds);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned max_threads = (argc > 1) ? (unsigned)strtoul(argv[1], NULL, 10) : 4U;
+    size_t ranges = (JX_BENCH_RECORDS + JX_BENCH_RANGE_SIZE - 1U) / JX_BENCH_RANGE_SIZE;
+    size_t document_length = 0U;
+    size_t items = 0U;
+    double start;
+
+    if ((max_threads == 0U) || (max_threads > JX_BENCH_MAX_THREADS))
+    {
+        max_threads = 4U;
+    }
+
+    jx_bench_records = calloc(JX_BENCH_RECORDS, sizeof(JX_BENCH_RECORD));
+    jx_bench_output = malloc(ranges * JX_BENCH_RANGE_SIZE * JX_BENCH_RECORD_BYTES);
+    jx_bench_lengths = calloc(ranges, sizeof(size_t));
+    jx_bench_parsed = calloc(JX_BENCH_RECORDS, sizeof(JX_BENCH_RECORD));
+    jx_bench_document = malloc(ranges * JX_BENCH_RANGE_SIZE * JX_BENCH_RECORD_BYTES);
+    jx_bench_items = calloc(JX_BENCH_RECORDS, sizeof(JX_SPAN));
+    jx_bench_batch_maps = calloc(JX_BENCH_BATCH_JOBS, sizeof(*jx_bench_batch_maps));
+    jx_bench_batch_jobs = calloc(JX_BENCH_BATCH_JOBS, sizeof(JX_BATCH_JOB));
+    jx_bench_batch_output = malloc((size_t)JX_BENCH_BATCH_JOBS * JX_BENCH_BATCH_BYTES);
+    if ((jx_bench_records == NULL) || (jx_bench_output == NULL) || (jx_bench_lengths == NULL) ||
+        (jx_bench_parsed == NULL) || (jx_bench_document == NULL) || (jx_bench_items == NULL) ||
+        (jx_bench_batch_maps == NULL) || (jx_bench_batch_jobs == NULL) || (jx_bench_batch_output == NULL))
+    {
+        return 1;
+    }
+
+    for (uint32_t i = 0U; i < JX_BENCH_RECORDS; ++i)
+    {
+        jx_bench_records[i].id = i;
+        jx_bench_records[i].temperature = (int32_t)(i % 80U) - 20;
+        jx_bench_records[i].timestamp = 1700000000000ULL + i;
+        snprintf(jx_bench_records[i].source, sizeof(jx_bench_records[i].source), "node-%lu",
+                 (unsigned long)(i % 512U));
+    }
+
+    jx_bench_set = (JX_RECORDS){ jx_bench_records, sizeof(JX_BENCH_RECORD), JX_BENCH_RECORDS, JX_BENCH_RECORDS };
+    jx_bench_template[0] = (JX_ELEMENT)JX_PROPERTY_U32("id", jx_bench_records[0].id);
+    jx_bench_template[1] = (JX_ELEMENT)JX_PROPERTY_I32("t", jx_bench_records[0].temperature);
+    jx_bench_template[2] = (JX_ELEMENT)JX_PROPERTY_STRING_BUFFER("src", jx_bench_records[0].source);
+    jx_bench_root[0] = (JX_ELEMENT)JX_PROPERTY_RECORD_ARRAY("records", jx_bench_set, jx_bench_template);
+
+    jx_bench_parsed_set = (JX_RECORDS){ jx_bench_parsed, sizeof(JX_BENCH_RECORD), 0U, JX_BENCH_RECORDS };
+    jx_bench_parsed_template[0] = (JX_ELEMENT)JX_PROPERTY_U32("id", jx_bench_parsed[0].id);
+    jx_bench_parsed_template[1] = (JX_ELEMENT)JX_PROPERTY_I32("t", jx_bench_parsed[0].temperature);
+    jx_bench_parsed_template[2] = (JX_ELEMENT)JX_PROPERTY_STRING_BUFFER("src", jx_bench_parsed[0].source);
+    jx_bench_parsed_root[0] = (JX_ELEMENT)JX_PROPERTY_RECORD_ARRAY("records", jx_bench_parsed_set, jx_bench_parsed_template);
+
+    for (unsigned threads = 1U; threads <= max_threads; threads *= 2U)
+    {
+        jx_bench_run(threads);
+    }
+
+    /* Independent per-device responses, one small mapping each. */
+    for (size_t i = 0U; i < JX_BENCH_BATCH_JOBS; ++i)
+    {
+        jx_bench_batch_maps[i][0] = (JX_ELEMENT)JX_PROPERTY_U32("id", jx_bench_records[i].id);
+        jx_bench_batch_maps[i][1] = (JX_ELEMENT)JX_PROPERTY_I32("t", jx_bench_records[i].temperature);
+        jx_bench_batch_maps[i][2] = (JX_ELEMENT)JX_PROPERTY_STRING_BUFFER("src", jx_bench_records[i].source);
+        jx_bench_batch_jobs[i] = (JX_BATCH_JOB){ jx_bench_batch_maps[i], 3U,
+                                                 &jx_bench_batch_output[i * JX_BENCH_BATCH_BYTES],
+                                                 JX_BENCH_BATCH_BYTES, JX_MINIFIED, JX_ERROR };
+    }
+
+    for (unsigned threads = 1U; threads <= max_threads; threads *= 2U)
+    {
+        jx_bench_run_batch(threads);
+    }
+
+    /* The bulk upload is the bare record array of the joined output. */
+    for (size_t i = 0U; i < ranges; ++i)
+    {
+        memcpy(&jx_bench_document[document_length],
+               &jx_bench_output[i * JX_BENCH_RANGE_SIZE * JX_BENCH_RECORD_BYTES], jx_bench_lengths[i]);
+        document_length += jx_bench_lengths[i];
+    }
+    jx_bench_document[document_length - 1U] = '\0';
+    jx_bench_bulk = strchr(jx_bench_document, '[');
+    jx_bench_bulk_size = strlen(jx_bench_bulk);
+
+    start = jx_bench_now();
+    if (jx_array_split(jx_bench_bulk, jx_bench_items, JX_BENCH_RECORDS, &items) != JX_SUCCESS)
+    {
+        return 1;
+    }
+    printf("split  1 thread(s)  %lu items    %8.1f ms  (%.1f MB array)\n",
+           (unsigned long)items,
+           (jx_bench_now() - start) * 1e3,
+           (double)jx_bench_bulk_size / (1024.0 * 1024.0));
+
+    for (unsigned threads = 1U; threads <= max_threads; threads *= 2U)
+    {
+        jx_bench_run_parse(threads, items);
+    }
+
+    free(jx_bench_batch_output);
+    free(jx_bench_batch_jobs);
+    free(jx_bench_batch_maps);
+    free(jx_bench_items);
+    free(jx_bench_document);
+    free(jx_bench_parsed);
+    free(jx_bench_lengths);
+    free(jx_bench_output);
+    free(jx_bench_records);
+    return 0;
+}
@@ -0,0 +1,719 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_bench_parse.c                                                */
+/*  @brief Parse and serialize throughput over the shared corpus (JsonX)  */
+/*                                                                        */
+/*  Desktop-only measurement tool. Not part of the firmware build.        */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "jx_bench_corpus.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define JX_BENCH_ROUNDS         200000U
+#define JX_BENCH_BUFFER_SIZE    512U
+#define JX_BENCH_TEXT_SIZE      (1024U * 1024U)
+#define JX_BENCH_TEXT_ROUNDS    200U
+#define JX_BENCH_RECORD_COUNT   32U
+#define JX_BENCH_RECORDS_SIZE   4096U
+#define JX_BENCH_RECORDS_ROUNDS 20000U
+#define JX_BENCH_SHAPE_SLOTS    64U
+#define JX_BENCH_STREAM_SIZE    (64U * 1024U)
+#define JX_BENCH_STREAM_ROUNDS  2000U
+#define JX_BENCH_ITEM_COUNT     1000U
+#define JX_BENCH_ITEM_ROUNDS    200U
+#define JX_BENCH_HTTP_CHUNK     32U
+#define JX_BENCH_HTTP_READ      64U
+
+static char jx_bench_input[JX_BENCH_CORPUS_COUNT][JX_BENCH_BUFFER_SIZE];
+static char jx_bench_text[JX_BENCH_TEXT_SIZE];
+
+static double jx_bench_seconds(clock_t start)
+{
+    return (double)(clock() - start) / (double)CLOCKS_PER_SEC;
+}
+
+static void jx_bench_report(const char *label, unsigned long bytes, unsigned long documents, double seconds)
+{
+    printf("%-24s %10lu docs  %8.1f ns/doc  %8.1f MB/s\n",
+           label,
+           documents,
+           (seconds * 1e9) / (double)documents,
+           ((double)bytes / (1024.0 * 1024.0)) / seconds);
+}
+
+static void jx_bench_parse(JX_PARSE_MODE mode, const char *label)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_BENCH_DEVICE device;
+    JX_BENCH_MAPPING mapping;
+    unsigned long bytes = 0UL;
+    unsigned long documents = 0UL;
+    clock_t start;
+
+    jx_bench_bind(&mapping, &device);
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_ROUNDS; ++round)
+    {
+        size_t i = round % JX_BENCH_CORPUS_COUNT;
+
+        if (jx_context_json_to_struct(&context, jx_bench_input[i], mapping.root,
+                                      JX_BENCH_ROOT_COUNT, mode) == JX_SUCCESS)
+        {
+            bytes += (unsigned long)strlen(jx_bench_corpus[i]);
+            documents++;
+        }
+    }
+
+    jx_bench_report(label, bytes, documents, jx_bench_seconds(start));
+}
+
+static void jx_bench_write(JX_FORMAT format, const char *label)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_BENCH_DEVICE device;
+    JX_BENCH_MAPPING mapping;
+    char output[JX_BENCH_BUFFER_SIZE];
+    unsigned long bytes = 0UL;
+    unsigned long documents = 0UL;
+    clock_t start;
+
+    memset(&device, 0, sizeof(device));
+    jx_bench_bind(&mapping, &device);
+    (void)jx_context_json_to_struct(&context, jx_bench_input[0], mapping.root,
+                                    JX_BENCH_ROOT_COUNT, JX_MODE_RELAXED);
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_ROUNDS; ++round)
+    {
+        if (jx_context_struct_to_json(&context, mapping.root, JX_BENCH_ROOT_COUNT,
+                                      output, sizeof(output), format) == JX_SUCCESS)
+        {
+            bytes += (unsigned long)strlen(output);
+            documents++;
+        }
+    }
+
+    jx_bench_report(label, bytes, documents, jx_bench_seconds(start));
+}
+
+/* Three subsystem mappings written as one document: copied into a combined root, or as parts. */
+static void jx_bench_write_parts(bool parts, const char *label)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_BENCH_DEVICE device;
+    JX_BENCH_MAPPING mapping;
+    JX_ELEMENT combined[JX_BENCH_ROOT_COUNT];
+    JX_DOCUMENT_PART part_list[3];
+    char output[JX_BENCH_BUFFER_SIZE];
+    unsigned long bytes = 0UL;
+    unsigned long documents = 0UL;
+    clock_t start;
+
+    memset(&device, 0, sizeof(device));
+    jx_bench_bind(&mapping, &device);
+    (void)jx_context_json_to_struct(&context, jx_bench_input[0], mapping.root,
+                                    JX_BENCH_ROOT_COUNT, JX_MODE_RELAXED);
+    part_list[0] = (JX_DOCUMENT_PART){ NULL, &mapping.root[0], 2U };
+    part_list[1] = (JX_DOCUMENT_PART){ NULL, &mapping.root[2], 3U };
+    part_list[2] = (JX_DOCUMENT_PART){ NULL, &mapping.root[5], 2U };
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_ROUNDS; ++round)
+    {
+        JX_STATUS status;
+
+        if (parts)
+        {
+            status = jx_context_struct_to_json_parts(&context, part_list, 3U, output, sizeof(output), JX_MINIFIED);
+        }
+        else
+        {
+            for (size_t i = 0U; i < 3U; ++i)
+            {
+                memcpy(&combined[part_list[i].element - mapping.root], part_list[i].element,
+                       part_list[i].element_size * sizeof(JX_ELEMENT));
+            }
+            status = jx_context_struct_to_json(&context, combined, JX_BENCH_ROOT_COUNT,
+                                               output, sizeof(output), JX_MINIFIED);
+        }
+
+        if (status == JX_SUCCESS)
+        {
+            bytes += (unsigned long)strlen(output);
+            documents++;
+        }
+    }
+
+    jx_bench_report(label, bytes, documents, jx_bench_seconds(start));
+}
+
+static bool jx_bench_count_sink(void *context, const char *data, size_t length)
+{
+    (void)data;
+    *(unsigned long *)context += (unsigned long)length;
+    return true;
+}
+
+/* Chunked output with a digest stage in front of the sink, or none when kind is NULL. */
+static void jx_bench_write_digest(const JX_DIGEST_KIND *kind, const char *label)
+{
+    static const uint8_t key[32] = { 0x4AU, 0x58U };
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_BENCH_DEVICE device;
+    JX_BENCH_MAPPING mapping;
+    JX_DIGEST digest;
+    char chunk[64];
+    uint8_t out[32];
+    unsigned long bytes = 0UL;
+    unsigned long documents = 0UL;
+    clock_t start;
+
+    memset(&device, 0, sizeof(device));
+    jx_bench_bind(&mapping, &device);
+    (void)jx_context_json_to_struct(&context, jx_bench_input[0], mapping.root,
+                                    JX_BENCH_ROOT_COUNT, JX_MODE_RELAXED);
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_ROUNDS; ++round)
+    {
+        JX_STATUS status;
+
+        if (kind == NULL)
+        {
+            status = jx_context_struct_to_json_chunked(&context, mapping.root, JX_BENCH_ROOT_COUNT, chunk,
+                                                       sizeof(chunk), JX_MINIFIED, jx_bench_count_sink, &bytes);
+        }
+        else
+        {
+            (void)jx_digest_init(&digest, *kind, key, sizeof(key), jx_bench_count_sink, &bytes);
+            status = jx_context_struct_to_json_chunked(&context, mapping.root, JX_BENCH_ROOT_COUNT, chunk,
+                                                       sizeof(chunk), JX_MINIFIED, jx_digest_sink, &digest);
+            (void)jx_digest_final(&digest, out, sizeof(out));
+        }
+
+        if (status == JX_SUCCESS)
+        {
+            documents++;
+        }
+    }
+
+    jx_bench_report(label, bytes, documents, jx_bench_seconds(start));
+}
+
+/* Re-applying the document that is already mapped: hash check or compare pass only. */
+static void jx_bench_unchanged(bool compare, const char *label)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_APPLIED applied[JX_BENCH_CORPUS_COUNT];
+    JX_BENCH_DEVICE devices[JX_BENCH_CORPUS_COUNT];
+    JX_BENCH_MAPPING mappings[JX_BENCH_CORPUS_COUNT];
+    unsigned long bytes = 0UL;
+    unsigned long documents = 0UL;
+    clock_t start;
+
+    for (size_t i = 0U; i < JX_BENCH_CORPUS_COUNT; ++i)
+    {
+        applied[i] = (JX_APPLIED)JX_APPLIED_INIT;
+        memset(&devices[i], 0, sizeof(devices[i]));
+        jx_bench_bind(&mappings[i], &devices[i]);
+        (void)jx_context_json_to_struct_if_changed(&context, &applied[i], jx_bench_input[i], mappings[i].root,
+                                                   JX_BENCH_ROOT_COUNT, JX_MODE_RELAXED, NULL);
+    }
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_ROUNDS; ++round)
+    {
+        size_t i = round % JX_BENCH_CORPUS_COUNT;
+        bool unchanged = false;
+
+        if (compare)
+        {
+            (void)jx_json_equals_struct(jx_bench_input[i], mappings[i].root, JX_BENCH_ROOT_COUNT, &unchanged);
+        }
+        else
+        {
+            bool changed = true;
+
+            unchanged = (jx_context_json_to_struct_if_changed(&context, &applied[i], jx_bench_input[i],
+                                                              mappings[i].root, JX_BENCH_ROOT_COUNT,
+                                                              JX_MODE_RELAXED, &changed) == JX_SUCCESS) && !changed;
+        }
+
+        if (unchanged)
+        {
+            bytes += (unsigned long)strlen(jx_bench_corpus[i]);
+            documents++;
+        }
+    }
+
+    jx_bench_report(label, bytes, documents, jx_bench_seconds(start));
+}
+
+/* Same-layout documents replayed through one shape cache per mapping. */
+static void jx_bench_shaped(void)
+{
+    static char skeletons[JX_BENCH_CORPUS_COUNT][JX_BENCH_BUFFER_SIZE];
+    static JX_SHAPE_SLOT slots[JX_BENCH_CORPUS_COUNT][JX_BENCH_SHAPE_SLOTS];
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_SHAPE shapes[JX_BENCH_CORPUS_COUNT];
+    JX_BENCH_DEVICE devices[JX_BENCH_CORPUS_COUNT];
+    JX_BENCH_MAPPING mappings[JX_BENCH_CORPUS_COUNT];
+    unsigned long bytes = 0UL;
+    unsigned long documents = 0UL;
+    clock_t start;
+
+    for (size_t i = 0U; i < JX_BENCH_CORPUS_COUNT; ++i)
+    {
+        (void)jx_shape_init(&shapes[i], skeletons[i], JX_BENCH_BUFFER_SIZE, slots[i], JX_BENCH_SHAPE_SLOTS);
+        jx_bench_bind(&mappings[i], &devices[i]);
+    }
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_ROUNDS; ++round)
+    {
+        size_t i = round % JX_BENCH_CORPUS_COUNT;
+
+        if (jx_context_json_to_struct_shaped(&context, &shapes[i], jx_bench_input[i], mappings[i].root,
+                                             JX_BENCH_ROOT_COUNT, JX_MODE_RELAXED) == JX_SUCCESS)
+        {
+            bytes += (unsigned long)strlen(jx_bench_corpus[i]);
+            documents++;
+        }
+    }
+
+    jx_bench_report("parse shaped", bytes, documents, jx_bench_seconds(start));
+}
+
+/* The root mapping split into three subsystem mappings: one parse each, or one fan-out pass. */
+static void jx_bench_fanout(bool fanout, const char *label)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_BENCH_DEVICE device;
+    JX_BENCH_MAPPING mapping;
+    JX_FANOUT_TARGET targets[3];
+    unsigned long bytes = 0UL;
+    unsigned long documents = 0UL;
+    clock_t start;
+
+    jx_bench_bind(&mapping, &device);
+    targets[0] = (JX_FANOUT_TARGET){ &mapping.root[0], 2U, JX_ERROR };
+    targets[1] = (JX_FANOUT_TARGET){ &mapping.root[2], 3U, JX_ERROR };
+    targets[2] = (JX_FANOUT_TARGET){ &mapping.root[5], 2U, JX_ERROR };
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_ROUNDS; ++round)
+    {
+        size_t i = round % JX_BENCH_CORPUS_COUNT;
+        bool parsed = true;
+
+        if (fanout)
+        {
+            parsed = (jx_context_json_to_struct_fanout(&context, jx_bench_input[i], targets, 3U,
+                                                       JX_MODE_RELAXED) == JX_SUCCESS);
+        }
+        else
+        {
+            for (size_t t = 0U; t < 3U; ++t)
+            {
+                parsed = parsed && (jx_context_json_to_struct(&context, jx_bench_input[i], targets[t].element,
+                                                              targets[t].element_size, JX_MODE_RELAXED) == JX_SUCCESS);
+            }
+        }
+
+        if (parsed)
+        {
+            bytes += (unsigned long)strlen(jx_bench_corpus[i]);
+            documents++;
+        }
+    }
+
+    jx_bench_report(label, bytes, documents, jx_bench_seconds(start));
+}
+
+/* Mapping-free passes over the same corpus; minify writes to a side buffer. */
+static void jx_bench_validate(bool minify, const char *label)
+{
+    char output[JX_BENCH_BUFFER_SIZE];
+    size_t lengths[JX_BENCH_CORPUS_COUNT];
+    unsigned long bytes = 0UL;
+    unsigned long documents = 0UL;
+    clock_t start;
+
+    for (size_t i = 0U; i < JX_BENCH_CORPUS_COUNT; ++i)
+    {
+        lengths[i] = strlen(jx_bench_corpus[i]);
+    }
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_ROUNDS; ++round)
+    {
+        size_t i = round % JX_BENCH_CORPUS_COUNT;
+        JX_STATUS status = minify ? jx_minify(jx_bench_corpus[i], lengths[i], output, NULL)
+                                  : jx_validate(jx_bench_corpus[i], lengths[i]);
+
+        if (status == JX_SUCCESS)
+        {
+            bytes += (unsigned long)lengths[i];
+            documents++;
+        }
+    }
+
+    jx_bench_report(label, bytes, documents, jx_bench_seconds(start));
+}
+
+/* Keep two of the corpus members; the rest is skipped. */
+static void jx_bench_project(void)
+{
+    static const char *const paths[] = { "id", "network.rssi" };
+    char output[JX_BENCH_BUFFER_SIZE];
+    unsigned long bytes = 0UL;
+    unsigned long documents = 0UL;
+    clock_t start;
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_ROUNDS; ++round)
+    {
+        size_t i = round % JX_BENCH_CORPUS_COUNT;
+
+        if (jx_project(jx_bench_corpus[i], paths, 2U, output, sizeof(output), NULL) == JX_SUCCESS)
+        {
+            bytes += (unsigned long)strlen(jx_bench_corpus[i]);
+            documents++;
+        }
+    }
+
+    jx_bench_report("project", bytes, documents, jx_bench_seconds(start));
+}
+
+typedef struct
+{
+    uint32_t id;
+    int32_t  level;
+    char     state[8];
+} JX_BENCH_SAMPLE;
+
+static JX_BENCH_SAMPLE jx_bench_samples[JX_BENCH_RECORD_COUNT];
+static JX_RECORDS jx_bench_sample_set = JX_RECORDS_INIT(jx_bench_samples, JX_BENCH_RECORD_COUNT);
+
+static JX_ELEMENT jx_bench_sample_template[] =
+{
+    JX_PROPERTY_U32("sample_id", jx_bench_samples[0].id),
+    JX_PROPERTY_I32("signal_level", jx_bench_samples[0].level),
+    JX_PROPERTY_STRING_BUFFER("link_state", jx_bench_samples[0].state)
+};
+
+static JX_ELEMENT jx_bench_sample_root[] =
+{
+    JX_PROPERTY_RECORD_ARRAY("samples", jx_bench_sample_set, jx_bench_sample_template)
+};
+
+/* Write and parse a record array in the row form or the columnar form. */
+static void jx_bench_records(JX_FORMAT format, const char *label)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    char document[JX_BENCH_RECORDS_SIZE];
+    char input[JX_BENCH_RECORDS_SIZE];
+    size_t length;
+    unsigned long bytes = 0UL;
+    unsigned long documents = 0UL;
+    clock_t start;
+
+    for (uint32_t i = 0U; i < JX_BENCH_RECORD_COUNT; ++i)
+    {
+        jx_bench_samples[i].id = 1000U + i;
+        jx_bench_samples[i].level = -40 - (int32_t)i;
+        strcpy(jx_bench_samples[i].state, ((i % 3U) == 0U) ? "down" : "up");
+    }
+
+    if (jx_context_struct_to_json(&context, jx_bench_sample_root, 1U, document, sizeof(document), format) != JX_SUCCESS)
+    {
+        return;
+    }
+    length = strlen(document);
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_RECORDS_ROUNDS; ++round)
+    {
+        memcpy(input, document, length + 1U);
+        if (jx_context_json_to_struct(&context, input, jx_bench_sample_root, 1U, JX_MODE_RELAXED) == JX_SUCCESS)
+        {
+            bytes += (unsigned long)length;
+            documents++;
+        }
+    }
+
+    jx_bench_report(label, bytes, documents, jx_bench_seconds(start));
+}
+
+static bool jx_bench_stream_source(void *context, char *data, size_t size, size_t *length)
+{
+    size_t *remaining = (size_t *)context;
+
+    *length = (*remaining < size) ? *remaining : size;
+    memset(data, 'x', *length);
+    *remaining -= *length;
+    return true;
+}
+
+/* A 64 KiB string field through JX_STRING_STREAM_CHUNK bytes of stack, in or out. */
+static void jx_bench_stream(bool write, const char *label)
+{
+    static char document[JX_BENCH_STREAM_SIZE + 16U];
+    static char output[JX_BENCH_STREAM_SIZE + 16U];
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    unsigned long received = 0UL;
+    size_t remaining = 0U;
+    JX_STRING_STREAM stream = { jx_bench_count_sink, &received, jx_bench_stream_source, &remaining, 0U };
+    JX_ELEMENT root[] = { JX_PROPERTY_STRING_STREAM("body", stream) };
+    unsigned long documents = 0UL;
+    clock_t start;
+
+    memcpy(document, "{\"body\":\"", 9U);
+    memset(&document[9], 'x', JX_BENCH_STREAM_SIZE);
+    memcpy(&document[9U + JX_BENCH_STREAM_SIZE], "\"}", 3U);
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_STREAM_ROUNDS; ++round)
+    {
+        JX_STATUS status;
+
+        remaining = JX_BENCH_STREAM_SIZE;
+        status = write ? jx_context_struct_to_json(&context, root, 1U, output, sizeof(output), JX_MINIFIED)
+                       : jx_context_json_to_struct(&context, document, root, 1U, JX_MODE_RELAXED);
+        if (status == JX_SUCCESS)
+        {
+            documents++;
+        }
+    }
+
+    jx_bench_report(label, documents * JX_BENCH_STREAM_SIZE, documents, jx_bench_seconds(start));
+}
+
+static bool jx_bench_item_sink(void *context, size_t index)
+{
+    (void)index;
+    (*(unsigned long *)context)++;
+    return true;
+}
+
+/* A 1000-event array handed over one item at a time through a single template. */
+static void jx_bench_item_stream(void)
+{
+    static char document[JX_BENCH_ITEM_COUNT * 48U];
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    unsigned long items = 0UL;
+    uint32_t id = 0U;
+    uint32_t level = 0U;
+    char source[16];
+    JX_ITEM_STREAM events = JX_ITEM_STREAM_INIT(jx_bench_item_sink, NULL, &items);
+    JX_ELEMENT event[] =
+    {
+        JX_PROPERTY_U32("id", id),
+        JX_PROPERTY_U32("level", level),
+        JX_PROPERTY_STRING_BUFFER("source", source)
+    };
+    JX_ELEMENT root[] = { JX_PROPERTY_ITEM_STREAM("events", events, event) };
+    unsigned long documents = 0UL;
+    size_t length;
+    clock_t start;
+
+    length = (size_t)snprintf(document, sizeof(document), "{\"events\":[");
+    for (uint32_t i = 0U; i < JX_BENCH_ITEM_COUNT; ++i)
+    {
+        length += (size_t)snprintf(&document[length], sizeof(document) - length,
+                                   "%s{\"id\":%u,\"level\":%u,\"source\":\"pump\"}",
+                                   (i != 0U) ? "," : "", i, i % 5U);
+    }
+    length += (size_t)snprintf(&document[length], sizeof(document) - length, "]}");
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_ITEM_ROUNDS; ++round)
+    {
+        if (jx_context_json_to_struct(&context, document, root, 1U, JX_MODE_RELAXED) == JX_SUCCESS)
+        {
+            documents++;
+        }
+    }
+
+    jx_bench_report("parse item stream 1k", documents * length, documents, jx_bench_seconds(start));
+}
+
+/* De-chunking the way a server does it without the decoder: a full copy of the body first. */
+static size_t jx_bench_dechunk(const char *body, char *output, size_t size)
+{
+    size_t length = 0U;
+
+    for (;;)
+    {
+        char *end;
+        size_t chunk = (size_t)strtoul(body, &end, 16);
+
+        body = strstr(end, "\r\n") + 2;
+        if ((chunk == 0U) || ((length + chunk) >= size))
+        {
+            break;
+        }
+        memcpy(&output[length], body, chunk);
+        length += chunk;
+        body += chunk + 2U;
+    }
+
+    output[length] = '\0';
+    return length;
+}
+
+/* Corpus documents as chunked request bodies, received in socket-sized reads. */
+static void jx_bench_http(bool fused, const char *label)
+{
+    static char bodies[JX_BENCH_CORPUS_COUNT][JX_BENCH_BUFFER_SIZE * 2U];
+    static size_t body_lengths[JX_BENCH_CORPUS_COUNT];
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_BENCH_DEVICE device;
+    JX_BENCH_MAPPING mapping;
+    char document[JX_BENCH_BUFFER_SIZE];
+    char body[JX_BENCH_BUFFER_SIZE * 2U];
+    JX_STREAM stream;
+    JX_CHUNKED chunked;
+    unsigned long bytes = 0UL;
+    unsigned long documents = 0UL;
+    clock_t start;
+
+    jx_bench_bind(&mapping, &device);
+    (void)jx_stream_init(&stream, document, sizeof(document));
+    (void)jx_chunked_init(&chunked, &stream);
+    for (size_t i = 0U; i < JX_BENCH_CORPUS_COUNT; ++i)
+    {
+        const char *text = jx_bench_input[i];
+        size_t length = strlen(text);
+        size_t written = 0U;
+
+        for (size_t pos = 0U; pos < length; pos += JX_BENCH_HTTP_CHUNK)
+        {
+            size_t size = ((length - pos) < JX_BENCH_HTTP_CHUNK) ? (length - pos) : JX_BENCH_HTTP_CHUNK;
+
+            written += (size_t)snprintf(&bodies[i][written], sizeof(bodies[i]) - written, "%zx\r\n%.*s\r\n",
+                                        size, (int)size, &text[pos]);
+        }
+        written += (size_t)snprintf(&bodies[i][written], sizeof(bodies[i]) - written, "0\r\n\r\n");
+        body_lengths[i] = written;
+    }
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_ROUNDS; ++round)
+    {
+        size_t i = round % JX_BENCH_CORPUS_COUNT;
+        size_t received = 0U;
+        JX_STATUS status = JX_SUCCESS;
+
+        if (fused)
+        {
+            jx_chunked_reset(&chunked);
+            for (size_t pos = 0U; (pos < body_lengths[i]) && (status == JX_SUCCESS); pos += JX_BENCH_HTTP_READ)
+            {
+                size_t read = ((body_lengths[i] - pos) < JX_BENCH_HTTP_READ) ? (body_lengths[i] - pos) :
+                              JX_BENCH_HTTP_READ;
+
+                status = jx_chunked_feed(&chunked, &bodies[i][pos], read, NULL);
+            }
+            status = ((status == JX_SUCCESS) && jx_stream_is_complete(&stream)) ?
+                     jx_context_json_to_struct(&context, document, mapping.root, JX_BENCH_ROOT_COUNT,
+                                               JX_MODE_RELAXED) : JX_ERROR;
+            jx_stream_reset(&stream);
+        }
+        else
+        {
+            /* Reads gathered into a body buffer, then de-chunked into the document. */
+            for (size_t pos = 0U; pos < body_lengths[i]; pos += received)
+            {
+                received = ((body_lengths[i] - pos) < JX_BENCH_HTTP_READ) ? (body_lengths[i] - pos) :
+                           JX_BENCH_HTTP_READ;
+                memcpy(&body[pos], &bodies[i][pos], received);
+            }
+            body[body_lengths[i]] = '\0';
+            (void)jx_bench_dechunk(body, document, sizeof(document));
+            status = jx_context_json_to_struct(&context, document, mapping.root, JX_BENCH_ROOT_COUNT,
+                                               JX_MODE_RELAXED);
+        }
+
+        if (status == JX_SUCCESS)
+        {
+            bytes += (unsigned long)body_lengths[i];
+            documents++;
+        }
+    }
+
+    jx_bench_report(label, bytes, documents, jx_bench_seconds(start));
+}
+
+/* Mostly ASCII text with two multi-byte sequences in every 57 bytes. */
+static void jx_bench_utf8(void)
+{
+    static const char pattern[] = "sensor reading within range, operator note: caf\xC3\xA9 \xE2\x82\xAC 42 ";
+    unsigned long valid = 0UL;
+    clock_t start;
+    double seconds;
+
+    for (size_t i = 0U; i < JX_BENCH_TEXT_SIZE; ++i)
+    {
+        jx_bench_text[i] = pattern[i % (sizeof(pattern) - 1U)];
+    }
+    jx_bench_text[JX_BENCH_TEXT_SIZE - 1U] = ' ';
+
+    start = clock();
+    for (uint32_t round = 0U; round < JX_BENCH_TEXT_ROUNDS; ++round)
+    {
+        valid += jx_utf8_validate(jx_bench_text, JX_BENCH_TEXT_SIZE - 16U) ? 1UL : 0UL;
+    }
+    seconds = jx_bench_seconds(start);
+
+    printf("%-24s %10lu MB    %8.3f ns/byte %8.1f MB/s\n",
+           "utf8 validate",
+           valid,
+           (seconds * 1e9) / ((double)JX_BENCH_TEXT_SIZE * JX_BENCH_TEXT_ROUNDS),
+           (double)JX_BENCH_TEXT_ROUNDS / seconds);
+}
+
+int main(void)
+{
+    for (size_t i = 0U; i < JX_BENCH_CORPUS_COUNT; ++i)
+    {
+        strncpy(jx_bench_input[i], jx_bench_corpus[i], JX_BENCH_BUFFER_SIZE - 1U);
+    }
+
+    jx_bench_parse(JX_MODE_RELAXED, "parse relaxed");
+    jx_bench_parse(JX_MODE_TRUSTED, "parse trusted");
+    jx_bench_shaped();
+    jx_bench_fanout(false, "parse 3 mappings");
+    jx_bench_fanout(true, "parse fan-out 3");
+    jx_bench_unchanged(false, "unchanged by hash");
+    jx_bench_unchanged(true, "unchanged by compare");
+    jx_bench_write(JX_MINIFIED, "write minified");
+    jx_bench_write(JX_MINIFIED_ASCII, "write minified ascii");
+    jx_bench_write_parts(false, "write merged 3 mappings");
+    jx_bench_write_parts(true, "write parts 3 mappings");
+    jx_bench_write_digest(NULL, "write chunked");
+    jx_bench_write_digest(&(const JX_DIGEST_KIND){ JX_DIGEST_CRC32C }, "write chunked crc32c");
+    jx_bench_write_digest(&(const JX_DIGEST_KIND){ JX_DIGEST_HMAC_SHA256 }, "write chunked hmac");
+    jx_bench_validate(false, "validate");
+    jx_bench_validate(true, "minify");
+    jx_bench_project();
+    jx_bench_records(JX_MINIFIED, "parse records");
+    jx_bench_records((JX_FORMAT)(JX_MINIFIED | JX_FORMAT_COLUMNS), "parse records columnar");
+    jx_bench_stream(false, "parse string stream 64k");
+    jx_bench_stream(true, "write string stream 64k");
+    jx_bench_item_stream();
+    jx_bench_http(false, "http de-chunk + parse");
+    jx_bench_http(true, "http chunked feed");
+    jx_bench_utf8();
+    return 0;
+}
@@ -95,7 +95,6 @@ JX_STATUS jx_init(JX_HOOKS *hooks);
  */
 void jx_parser_deinit(void);
 
-#if !defined(JX_USE_BAREMETAL) || defined(JX_USE_HEAP_BAREMETAL)
 /**
  * @brief Allocate memory from the allocator configured for JsonX.
  *
@@ -108,6 +107,11 @@ void jx_parser_deinit(void);
  * This function is used internally by JsonX and may also be used by callers
  * that need temporary buffers with the same ownership model.
  *
+ * In static bare-metal bump mode, conversion calls never release pool
+ * memory, so blocks allocated here stay valid across calls. Use
+ * @ref jx_get_arena with @ref jx_arena_mark / @ref jx_arena_release to scope
+ * temporary allocations explicitly.
+ *
  * @param memory_size  Number of bytes to allocate.
  *
  * @return Pointer to the allocated memory, or NULL if allocation failed.
@@ -121,16 +125,122 @@ void *jx_alloc_memory(size_t memory_size);
  *
  * This function returns memory to the internal allocator.
  * On RTOS systems, memory is released back to the RTOS pool.
- * On baremetal systems, this function is a no-op (placeholder),
- * as static memory cannot be freed selectively.
+ * With @ref JX_ENABLE_SLAB_ALLOCATOR, the block returns to its size-class
+ * free list of the static pool in O(1). With the static bump pool, this
+ * function is a no-op; memory returns through @ref jx_arena_release.
  *
  * @param memory_ptr Pointer to memory previously returned by @ref jx_alloc_memory.
  *
  * @note Calling this function with NULL is safe (no effect).
  */
 void jx_free_memory(void *memory_ptr);
+
+#if defined(JX_USE_BAREMETAL) && !defined(JX_USE_HEAP_BAREMETAL) && !JX_ENABLE_SLAB_ALLOCATOR
+/**
+ * @brief Return the arena backing the static bare-metal pool.
+ *
+ * Allows callers to checkpoint the pool used by @ref jx_alloc_memory.
+ *
+ * @return Pool arena, or NULL when JsonX is not initialized.
+ */
+JX_ARENA *jx_get_arena(void);
 #endif
 
+#if defined(JX_USE_BAREMETAL) && !defined(JX_USE_HEAP_BAREMETAL)
+/**
+ * @brief Report usage and fragmentation counters of the static pool.
+ *
+ * With the slab allocator every field is maintained. The bump pool only
+ * reports the pool size and the carved offset.
+ *
+ * Internal fragmentation is `live_block_bytes - live_bytes`. Memory that is
+ * free but only reusable by its own size class is `free_list_bytes`.
+ *
+ * @param[out] stats Destination for the counters.
+ *
+ * @retval JX_SUCCESS Counters were written.
+ * @retval JX_ERROR   JsonX is not initialized or @p stats is NULL.
+ */
+JX_STATUS jx_get_allocator_stats(JX_ALLOCATOR_STATS *stats);
+#endif
+
+/**
+ * @brief Initialize a caller-owned bump arena over @p buffer.
+ *
+ * Arenas are independent of the global JsonX allocator and of @ref jx_init.
+ * A local arena must be used by one thread or context at a time; it takes no
+ * locks and performs no atomic operations. Give each thread or connection its
+ * own arena to allocate without contention.
+ *
+ * @param[out] arena  Arena instance to initialize.
+ * @param[in]  buffer Backing storage.
+ * @param[in]  size   Size of @p buffer in bytes.
+ *
+ * @retval JX_SUCCESS Arena is ready.
+ * @retval JX_ERROR   Invalid arguments.
+ */
+JX_STATUS jx_arena_init(JX_ARENA *arena, void *buffer, size_t size);
+
+#if JX_ENABLE_ATOMIC_ARENA
+/**
+ * @brief Initialize a bump arena that several threads may allocate from.
+ *
+ * Allocation uses a lock-free compare-and-swap on the arena offset.
+ * @ref jx_arena_reset must still only be called when no thread is
+ * allocating or using memory from the arena.
+ *
+ * @retval JX_SUCCESS Arena is ready.
+ * @retval JX_ERROR   Invalid arguments.
+ */
+JX_STATUS jx_arena_init_shared(JX_ARENA *arena, void *buffer, size_t size);
+#endif
+
+/**
+ * @brief Allocate @p size bytes from an arena.
+ *
+ * Allocations are rounded up to 4 bytes. Memory is reclaimed only by
+ * resetting the arena.
+ *
+ * @return Pointer to the allocated memory, or NULL if the arena is exhausted.
+ */
+void *jx_arena_alloc(JX_ARENA *arena, size_t size);
+
+/**
+ * @brief Release every allocation made from an arena.
+ *
+ * @param[in,out] arena Arena to reset. NULL is ignored.
+ */
+void jx_arena_reset(JX_ARENA *arena);
+
+/**
+ * @brief Return the number of bytes currently allocated from an arena.
+ */
+size_t jx_arena_used(const JX_ARENA *arena);
+
+/**
+ * @brief Record the current allocation position of an arena.
+ *
+ * Marks nest: take an outer mark for long-lived data, then inner marks for
+ * scratch work, and release inner scopes before outer ones. A mark of a
+ * shared arena can be read but not released.
+ *
+ * @return Checkpoint to pass to @ref jx_arena_release.
+ */
+JX_ARENA_MARK jx_arena_mark(const JX_ARENA *arena);
+
+/**
+ * @brief Roll an arena back to a checkpoint taken with @ref jx_arena_mark.
+ *
+ * Everything allocated after @p mark is released; earlier allocations stay
+ * valid. Releasing an outer mark also releases every inner scope, and a
+ * later release of such an inner mark has no effect.
+ *
+ * @note Has no effect on a shared arena, where other threads may hold memory
+ *       allocated after @p mark; use @ref jx_arena_reset once every thread
+ *       is done with the arena.
+ */
+void jx_arena_release(JX_ARENA *arena, JX_ARENA_MARK mark);
+
 /**
  * @brief Serialize a JsonX element tree into a JSON string.
  *
@@ -166,6 +276,36 @@ JX_STATUS jx_struct_to_json(JX_ELEMENT *element,
                             size_t buffer_size,
                             JX_FORMAT format);
 
+/**
+ * @brief Serialize a JsonX element tree through a fixed-size chunk buffer.
+ *
+ * Works like @ref jx_struct_to_json, but the output does not have to fit in
+ * one buffer. Whenever @p chunk fills up, its contents are handed to @p sink
+ * and the buffer is reused. The final partial chunk is flushed before the
+ * function returns. Chunks passed to @p sink are not NUL-terminated.
+ *
+ * This lets large documents be written straight to a socket, UART or file
+ * with constant memory.
+ *
+ * @param element        Pointer to the root `JX_ELEMENT` array.
+ * @param element_size   Number of elements in the @p element array.
+ * @param chunk          Caller-owned staging buffer.
+ * @param chunk_size     Size of @p chunk in bytes (at least 2).
+ * @param format         Output format (JX_FORMATTED or JX_MINIFIED).
+ * @param sink           Callback receiving each output chunk.
+ * @param sink_context   Opaque pointer passed to @p sink.
+ *
+ * @retval JX_SUCCESS    The whole document was delivered to @p sink.
+ * @retval JX_ERROR      Invalid arguments, mapping error, or @p sink aborted.
+ */
+JX_STATUS jx_struct_to_json_chunked(JX_ELEMENT *element,
+                                    size_t element_size,
+                                    char *chunk,
+                                    size_t chunk_size,
+                                    JX_FORMAT format,
+                                    JX_SINK_FN sink,
+                                    void *sink_context);
+
 /**
  * @brief Parse a JSON string into storage described by a JsonX element tree.
  *
@@ -185,6 +325,11 @@ JX_STATUS jx_struct_to_json(JX_ELEMENT *element,
  * @param buffer         Pointer to the input JSON string.
  * @param element        Pointer to the array of JX_ELEMENTs representing the structure.
  * @param element_size   Number of elements in the @p element array.
+ * @note @ref JX_MODE_TRUSTED skips control-character, leading-zero, literal,
+ *       number-syntax and trailing-content checks. Use it only for input
+ *       JsonX wrote itself; capacity, nesting, integer-range and terminator
+ *       checks still apply, but malformed input may be accepted.
+ *
  * @param mode           Parsing mode (e.g., JX_STRICT or JX_FLEXIBLE).
  *
  * @retval JX_SUCCESS    The structure was successfully parsed and filled.
@@ -209,6 +354,812 @@ JX_STATUS jx_json_to_struct(char *buffer,
  */
 size_t jx_get_last_error_offset(const char *buffer);
 
+/**
+ * @brief Parse JSON into a mapping using a caller-owned context.
+ *
+ * Behaves like @ref jx_json_to_struct but needs no @ref jx_init call, touches
+ * no library globals and never calls the allocator. Calls on different
+ * contexts may run concurrently as long as they do not share mappings or
+ * buffers.
+ *
+ * @param[in,out] context      Context defined with @ref JX_CONTEXT_INIT.
+ * @param[in]     buffer       NUL-terminated JSON input.
+ * @param[in,out] element      Mapping array.
+ * @param[in]     element_size Number of mapping entries.
+ * @param[in]     mode         Parse mode.
+ *
+ * @retval JX_SUCCESS The document was parsed into the mapping.
+ * @retval JX_ERROR   Invalid arguments or parse failure.
+ */
+JX_STATUS jx_context_json_to_struct(JX_CONTEXT *context,
+                                    char *buffer,
+                                    JX_ELEMENT *element,
+                                    size_t element_size,
+                                    JX_PARSE_MODE mode);
+
+/**
+ * @brief Parse one JSON document into several independent mappings in one pass.
+ *
+ * Each root member is parsed into every target mapping that has its key, so
+ * subsystems can keep separate mappings for their part of a shared document
+ * without each re-reading the whole text. Members no target knows are skipped
+ * once. Nested objects belong to the mapping entry that holds them.
+ *
+ * Every target gets its own `status`. A value a mapping cannot take (wrong
+ * kind in strict mode, too long, too many items) and, in strict mode, a
+ * missing member fail only that mapping; it receives no further values. A
+ * syntax error fails every target. The error position is the first failing
+ * value, or the syntax error.
+ *
+ * @param[in,out] context      Caller-owned context receiving the error position.
+ * @param[in]     buffer       NUL-terminated JSON input.
+ * @param[in,out] targets      Mappings to fill; `status` is set for each.
+ * @param[in]     target_count Number of targets.
+ * @param[in]     mode         Parse mode, shared by all targets.
+ *
+ * @retval JX_SUCCESS Every target was filled.
+ * @retval JX_ERROR   Invalid arguments or at least one target failed.
+ */
+JX_STATUS jx_context_json_to_struct_fanout(JX_CONTEXT *context,
+                                           char *buffer,
+                                           JX_FANOUT_TARGET *targets,
+                                           size_t target_count,
+                                           JX_PARSE_MODE mode);
+
+/**
+ * @brief Parse JSON into a mapping unless it repeats the last applied document.
+ *
+ * Hashes the NUL-terminated @p buffer with @ref jx_hash. When the hash equals
+ * the one stored in @p applied, the parse is skipped and the mapping, including
+ * element status, is left as the previous call set it. Otherwise behaves like
+ * @ref jx_context_json_to_struct and records the hash after a successful parse.
+ * Two different documents with the same 64-bit hash are treated as unchanged.
+ *
+ * @param[in,out] context      Caller-owned context receiving the error position.
+ * @param[in,out] applied      Hash of the last document applied to this mapping.
+ * @param[in]     buffer       NUL-terminated JSON input.
+ * @param[in,out] element      Mapping to fill.
+ * @param[in]     element_size Number of mapping entries.
+ * @param[in]     mode         Parse mode.
+ * @param[out]    changed      Optional; true when the document was parsed.
+ *
+ * @retval JX_SUCCESS The document was applied or matched the last one.
+ * @retval JX_ERROR   Invalid arguments or parse failure.
+ */
+JX_STATUS jx_context_json_to_struct_if_changed(JX_CONTEXT *context,
+                                               JX_APPLIED *applied,
+                                               char *buffer,
+                                               JX_ELEMENT *element,
+                                               size_t element_size,
+                                               JX_PARSE_MODE mode,
+                                               bool *changed);
+
+/**
+ * @brief Prepare a shape cache over caller-owned buffers.
+ *
+ * The skeleton needs room for every document byte outside values: keys,
+ * punctuation, whitespace and skipped members. Each mapped value, skipped
+ * member, array item and closed container takes one slot.
+ *
+ * @param[out] shape         Shape to initialize; it starts empty.
+ * @param[in]  skeleton      Skeleton storage.
+ * @param[in]  skeleton_size Bytes available in @p skeleton.
+ * @param[in]  slots         Slot storage.
+ * @param[in]  slot_capacity Entries available in @p slots.
+ *
+ * @retval JX_SUCCESS The shape is ready.
+ * @retval JX_ERROR   Invalid arguments.
+ */
+JX_STATUS jx_shape_init(JX_SHAPE *shape,
+                        char *skeleton,
+                        size_t skeleton_size,
+                        JX_SHAPE_SLOT *slots,
+                        size_t slot_capacity);
+
+/**
+ * @brief Forget the recorded layout, e.g. after rebinding the mapping.
+ *
+ * @param[in,out] shape Shape to clear; the hit counters are kept.
+ */
+void jx_shape_reset(JX_SHAPE *shape);
+
+/**
+ * @brief Parse JSON into a mapping through a shape cache.
+ *
+ * When @p shape holds the layout of an earlier document parsed into the same
+ * mapping with the same mode, the bytes between values are compared with the
+ * recorded skeleton using `memcmp()` and each value is converted straight
+ * into its recorded target, without key lookup. Results, including element
+ * status, match @ref jx_context_json_to_struct. Any difference in keys,
+ * order or whitespace, or a container where a scalar was recorded, falls back
+ * to a full parse, which records the new layout. A scalar of another kind in
+ * a recorded value slot keeps the layout and goes through the usual
+ * type-mismatch handling: relaxed mode replays on and leaves the member
+ * unmarked, strict mode fails as a full parse would. A layout that does not
+ * fit the shape buffers is parsed in full every time.
+ *
+ * Value targets are recorded as addresses. After rebinding any `value_p` in
+ * the mapping, call @ref jx_shape_reset, or the replay keeps writing to the
+ * old storage.
+ *
+ * @param[in,out] context      Caller-owned context receiving the error position.
+ * @param[in,out] shape        Shape cache for this mapping.
+ * @param[in]     buffer       NUL-terminated JSON input.
+ * @param[in,out] element      Mapping to fill.
+ * @param[in]     element_size Number of mapping entries.
+ * @param[in]     mode         Parse mode.
+ *
+ * @retval JX_SUCCESS The document was applied.
+ * @retval JX_ERROR   Invalid arguments or parse failure.
+ */
+JX_STATUS jx_context_json_to_struct_shaped(JX_CONTEXT *context,
+                                           JX_SHAPE *shape,
+                                           char *buffer,
+                                           JX_ELEMENT *element,
+                                           size_t element_size,
+                                           JX_PARSE_MODE mode);
+
+/**
+ * @brief Serialize a mapping using a caller-owned context.
+ *
+ * Behaves like @ref jx_struct_to_json without requiring @ref jx_init.
+ *
+ * @retval JX_SUCCESS JSON was written to @p buffer.
+ * @retval JX_ERROR   Invalid arguments or the buffer is too small.
+ */
+JX_STATUS jx_context_struct_to_json(JX_CONTEXT *context,
+                                    JX_ELEMENT *element,
+                                    size_t element_size,
+                                    char *buffer,
+                                    size_t buffer_size,
+                                    JX_FORMAT format);
+
+/**
+ * @brief Serialize a mapping to a sink using a caller-owned context.
+ *
+ * Behaves like @ref jx_struct_to_json_chunked without requiring @ref jx_init.
+ *
+ * @retval JX_SUCCESS The whole document was delivered to @p sink.
+ * @retval JX_ERROR   Invalid arguments, mapping error, or sink failure.
+ */
+JX_STATUS jx_context_struct_to_json_chunked(JX_CONTEXT *context,
+                                            JX_ELEMENT *element,
+                                            size_t element_size,
+                                            char *chunk,
+                                            size_t chunk_size,
+                                            JX_FORMAT format,
+                                            JX_SINK_FN sink,
+                                            void *sink_context);
+
+/**
+ * @brief Serialize one document composed from several mappings.
+ *
+ * Writes a single root object straight from the caller's mappings, so
+ * subsystem mappings need not be copied into a combined root array. A part
+ * with a `key` becomes a member holding its mapping as an object; a part
+ * without one adds its members to the root. Members are written in part
+ * order. Keys are not checked for duplicates across parts.
+ *
+ * @param[in,out] context    Caller-owned context.
+ * @param[in]     parts      Parts in document order.
+ * @param[in]     part_count Number of parts.
+ * @param[out]    buffer     Output buffer.
+ * @param[in]     buffer_size Size of @p buffer in bytes.
+ * @param[in]     format     Output formatting.
+ *
+ * @retval JX_SUCCESS JSON was written to @p buffer.
+ * @retval JX_ERROR   Invalid arguments, mapping error, or the buffer is too small.
+ */
+JX_STATUS jx_context_struct_to_json_parts(JX_CONTEXT *context,
+                                          const JX_DOCUMENT_PART *parts,
+                                          size_t part_count,
+                                          char *buffer,
+                                          size_t buffer_size,
+                                          JX_FORMAT format);
+
+/**
+ * @brief Serialize one document composed from several mappings to a sink.
+ *
+ * Behaves like @ref jx_context_struct_to_json_parts, delivering the output in
+ * chunks like @ref jx_context_struct_to_json_chunked.
+ *
+ * @retval JX_SUCCESS The whole document was delivered to @p sink.
+ * @retval JX_ERROR   Invalid arguments, mapping error, or sink failure.
+ */
+JX_STATUS jx_context_struct_to_json_parts_chunked(JX_CONTEXT *context,
+                                                  const JX_DOCUMENT_PART *parts,
+                                                  size_t part_count,
+                                                  char *chunk,
+                                                  size_t chunk_size,
+                                                  JX_FORMAT format,
+                                                  JX_SINK_FN sink,
+                                                  void *sink_context);
+
+/**
+ * @brief Return the offset of the last parser error recorded in @p context.
+ *
+ * @return Byte offset from @p buffer, or `(size_t)-1` when unknown.
+ */
+size_t jx_context_get_last_error_offset(const JX_CONTEXT *context, const char *buffer);
+
+/**
+ * @brief Serialize one range of a record array and the text around it.
+ *
+ * Writes records `[first, first + count)` of @p records_element, which must
+ * be a @ref JX_RECORD_ARRAY entry inside the mapping. The range starting at
+ * record 0 also carries the document text before the records, and the range
+ * ending at the last record carries the text after them. Concatenating the
+ * outputs of consecutive ranges that cover the whole array in order yields
+ * exactly the output of @ref jx_struct_to_json, so ranges can be formatted
+ * on different threads and joined with a single copy or `writev()`.
+ *
+ * Needs no @ref jx_init call and touches no library state, so calls may run
+ * concurrently on the same read-only mapping.
+ *
+ * @param[in]  element         Root mapping array.
+ * @param[in]  element_size    Number of root mapping entries.
+ * @param[in]  records_element Record array entry to split.
+ * @param[in]  first           First record of the range.
+ * @param[in]  count           Number of records in the range.
+ * @param[out] buffer          Output buffer for this range.
+ * @param[in]  buffer_size     Size of @p buffer in bytes.
+ * @param[in]  format          Output formatting.
+ * @param[out] written         Optional length of the range output.
+ *
+ * @retval JX_SUCCESS The range was written to @p buffer.
+ * @retval JX_ERROR   Invalid arguments or range, or the buffer is too small.
+ */
+JX_STATUS jx_struct_to_json_range(JX_ELEMENT *element,
+                                  size_t element_size,
+                                  const JX_ELEMENT *records_element,
+                                  size_t first,
+                                  size_t count,
+                                  char *buffer,
+                                  size_t buffer_size,
+                                  JX_FORMAT format,
+                                  size_t *written);
+
+/**
+ * @brief Locate the items of a top-level JSON array.
+ *
+ * Scans @p json, which must hold one array such as a bulk upload of records,
+ * and stores the offset and length of each item in @p items. The scan tracks
+ * strings and nesting only; items are validated when they are parsed.
+ * Pass NULL @p items to count the items without storing them.
+ *
+ * @param[in]  json     NUL-terminated document.
+ * @param[out] items    Item positions, or NULL to count only.
+ * @param[in]  capacity Number of entries available in @p items.
+ * @param[out] count    Number of items in the array.
+ *
+ * @retval JX_SUCCESS All items were located.
+ * @retval JX_ERROR   Invalid arguments, malformed array, or more items than
+ *                    @p capacity.
+ */
+JX_STATUS jx_array_split(const char *json, JX_SPAN *items, size_t capacity, size_t *count);
+
+/**
+ * @brief Parse located array items into consecutive records.
+ *
+ * Parses objects `items[first]` to `items[first + count - 1]` into the
+ * records with the same indices, through the template of @p records_element.
+ * The record array's `count` is left unchanged; set it to the item count once
+ * every range succeeded.
+ *
+ * Needs no @ref jx_init call. Different ranges may be parsed concurrently if
+ * every worker passes its own @p context and its own copy of
+ * @p records_element and its template, since parsing updates mapping status.
+ *
+ * @param[in,out] context         Caller-owned context receiving the error position.
+ * @param[in]     json            Document passed to @ref jx_array_split.
+ * @param[in]     items           Item positions from @ref jx_array_split.
+ * @param[in]     first           First item to parse.
+ * @param[in]     count           Number of items to parse.
+ * @param[in,out] records_element @ref JX_RECORD_ARRAY entry to fill.
+ * @param[in]     mode            Parse mode applied to every item.
+ *
+ * @retval JX_SUCCESS Every item was parsed.
+ * @retval JX_ERROR   Invalid arguments, a range beyond the record capacity, or
+ *                    an invalid item. @ref jx_context_get_last_error_offset
+ *                    with @p json gives the document offset of the error.
+ */
+JX_STATUS jx_records_parse_items(JX_CONTEXT *context,
+                                 const char *json,
+                                 const JX_SPAN *items,
+                                 size_t first,
+                                 size_t count,
+                                 JX_ELEMENT *records_element,
+                                 JX_PARSE_MODE mode);
+
+/**
+ * @brief Check that a buffer is well-formed UTF-8.
+ *
+ * Rejects stray continuation bytes, truncated and overlong sequences, UTF-16
+ * surrogates and values above U+10FFFF. ASCII runs are checked eight bytes
+ * at a time. The parser applies the same rules to JSON strings, so this is
+ * only needed for text that does not pass through @ref jx_json_to_struct.
+ *
+ * @param[in] data   Bytes to check; may contain NUL bytes.
+ * @param[in] length Number of bytes.
+ *
+ * @return true when all @p length bytes are well-formed UTF-8.
+ */
+bool jx_utf8_validate(const char *data, size_t length);
+
+/**
+ * @brief Check that a buffer holds one well-formed JSON document.
+ *
+ * Applies the strict parser's grammar, string and UTF-8 rules without a
+ * mapping. The top-level value may be any JSON value, nested no deeper than
+ * @ref JX_VALIDATE_MAX_DEPTH, with only whitespace around it. Since nothing
+ * is decoded, a \u0000 escape is accepted. Never reads past @p length bytes,
+ * so @p json needs no terminator. Needs no @ref jx_init call and touches no
+ * library state.
+ *
+ * @param[in] json   Document text.
+ * @param[in] length Document length in bytes.
+ *
+ * @retval JX_SUCCESS The document is valid.
+ * @retval JX_ERROR   Invalid arguments or an invalid document.
+ */
+JX_STATUS jx_validate(const char *json, size_t length);
+
+/**
+ * @brief Validate a document and remove its insignificant whitespace.
+ *
+ * Accepts the same documents as @ref jx_validate and writes them without
+ * whitespace (or comments) outside strings, NUL-terminated. @p out may be
+ * @p json itself to minify in place. On failure @p out holds unspecified
+ * text.
+ *
+ * @param[in]  json    Document text.
+ * @param[in]  length  Document length in bytes.
+ * @param[out] out     Output buffer of at least @p length + 1 bytes.
+ * @param[out] written Optional minified length, without the terminator.
+ *
+ * @retval JX_SUCCESS The document was valid and has been minified.
+ * @retval JX_ERROR   Invalid arguments or an invalid document.
+ */
+JX_STATUS jx_minify(const char *json, size_t length, char *out, size_t *written);
+
+/**
+ * @brief Compute a fast 64-bit hash of a buffer.
+ *
+ * Not cryptographic, and values differ between byte orders; meant for
+ * detecting repeated input on one device.
+ *
+ * @param[in] data   Bytes to hash.
+ * @param[in] length Number of bytes.
+ *
+ * @return Hash value.
+ */
+uint64_t jx_hash(const void *data, size_t length);
+
+/**
+ * @brief Check whether a document would change any mapped value.
+ *
+ * Runs a relaxed parse that compares each mapped member present in @p json
+ * with the current value instead of storing it. Values, array lengths,
+ * record counts and element status are left untouched, so the mapping is only
+ * read. Members that a relaxed parse would ignore do not count as changes.
+ * A string mapped to a @ref JX_STRING_STREAM or an array mapped to a
+ * @ref JX_ITEM_STREAM keeps no copy to compare against, so its presence
+ * always counts as a change. Needs no @ref jx_init call.
+ *
+ * @param[in]  json         NUL-terminated JSON document.
+ * @param[in]  element      Mapping holding the current values.
+ * @param[in]  element_size Number of mapping entries.
+ * @param[out] equal        True when applying @p json would change nothing.
+ *
+ * @retval JX_SUCCESS The comparison ran; see @p equal.
+ * @retval JX_ERROR   Invalid arguments or a document a relaxed parse rejects.
+ */
+JX_STATUS jx_json_equals_struct(const char *json, JX_ELEMENT *element, size_t element_size, bool *equal);
+
+/**
+ * @brief Copy only the members on selected paths into a new document.
+ *
+ * Each path names object members from the top level down, joined by dots,
+ * such as `"network.rssi"`. A member whose path ends at it is copied with its
+ * raw value bytes; a member on the way to a deeper path is rebuilt with only
+ * its selected members, and dropped when none exist. Paths do not descend
+ * into arrays. Member names are compared as written in the input, so names
+ * with escapes or dots need the same spelling in the path.
+ *
+ * Everything else is skipped but still validated, in one pass and without a
+ * value tree. Nesting is bounded by @ref JX_VALIDATE_MAX_DEPTH, as in
+ * @ref jx_validate, not by the mapping limit. The output has no whitespace
+ * outside copied values. Needs no @ref jx_init call and touches no library
+ * state.
+ *
+ * @param[in]  json        NUL-terminated input document with an object at the top.
+ * @param[in]  paths       Paths to keep.
+ * @param[in]  path_count  Number of paths.
+ * @param[out] buffer      Output buffer, NUL-terminated on success.
+ * @param[in]  buffer_size Output buffer size in bytes.
+ * @param[out] written     Optional output length, without the terminator.
+ *
+ * @retval JX_SUCCESS The projection was written.
+ * @retval JX_ERROR   Invalid arguments or paths, an invalid document, or a
+ *                    buffer that is too small.
+ */
+JX_STATUS jx_project(const char *json,
+                     const char *const *paths,
+                     size_t path_count,
+                     char *buffer,
+                     size_t buffer_size,
+                     size_t *written);
+
+/**
+ * @brief Prepare a checksum or digest stage.
+ *
+ * Pass the digest as the context of @ref jx_digest_sink to digest output
+ * while it is serialized, or attach it to a stream with
+ * @ref jx_stream_set_digest to digest input while it is received. CRC-32C
+ * uses the SSE4.2 or ARMv8 CRC instructions when the compiler targets them.
+ *
+ * @param[out] digest       Digest state to initialize.
+ * @param[in]  kind         Checksum or digest to compute.
+ * @param[in]  key          HMAC key; ignored for other kinds.
+ * @param[in]  key_length   HMAC key length in bytes.
+ * @param[in]  next         Optional sink that receives the data afterwards.
+ * @param[in]  next_context Context passed to @p next.
+ *
+ * @retval JX_SUCCESS The digest is ready.
+ * @retval JX_ERROR   Invalid arguments.
+ */
+JX_STATUS jx_digest_init(JX_DIGEST *digest,
+                         JX_DIGEST_KIND kind,
+                         const uint8_t *key,
+                         size_t key_length,
+                         JX_SINK_FN next,
+                         void *next_context);
+
+/**
+ * @brief Add bytes to a digest.
+ */
+void jx_digest_update(JX_DIGEST *digest, const void *data, size_t length);
+
+/**
+ * @brief Sink stage that digests each chunk and forwards it.
+ *
+ * Matches @ref JX_SINK_FN with a `JX_DIGEST` as @p context, for use with
+ * @ref jx_struct_to_json_chunked. Chunks are passed to the digest's next sink
+ * when one is set, and its result is returned.
+ */
+bool jx_digest_sink(void *context, const char *data, size_t length);
+
+/**
+ * @brief Finish a digest and write its value.
+ *
+ * CRC-32C is written most significant byte first. The digest must be
+ * initialized again before further use.
+ *
+ * @param[in,out] digest   Digest state.
+ * @param[out]    out      Output bytes.
+ * @param[in]     out_size Size of @p out; at least the digest length.
+ *
+ * @return Digest length in bytes (4 or 32), or 0 when @p out is too small.
+ */
+size_t jx_digest_final(JX_DIGEST *digest, uint8_t *out, size_t out_size);
+
+/**
+ * @brief Compute or continue a CRC-32C in one call.
+ *
+ * @param crc    0 to start, or the result of a previous call to continue.
+ * @param data   Bytes to add.
+ * @param length Number of bytes.
+ *
+ * @return CRC-32C of all bytes so far.
+ */
+uint32_t jx_crc32c(uint32_t crc, const void *data, size_t length);
+
+/**
+ * @brief Serialize many independent mappings in one call.
+ *
+ * Formats every job into its own buffer and stores the result in the job's
+ * `status`; a failing job does not stop the others. Needs no @ref jx_init
+ * call and touches no library state, so any number of threads may run
+ * batches at the same time without a lock.
+ *
+ * @param[in,out] jobs      Jobs to format.
+ * @param[in]     job_count Number of jobs.
+ *
+ * @retval JX_SUCCESS Every job succeeded.
+ * @retval JX_ERROR   Invalid arguments or at least one job failed.
+ */
+JX_STATUS jx_struct_to_json_batch(JX_BATCH_JOB *jobs, size_t job_count);
+
+#if JX_ENABLE_PARALLEL_WRITE
+/**
+ * @brief Split @p total records into ranges of @p range_size records.
+ *
+ * An empty array still yields one empty range carrying the whole document.
+ *
+ * @retval JX_SUCCESS The job is ready to be claimed.
+ * @retval JX_ERROR   Invalid arguments.
+ */
+JX_STATUS jx_range_job_init(JX_RANGE_JOB *job, size_t total, size_t range_size);
+
+/**
+ * @brief Return the number of ranges in a job.
+ */
+size_t jx_range_job_count(const JX_RANGE_JOB *job);
+
+/**
+ * @brief Claim the next unprocessed range. Lock-free; call from any worker.
+ *
+ * @param[in,out] job   Shared job.
+ * @param[out]    index Range index, which is its position in the output.
+ * @param[out]    first First record of the range.
+ * @param[out]    count Number of records in the range.
+ *
+ * @return true when a range was claimed, false when all ranges are taken.
+ */
+bool jx_range_job_claim(JX_RANGE_JOB *job, size_t *index, size_t *first, size_t *count);
+
+/**
+ * @brief Format batch jobs claimed from a shared range job until none are left.
+ *
+ * Call from every worker of a caller-owned thread pool with a @p job
+ * initialized over the number of @p jobs. Each batch job is formatted by
+ * exactly one worker; per-job results are stored in `status`.
+ *
+ * @param[in,out] job  Range job shared by the workers.
+ * @param[in,out] jobs Batch jobs covered by @p job.
+ *
+ * @retval JX_SUCCESS Every job formatted by this worker succeeded.
+ * @retval JX_ERROR   Invalid arguments or a job formatted here failed.
+ */
+JX_STATUS jx_struct_to_json_batch_shared(JX_RANGE_JOB *job, JX_BATCH_JOB *jobs);
+#endif
+
+#if JX_ENABLE_SEQLOCK
+/**
+ * @brief Mark the start of an update to a structure guarded by @p sequence.
+ *
+ * Call from the single writer before changing mapped fields. Never blocks.
+ */
+void jx_seqlock_write_begin(JX_SEQUENCE *sequence);
+
+/**
+ * @brief Mark the end of an update started with @ref jx_seqlock_write_begin.
+ */
+void jx_seqlock_write_end(JX_SEQUENCE *sequence);
+
+/**
+ * @brief Return the staging size needed to snapshot a mapping.
+ *
+ * @return Bytes required by @ref jx_struct_to_json_consistent, or 0 when the
+ *         mapping is invalid.
+ */
+size_t jx_struct_snapshot_size(const JX_ELEMENT *element, size_t element_size);
+
+/**
+ * @brief Serialize a structure that another task updates concurrently.
+ *
+ * Copies every mapped scalar into @p staging while @p sequence is even and
+ * unchanged, retrying up to @ref JX_SEQLOCK_RETRY_LIMIT times, then formats
+ * the copy. The output always reflects one consistent state and the writer
+ * never waits. Needs no @ref jx_init call.
+ *
+ * Array and object lengths are taken from the mapping, not from the guarded
+ * structure.
+ *
+ * @param[in]  sequence     Counter the writer updates around each change.
+ * @param[in]  element      Mapping array.
+ * @param[in]  element_size Number of mapping entries.
+ * @param[out] staging      Snapshot area, aligned for `uint64_t`.
+ * @param[in]  staging_size Size of @p staging, see @ref jx_struct_snapshot_size.
+ * @param[out] buffer       Output buffer.
+ * @param[in]  buffer_size  Size of @p buffer in bytes.
+ * @param[in]  format       Output formatting.
+ *
+ * @retval JX_SUCCESS Consistent JSON was written to @p buffer.
+ * @retval JX_ERROR   Invalid arguments, staging or buffer too small, or no
+ *                    stable snapshot within the retry limit.
+ */
+JX_STATUS jx_struct_to_json_consistent(const JX_SEQUENCE *sequence,
+                                       JX_ELEMENT *element,
+                                       size_t element_size,
+                                       void *staging,
+                                       size_t staging_size,
+                                       char *buffer,
+                                       size_t buffer_size,
+                                       JX_FORMAT format);
+#endif
+
+#if JX_ENABLE_DOUBLE_BUFFER
+/**
+ * @brief Prepare a double buffer over two copies of one structure.
+ *
+ * @p element must be bound to @p primary. The secondary copy receives the
+ * current contents of the primary, which becomes the published copy.
+ *
+ * Array lengths and element status are kept in the mapping, not in either
+ * copy, so mappings that contain `JX_ARRAY` or `JX_RECORD_ARRAY` entries at
+ * any depth are rejected. Element status describes the last parse attempt,
+ * not the published copy.
+ *
+ * @param[out] buffer       Double buffer state.
+ * @param[in]  primary      Structure the mapping is bound to.
+ * @param[in]  secondary    Second structure of the same type.
+ * @param[in]  slot_size    Size of each structure in bytes.
+ * @param[in]  element      Mapping bound to @p primary.
+ * @param[in]  element_size Number of mapping entries.
+ *
+ * @retval JX_SUCCESS The double buffer is ready.
+ * @retval JX_ERROR   Invalid arguments, or the mapping contains an array or
+ *                    record array.
+ */
+JX_STATUS jx_double_buffer_init(JX_DOUBLE_BUFFER *buffer,
+                                void *primary,
+                                void *secondary,
+                                size_t slot_size,
+                                JX_ELEMENT *element,
+                                size_t element_size);
+
+/**
+ * @brief Parse into the inactive copy and publish it on success.
+ *
+ * The inactive copy is first refreshed from the published one, so fields
+ * absent from the document keep their current values. On failure nothing is
+ * published and readers keep the previous copy. Only one thread may call this
+ * function for a given double buffer at a time.
+ *
+ * @param[in,out] buffer Double buffer state.
+ * @param[in]     json   NUL-terminated JSON input.
+ * @param[in]     mode   Parse mode.
+ *
+ * @retval JX_SUCCESS The new copy was published.
+ * @retval JX_ERROR   Invalid arguments, parse failure, or a reader still
+ *                    holds the inactive copy; retry later in that case.
+ */
+JX_STATUS jx_double_buffer_parse(JX_DOUBLE_BUFFER *buffer, char *json, JX_PARSE_MODE mode);
+
+/**
+ * @brief Take the published copy for reading.
+ *
+ * Never blocks. The returned copy stays unchanged until it is returned with
+ * @ref jx_double_buffer_release.
+ *
+ * @return Pointer to the published structure, or NULL on invalid arguments.
+ */
+const void *jx_double_buffer_acquire(JX_DOUBLE_BUFFER *buffer);
+
+/**
+ * @brief Return a copy taken with @ref jx_double_buffer_acquire.
+ */
+void jx_double_buffer_release(JX_DOUBLE_BUFFER *buffer, const void *slot);
+#endif
+
+/**
+ * @brief Prepare an incremental input stream over a caller-owned buffer.
+ *
+ * A stream collects one JSON document from arbitrary byte slices. The end of
+ * the root object or array is detected while bytes are copied in, so the
+ * document is never rescanned to find out whether it is complete.
+ *
+ * @param[out] stream Stream state to initialize.
+ * @param[in]  buffer Storage for the document and its NUL terminator.
+ * @param[in]  size   Size of @p buffer in bytes (at least 2).
+ *
+ * @retval JX_SUCCESS Stream is ready for @ref jx_stream_feed.
+ * @retval JX_ERROR   Invalid arguments.
+ */
+JX_STATUS jx_stream_init(JX_STREAM *stream, char *buffer, size_t size);
+
+/**
+ * @brief Discard any partially received document and restart framing.
+ *
+ * @param[in,out] stream Stream to reset.
+ */
+void jx_stream_reset(JX_STREAM *stream);
+
+/**
+ * @brief Append received bytes to an incremental input stream.
+ *
+ * Bytes are consumed until the root value closes or @p data is exhausted.
+ * Bytes following a complete document are left unconsumed so pipelined
+ * documents can be fed again after @ref jx_stream_parse.
+ *
+ * @param[in,out] stream   Stream state.
+ * @param[in]     data     Received bytes (need not be NUL-terminated).
+ * @param[in]     length   Number of bytes in @p data.
+ * @param[out]    consumed Optional number of bytes taken from @p data.
+ *
+ * @retval JX_SUCCESS More input is needed, or the document is complete.
+ * @retval JX_ERROR   Buffer overflow, embedded NUL, or non-container root.
+ */
+JX_STATUS jx_stream_feed(JX_STREAM *stream, const char *data, size_t length, size_t *consumed);
+
+/**
+ * @brief Check whether a stream holds a complete root value.
+ *
+ * @param[in] stream Stream state.
+ *
+ * @return true when @ref jx_stream_parse can be called.
+ */
+bool jx_stream_is_complete(const JX_STREAM *stream);
+
+/**
+ * @brief Parse a completed stream document and rearm the stream.
+ *
+ * Behaves like @ref jx_json_to_struct on the collected buffer. The stream is
+ * reset afterwards; the buffer contents stay untouched until the next feed,
+ * so @ref jx_get_last_error_offset can still be used on failure.
+ *
+ * @retval JX_SUCCESS The document was parsed into the mapping.
+ * @retval JX_ERROR   The document is incomplete or failed to parse.
+ */
+JX_STATUS jx_stream_parse(JX_STREAM *stream, JX_ELEMENT *element, size_t element_size, JX_PARSE_MODE mode);
+
+/**
+ * @brief Digest input bytes as the stream accepts them.
+ *
+ * Every byte @ref jx_stream_feed consumes is added to @p digest while it is
+ * still in cache, so the check needs no second pass over the document.
+ * The digest keeps running across documents until the caller finishes and
+ * reinitializes it.
+ *
+ * @param[in,out] stream Stream state.
+ * @param[in]     digest Digest to update, or NULL to stop digesting.
+ */
+void jx_stream_set_digest(JX_STREAM *stream, JX_DIGEST *digest);
+
+/**
+ * @brief Prepare a chunked transfer-coding decoder in front of a stream.
+ *
+ * Lets a `Transfer-Encoding: chunked` request body be fed as it arrives from
+ * the socket, without de-chunking it into a separate copy first.
+ *
+ * @param[out] chunked Decoder state to initialize.
+ * @param[in]  stream  Initialized stream receiving the payload.
+ *
+ * @retval JX_SUCCESS Decoder is ready for @ref jx_chunked_feed.
+ * @retval JX_ERROR   Invalid arguments.
+ */
+JX_STATUS jx_chunked_init(JX_CHUNKED *chunked, JX_STREAM *stream);
+
+/**
+ * @brief Restart decoding at a chunk-size line, e.g. for the next request.
+ *
+ * The stream is left as it is.
+ *
+ * @param[in,out] chunked Decoder to reset.
+ */
+void jx_chunked_reset(JX_CHUNKED *chunked);
+
+/**
+ * @brief Decode received body bytes into the stream.
+ *
+ * Payload runs are copied into the stream buffer, and the stream's digest is
+ * updated with them. The body is one document. Its end is the last chunk, so
+ * the JSON is not framed while it arrives. The stream becomes complete once
+ * the last chunk and its trailers are in, and @ref jx_stream_parse parses it.
+ * Bytes after the body belong to the next request and are left unconsumed.
+ *
+ * @param[in,out] chunked  Decoder state.
+ * @param[in]     data     Received body bytes.
+ * @param[in]     length   Number of bytes in @p data.
+ * @param[out]    consumed Optional number of bytes taken from @p data.
+ *
+ * @retval JX_SUCCESS More input is needed, or the body ended.
+ * @retval JX_ERROR   Malformed chunk framing, payload larger than the stream
+ *                    buffer or holding a NUL byte, or an unparsed document
+ *                    still in the stream.
+ */
+JX_STATUS jx_chunked_feed(JX_CHUNKED *chunked, const char *data, size_t length, size_t *consumed);
+
+/**
+ * @brief Check whether the last chunk and its trailers were received.
+ *
+ * @param[in] chunked Decoder state.
+ *
+ * @return true once the whole body has been decoded.
+ */
+bool jx_chunked_is_finished(const JX_CHUNKED *chunked);
+
 #ifdef __cplusplus
 }
 #endif
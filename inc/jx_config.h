@@ -94,6 +94,106 @@
 #define JX_ENABLE_JSON_COMMENTS 0
 #endif
 
+/**
+ * @def JX_ENABLE_ATOMIC_ARENA
+ *
+ * @brief Enables lock-free shared arenas.
+ *
+ * When set to `1`, arenas created with `jx_arena_init_shared()` bump their
+ * offset with an atomic compare-and-swap so several threads can allocate from
+ * one pool. The static bare-metal pool is also created shared. Requires a
+ * compiler with GCC-style `__atomic` builtins (GCC, Clang, ARM GCC).
+ * Per-thread arenas created with `jx_arena_init()` never pay for atomics.
+ */
+#ifndef JX_ENABLE_ATOMIC_ARENA
+#define JX_ENABLE_ATOMIC_ARENA 0
+#endif
+
+/**
+ * @def JX_ENABLE_DOUBLE_BUFFER
+ *
+ * @brief Enables double-buffered parsing with atomic publication.
+ *
+ * When set to `1`, `JX_DOUBLE_BUFFER` parses into an inactive copy of a
+ * mapped structure and publishes it only after a successful parse. Readers
+ * take the published copy without locks and never observe a partial update.
+ * Requires a compiler with GCC-style `__atomic` builtins.
+ */
+#ifndef JX_ENABLE_DOUBLE_BUFFER
+#define JX_ENABLE_DOUBLE_BUFFER 0
+#endif
+
+/**
+ * @def JX_ENABLE_SEQLOCK
+ *
+ * @brief Enables seqlock-consistent serialization of live structures.
+ *
+ * When set to `1`, `jx_struct_to_json_consistent()` copies the mapped fields
+ * into a staging area under a caller-owned `JX_SEQUENCE`, retries when a
+ * writer was active, and formats from the copy. Writers only bump the
+ * sequence and never wait. Requires GCC-style `__atomic` builtins.
+ */
+#ifndef JX_ENABLE_SEQLOCK
+#define JX_ENABLE_SEQLOCK 0
+#endif
+
+/**
+ * @def JX_SEQLOCK_RETRY_LIMIT
+ *
+ * @brief Snapshot attempts before `jx_struct_to_json_consistent()` gives up.
+ */
+#ifndef JX_SEQLOCK_RETRY_LIMIT
+#define JX_SEQLOCK_RETRY_LIMIT   16
+#endif
+
+/**
+ * @def JX_ENABLE_PARALLEL_WRITE
+ *
+ * @brief Enables `JX_RANGE_JOB` for serializing record arrays on several
+ * threads.
+ *
+ * When set to `1`, worker threads claim record ranges from a shared job with
+ * an atomic counter and format them with `jx_struct_to_json_range()`.
+ * Requires a compiler with GCC-style `__atomic` builtins.
+ */
+#ifndef JX_ENABLE_PARALLEL_WRITE
+#define JX_ENABLE_PARALLEL_WRITE 0
+#endif
+
+/**
+ * @def JX_ENABLE_SLAB_ALLOCATOR
+ *
+ * @brief Selects a size-class slab allocator for the static bare-metal pool.
+ *
+ * The default static pool is a bump arena: allocation is a pointer bump and
+ * memory only returns on reset. When set to `1`, the same user buffer is
+ * managed as power-of-two size classes with per-class free lists, so
+ * `jx_free_memory()` returns blocks for reuse in O(1). Use this for
+ * long-running firmware that keeps allocations across calls. The slab pool
+ * is not shared between threads even when `JX_ENABLE_ATOMIC_ARENA` is set.
+ */
+#ifndef JX_ENABLE_SLAB_ALLOCATOR
+#define JX_ENABLE_SLAB_ALLOCATOR 0
+#endif
+
+/**
+ * @def JX_SLAB_MIN_BLOCK_SIZE
+ * @def JX_SLAB_CLASS_COUNT
+ *
+ * @brief Slab size classes: JX_SLAB_MIN_BLOCK_SIZE doubled
+ * JX_SLAB_CLASS_COUNT - 1 times (16..512 bytes by default).
+ *
+ * Requests larger than the largest class are carved directly from the pool
+ * and can only be returned while they are the most recent carve.
+ */
+#ifndef JX_SLAB_MIN_BLOCK_SIZE
+#define JX_SLAB_MIN_BLOCK_SIZE   16
+#endif
+
+#ifndef JX_SLAB_CLASS_COUNT
+#define JX_SLAB_CLASS_COUNT      6
+#endif
+
 /**
  * @def JX_MAX_NESTING_LEVEL
  *
@@ -103,6 +203,40 @@
 #define JX_MAX_NESTING_LEVEL     3
 #endif
 
+/**
+ * @def JX_VALIDATE_MAX_DEPTH
+ *
+ * @brief Maximum nesting level accepted by jx_validate() and jx_minify().
+ *
+ * Validation needs no mapping, so it is not bound by JX_MAX_NESTING_LEVEL.
+ * The grammar check recurses once per level.
+ */
+#ifndef JX_VALIDATE_MAX_DEPTH
+#define JX_VALIDATE_MAX_DEPTH    64
+#endif
+
+/**
+ * @def JX_MAX_RECORD_COLUMNS
+ *
+ * @brief Maximum number of columns in a columnar record array.
+ *
+ * The parser keeps one byte per column on the stack while it reads the rows.
+ */
+#ifndef JX_MAX_RECORD_COLUMNS
+#define JX_MAX_RECORD_COLUMNS    32
+#endif
+
+/**
+ * @def JX_STRING_STREAM_CHUNK
+ *
+ * @brief Bytes handed to a `JX_STRING_STREAM` callback at a time.
+ *
+ * Parsing and serializing a streamed string each keep one chunk on the stack.
+ */
+#ifndef JX_STRING_STREAM_CHUNK
+#define JX_STRING_STREAM_CHUNK   64
+#endif
+
 /**
  * @def JX_PROPERTY_MAX_SIZE
  *
@@ -136,4 +270,33 @@
 #error "JX_USE_CUSTOM_ALLOCATOR cannot be combined with RTOS or BAREMETAL modes."
 #endif
 
+#if JX_ENABLE_SLAB_ALLOCATOR && \
+    (!defined(JX_USE_BAREMETAL) || defined(JX_USE_HEAP_BAREMETAL))
+#error "JX_ENABLE_SLAB_ALLOCATOR requires static JX_USE_BAREMETAL mode."
+#endif
+
+#if (JX_SLAB_MIN_BLOCK_SIZE < 16) || ((JX_SLAB_MIN_BLOCK_SIZE & (JX_SLAB_MIN_BLOCK_SIZE - 1)) != 0)
+#error "JX_SLAB_MIN_BLOCK_SIZE must be a power of two of at least 16."
+#endif
+
+#if JX_SEQLOCK_RETRY_LIMIT < 1
+#error "JX_SEQLOCK_RETRY_LIMIT must be at least 1."
+#endif
+
+#if (JX_MAX_RECORD_COLUMNS < 1) || (JX_MAX_RECORD_COLUMNS > 255)
+#error "JX_MAX_RECORD_COLUMNS must be between 1 and 255."
+#endif
+
+#if (JX_VALIDATE_MAX_DEPTH < JX_MAX_NESTING_LEVEL) || (JX_VALIDATE_MAX_DEPTH > 255)
+#error "JX_VALIDATE_MAX_DEPTH must be between JX_MAX_NESTING_LEVEL and 255."
+#endif
+
+#if JX_STRING_STREAM_CHUNK < 8
+#error "JX_STRING_STREAM_CHUNK must be at least 8."
+#endif
+
+#if (JX_SLAB_CLASS_COUNT < 1) || (JX_SLAB_CLASS_COUNT > 16)
+#error "JX_SLAB_CLASS_COUNT must be between 1 and 16."
+#endif
+
 #endif /* JX_CONFIG_H_ */
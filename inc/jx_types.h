@@ -57,7 +57,8 @@ typedef enum
 typedef enum
 {
     JX_MODE_RELAXED = 0,
-    JX_MODE_STRICT
+    JX_MODE_STRICT,
+    JX_MODE_TRUSTED     ///< Relaxed, for well-formed input JsonX produced itself; skips syntax validation
 } JX_PARSE_MODE;
 
 /** Custom allocation hook table used by custom allocator mode. */
@@ -85,7 +86,10 @@ typedef enum
     JX_I64,
     JX_STRING,
     JX_ARRAY,
-    JX_OBJECT
+    JX_OBJECT,
+    JX_RECORD_ARRAY,
+    JX_STREAMED_STRING,
+    JX_STREAMED_ARRAY
 } JX_ELEMENT_TYPE;
 
 /** Indicates whether a mapped element was updated during parsing. */
@@ -99,7 +103,11 @@ typedef enum
 typedef enum
 {
     JX_MINIFIED = 0,
-    JX_FORMATTED
+    JX_FORMATTED,
+    JX_MINIFIED_ASCII,      ///< Minified, non-ASCII text escaped as \uXXXX
+    JX_FORMATTED_ASCII,     ///< Formatted, non-ASCII text escaped as \uXXXX
+    JX_FORMAT_ALIASES = 0x10, ///< Flag: write `JX_ALIAS()` short names; OR it into a format above
+    JX_FORMAT_COLUMNS = 0x20  ///< Flag: write record arrays as `{"cols":[...],"rows":[[...],...]}`
 } JX_FORMAT;
 
 /** Declarative mapping between a JSON node and caller-owned C storage. */
@@ -115,6 +123,278 @@ typedef struct json_element_s
     uint16_t                element_size;
 } JX_ELEMENT;
 
+/**
+ * Storage of a `JX_RECORD_ARRAY`: contiguous records of one C type.
+ *
+ * The record template mapping is bound to the first record; every other
+ * record is read and written at the same offsets plus a multiple of stride.
+ */
+typedef struct
+{
+    void   *records;    ///< First record
+    size_t  stride;     ///< Distance between records in bytes
+    size_t  count;      ///< Records in use
+    size_t  capacity;   ///< Records available for parsing
+} JX_RECORDS;
+
+/**
+ * Item callback of a `JX_STREAMED_ARRAY` while parsing.
+ *
+ * Called once the item template holds item @p index. Return `false` to abort
+ * the parse.
+ */
+typedef bool (*JX_ITEM_FN)(void *context, size_t index);
+
+/**
+ * Item generator of a `JX_STREAMED_ARRAY` while serializing.
+ *
+ * Fills the item template with item @p index, or sets @p end past the last
+ * item. Return `false` to abort the serialization.
+ */
+typedef bool (*JX_ITEM_NEXT_FN)(void *context, size_t index, bool *end);
+
+/**
+ * Storage of a `JX_STREAMED_ARRAY`: callbacks that take or produce one item at
+ * a time through the item template, so an array of any length needs storage
+ * for a single item.
+ */
+typedef struct
+{
+    JX_ITEM_FN       consume;   ///< Receives each parsed item, or NULL to drop them
+    JX_ITEM_NEXT_FN  produce;   ///< Supplies each item to serialize
+    void            *context;   ///< Passed to both callbacks
+    size_t           count;     ///< Items delivered by the last parse
+} JX_ITEM_STREAM;
+
+/** One independent serialization in a `jx_struct_to_json_batch()` call. */
+typedef struct
+{
+    JX_ELEMENT *element;        ///< Mapping to serialize
+    size_t      element_size;   ///< Number of mapping entries
+    char       *buffer;         ///< Output buffer
+    size_t      buffer_size;    ///< Size of the output buffer in bytes
+    JX_FORMAT   format;         ///< Output formatting
+    JX_STATUS   status;         ///< Result of this job
+} JX_BATCH_JOB;
+
+/** One mapping written by `jx_context_struct_to_json_parts()`. */
+typedef struct
+{
+    const char *key;            ///< Member holding the mapping as an object, or NULL to merge it into the root
+    JX_ELEMENT *element;        ///< Mapping to serialize
+    size_t      element_size;   ///< Number of mapping entries
+} JX_DOCUMENT_PART;
+
+/** One mapping fed by a `jx_context_json_to_struct_fanout()` call. */
+typedef struct
+{
+    JX_ELEMENT *element;        ///< Mapping to fill
+    size_t      element_size;   ///< Number of mapping entries
+    JX_STATUS   status;         ///< Result for this mapping
+} JX_FANOUT_TARGET;
+
+/** Position of one top-level array item in a document; see `jx_array_split()`. */
+typedef struct
+{
+    size_t  offset;     ///< First byte of the item
+    size_t  length;     ///< Item length in bytes, surrounding whitespace excluded
+} JX_SPAN;
+
+/**
+ * Output sink used by chunked serialization.
+ *
+ * Receives @p length bytes of JSON output. Return `false` to abort the
+ * serialization.
+ */
+typedef bool (*JX_SINK_FN)(void *context, const char *data, size_t length);
+
+/**
+ * Input source used by streamed strings.
+ *
+ * Stores up to @p size raw bytes in @p data and their count in @p length;
+ * a count of 0 ends the string. Return `false` to abort the serialization.
+ */
+typedef bool (*JX_SOURCE_FN)(void *context, char *data, size_t size, size_t *length);
+
+/**
+ * Storage of a `JX_STREAMED_STRING`: callbacks instead of a buffer, so a string
+ * of any length passes through `JX_STRING_STREAM_CHUNK` bytes of stack.
+ */
+typedef struct
+{
+    JX_SINK_FN   sink;              ///< Receives decoded bytes while parsing, or NULL to drop them
+    void        *sink_context;      ///< Passed to sink
+    JX_SOURCE_FN source;            ///< Supplies raw bytes while serializing
+    void        *source_context;    ///< Passed to source
+    size_t       length;            ///< Decoded bytes delivered by the last parse
+} JX_STRING_STREAM;
+
+/** Checksum or digest computed by a `JX_DIGEST` stage. */
+typedef enum
+{
+    JX_DIGEST_CRC32C = 0,       ///< CRC-32C (Castagnoli), 4 bytes
+    JX_DIGEST_SHA256,           ///< SHA-256, 32 bytes
+    JX_DIGEST_HMAC_SHA256       ///< HMAC-SHA256, 32 bytes
+} JX_DIGEST_KIND;
+
+/**
+ * Running checksum or digest, set up with `jx_digest_init()`.
+ *
+ * Used as a `JX_SINK_FN` context through `jx_digest_sink()` it digests every
+ * output chunk and passes it on to the next sink. Attached to a `JX_STREAM`
+ * it digests the input as it is fed.
+ */
+typedef struct
+{
+    JX_DIGEST_KIND kind;
+    uint32_t    crc;            ///< CRC-32C register, pre-inverted
+    uint32_t    state[8];       ///< SHA-256 chaining state
+    uint64_t    length;         ///< SHA-256 message length in bytes
+    uint8_t     block[64];      ///< Partial SHA-256 block
+    uint8_t     outer_pad[64];  ///< HMAC key XOR opad, kept for the outer hash
+    JX_SINK_FN  next;           ///< Sink receiving the data afterwards, or NULL
+    void       *next_context;
+} JX_DIGEST;
+
+/** Caller-owned bump arena used by `jx_arena_alloc()`. */
+typedef struct
+{
+    uint8_t    *pool_start;
+    size_t      pool_size;
+    size_t      pool_offset;
+    bool        shared;
+} JX_ARENA;
+
+/** Arena checkpoint returned by `jx_arena_mark()`. */
+typedef size_t JX_ARENA_MARK;
+
+/** Usage and fragmentation counters reported by `jx_get_allocator_stats()`. */
+typedef struct
+{
+    size_t      pool_size;          /**< Bytes managed by the allocator. */
+    size_t      carved_bytes;       /**< Bytes split off the pool so far, including headers. */
+    size_t      live_bytes;         /**< Bytes requested by live allocations. */
+    size_t      live_block_bytes;   /**< Block capacity backing live allocations. */
+    size_t      free_list_bytes;    /**< Bytes parked in free lists for reuse. */
+    size_t      live_allocations;   /**< Number of live allocations. */
+    size_t      failed_allocations; /**< Allocation requests that could not be served. */
+} JX_ALLOCATOR_STATS;
+
+/** Incremental input framing state used by `jx_stream_feed()`. */
+typedef struct
+{
+    char       *buffer;
+    size_t      size;
+    size_t      length;
+    uint16_t    depth;
+    uint8_t     state;
+    bool        complete;
+    JX_DIGEST  *digest;         ///< Digest updated with consumed bytes, or NULL
+} JX_STREAM;
+
+/**
+ * HTTP/1.1 chunked transfer-coding decoder used by `jx_chunked_feed()`.
+ *
+ * Strips chunk-size lines, extensions and trailers from a request body and
+ * copies the payload straight into the buffer of a `JX_STREAM`.
+ */
+typedef struct
+{
+    JX_STREAM  *stream;         ///< Stream receiving the payload
+    size_t      remaining;      ///< Payload bytes left in the current chunk
+    uint8_t     state;
+} JX_CHUNKED;
+
+/**
+ * Caller-owned conversion context used by the `jx_context_*()` functions.
+ * It needs no `jx_init()` call and can be defined statically with
+ * `JX_CONTEXT_INIT`.
+ */
+typedef struct
+{
+    const char *error_ptr;      ///< Error position of the last failed parse
+} JX_CONTEXT;
+
+#define JX_CONTEXT_INIT \
+    { .error_ptr = NULL }
+
+/**
+ * Hash of the document last applied to one mapping; see
+ * `jx_context_json_to_struct_if_changed()`. Reset it with `JX_APPLIED_INIT`
+ * when the application changes mapped values itself.
+ */
+typedef struct
+{
+    uint64_t hash;              ///< `jx_hash()` of the last applied document
+    bool     valid;             ///< A document has been applied
+} JX_APPLIED;
+
+#define JX_APPLIED_INIT \
+    { .hash = 0U, .valid = false }
+
+/** One recorded step of a `JX_SHAPE`; filled in by the parser. */
+typedef struct
+{
+    JX_ELEMENT *element;        ///< Mapping entry the step applies to, or NULL
+    void       *target;         ///< Value address, relocated for record members
+    size_t      offset;         ///< Skeleton bytes that precede the step
+    size_t      count;          ///< Nesting depth of a value, or a container's item count
+    uint8_t     kind;           ///< Step kind, private to the parser
+} JX_SHAPE_SLOT;
+
+/**
+ * Layout of the document last parsed into one mapping; see
+ * `jx_context_json_to_struct_shaped()`. The skeleton keeps every document
+ * byte outside values; the slots say where values sit and what they fill.
+ * Both buffers are caller-owned; initialize with `jx_shape_init()`.
+ */
+typedef struct
+{
+    char             *skeleton;         ///< Document bytes between values
+    size_t            skeleton_size;    ///< Capacity of skeleton in bytes
+    size_t            skeleton_length;  ///< Skeleton bytes in use
+    JX_SHAPE_SLOT    *slots;            ///< Recorded steps
+    size_t            slot_capacity;    ///< Capacity of slots in entries
+    size_t            slot_count;       ///< Steps in use
+    const JX_ELEMENT *mapping;          ///< Mapping the shape was recorded for
+    size_t            mapping_size;     ///< Entries in that mapping
+    JX_PARSE_MODE     mode;             ///< Parse mode the shape was recorded with
+    bool              valid;            ///< A complete shape is recorded
+    uint32_t          hits;             ///< Documents matched against the shape
+    uint32_t          misses;           ///< Documents parsed in full
+} JX_SHAPE;
+
+#if JX_ENABLE_SEQLOCK
+/** Caller-owned seqlock counter; odd while a writer updates the structure. */
+typedef size_t JX_SEQUENCE;
+
+#define JX_SEQUENCE_INIT    0U
+#endif
+
+#if JX_ENABLE_PARALLEL_WRITE
+/** Record ranges shared by parse or serialization workers; see `jx_range_job_claim()`. */
+typedef struct
+{
+    size_t      total;          ///< Records in the array
+    size_t      range_size;     ///< Records per range
+    size_t      next;           ///< Next unclaimed range index
+} JX_RANGE_JOB;
+#endif
+
+#if JX_ENABLE_DOUBLE_BUFFER
+/** Two copies of one mapped structure; see `jx_double_buffer_init()`. */
+typedef struct
+{
+    uint8_t    *slot[2];        ///< Primary (mapped) and secondary copy
+    size_t      slot_size;      ///< Size of each copy in bytes
+    JX_ELEMENT *element;        ///< Mapping bound to the primary copy
+    size_t      element_size;   ///< Number of mapping entries
+    size_t      active;         ///< Index of the published copy
+    size_t      readers[2];     ///< Readers currently holding each copy
+    JX_CONTEXT  context;        ///< Error position of the last parse
+} JX_DOUBLE_BUFFER;
+#endif
+
 /**************************************************************************/
 /*                                                                        */
 /*  Mapping Macros                                                        */
@@ -135,6 +415,9 @@ typedef struct json_element_s
 #define JX_STRING_BUFFER(_buffer) \
     { .type = JX_STRING, .value_p = (void*)(_buffer), .value_capacity = sizeof(_buffer) }
 
+#define JX_STRING_STREAM_VAL(_stream) \
+    { .type = JX_STREAMED_STRING, .value_p = (void*)&(_stream) }
+
 #define JX_BOOLEAN_VAL(_value_p) \
     { .type = JX_BOOLEAN, .value_p = &_value_p }
 
@@ -159,6 +442,22 @@ typedef struct json_element_s
 #define JX_OBJECT_EMPTY \
     { .type = JX_OBJECT, .element = NULL, .value_len = 1 }
 
+/**
+ * Property name with a short wire alias, for any `JX_PROPERTY_*` macro:
+ * `JX_PROPERTY_U32(JX_ALIAS("battery_voltage_mv", "bv"), battery_mv)`.
+ *
+ * The alias is stored after the full name's terminator behind a
+ * `JX_ALIAS_MARK` byte, so both together must fit in `JX_PROPERTY_MAX_SIZE`
+ * including two terminators and the mark. Bytes left after a name copied
+ * in at runtime are never taken for an alias. The parser accepts either
+ * name; the writer emits the alias when the format includes
+ * `JX_FORMAT_ALIASES`. Both arguments must be string literals.
+ */
+#define JX_ALIAS_MARK "\x1F"
+
+#define JX_ALIAS(_property, _alias) \
+    _property "\0" JX_ALIAS_MARK _alias
+
 #define JX_PROPERTY_STRING(_property, _value_p) \
     { .property = _property, .type = JX_STRING, .value_p = _value_p, .value_capacity = JX_PROPERTY_MAX_SIZE }
 
@@ -168,6 +467,9 @@ typedef struct json_element_s
 #define JX_PROPERTY_STRING_BUFFER(_property, _buffer) \
     { .property = _property, .type = JX_STRING, .value_p = _buffer, .value_capacity = sizeof(_buffer) }
 
+#define JX_PROPERTY_STRING_STREAM(_property, _stream) \
+    { .property = _property, .type = JX_STREAMED_STRING, .value_p = &_stream }
+
 #define JX_PROPERTY_BOOLEAN(_property, _value_p) \
     { .property = _property, .type = JX_BOOLEAN, .value_p = &_value_p }
 
@@ -197,6 +499,18 @@ typedef struct json_element_s
 #define JX_PROPERTY_ARRAY(_property, _element) \
     { .property = _property, .type = JX_ARRAY, .element = _element, .value_len = sizeof(_element) / sizeof(_element[0]), .value_capacity = sizeof(_element) / sizeof(_element[0]) }
 
+#define JX_RECORDS_INIT(_array, _count) \
+    { .records = (_array), .stride = sizeof((_array)[0]), .count = (_count), .capacity = sizeof(_array) / sizeof((_array)[0]) }
+
+#define JX_PROPERTY_RECORD_ARRAY(_property, _records, _template) \
+    { .property = _property, .type = JX_RECORD_ARRAY, .value_p = &_records, .element = _template, .value_len = sizeof(_template) / sizeof(_template[0]) }
+
+#define JX_ITEM_STREAM_INIT(_consume, _produce, _context) \
+    { .consume = (_consume), .produce = (_produce), .context = (_context), .count = 0U }
+
+#define JX_PROPERTY_ITEM_STREAM(_property, _stream, _template) \
+    { .property = _property, .type = JX_STREAMED_ARRAY, .value_p = &_stream, .element = _template, .value_len = sizeof(_template) / sizeof(_template[0]) }
+
 #define JX_PROPERTY_OBJECT(_property, _element) \
     { .property = _property, .type = JX_OBJECT, .element = _element, .value_len = sizeof(_element) / sizeof(_element[0]) }
 
@@ -0,0 +1,92 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_atomic.h                                                     */
+/*  @brief Minimal atomic helpers for JsonX                               */
+/*                                                                        */
+/*  Wraps the GCC-style __atomic builtins used by lock-free features.     */
+/*  Only included by implementation files that need atomics.              */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef JX_ATOMIC_H
+#define JX_ATOMIC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "JsonX atomic features require GCC-style __atomic builtins."
+#endif
+
+/**************************************************************************/
+/*                                                                        */
+/*  Atomic Helpers                                                        */
+/*                                                                        */
+/**************************************************************************/
+
+static inline size_t jx_atomic_load_size(const size_t *object)
+{
+    return __atomic_load_n(object, __ATOMIC_ACQUIRE);
+}
+
+static inline void jx_atomic_store_size(size_t *object, size_t value)
+{
+    __atomic_store_n(object, value, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Replace @p object with @p desired if it still holds @p *expected.
+ *
+ * On failure @p *expected receives the current value.
+ */
+static inline bool jx_atomic_cas_size(size_t *object, size_t *expected, size_t desired)
+{
+    return __atomic_compare_exchange_n(object, expected, desired, true,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static inline size_t jx_atomic_add_size(size_t *object, size_t value)
+{
+    return __atomic_add_fetch(object, value, __ATOMIC_SEQ_CST);
+}
+
+static inline size_t jx_atomic_sub_size(size_t *object, size_t value)
+{
+    return __atomic_sub_fetch(object, value, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Full barrier; orders a store before a later load of another object.
+ */
+static inline void jx_atomic_fence(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Order earlier plain loads before a later load of the object they guard.
+ */
+static inline void jx_atomic_acquire_fence(void)
+{
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Order earlier plain stores before the store that publishes them.
+ */
+static inline void jx_atomic_release_fence(void)
+{
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JX_ATOMIC_H */
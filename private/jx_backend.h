@@ -19,6 +19,28 @@ extern "C" {
 
 #include "jx_types.h"
 
+/**
+ * Redirects parsed values: mapping targets inside [source, source + size)
+ * are written at the same offset from target instead.
+ */
+typedef struct
+{
+    const uint8_t *source;
+    uint8_t *target;
+    size_t size;
+} JX_BACKEND_RELOCATION;
+
+/** Output format without the `JX_FORMAT_ALIASES` and `JX_FORMAT_COLUMNS` flags. */
+#define JX_BACKEND_FORMAT_BASE(_format)                                     \
+    ((JX_FORMAT)((_format) & ~(JX_FORMAT_ALIASES | JX_FORMAT_COLUMNS)))
+
+/** True for every supported output format, with or without flags. */
+#define JX_BACKEND_FORMAT_VALID(_format)                                    \
+    ((JX_BACKEND_FORMAT_BASE(_format) == JX_MINIFIED) ||                    \
+     (JX_BACKEND_FORMAT_BASE(_format) == JX_FORMATTED) ||                   \
+     (JX_BACKEND_FORMAT_BASE(_format) == JX_MINIFIED_ASCII) ||              \
+     (JX_BACKEND_FORMAT_BASE(_format) == JX_FORMATTED_ASCII))
+
 /**************************************************************************/
 /*                                                                        */
 /*  Backend API                                                           */
@@ -32,12 +54,100 @@ const char *jx_backend_get_error_ptr(void);
 JX_STATUS jx_backend_parse_into_elements(char *buffer,
                                          JX_ELEMENT *elements,
                                          size_t element_count,
-                                         JX_PARSE_MODE mode);
+                                         JX_PARSE_MODE mode,
+                                         const char **error_ptr);
+JX_STATUS jx_backend_parse_relocated(char *buffer,
+                                     JX_ELEMENT *elements,
+                                     size_t element_count,
+                                     JX_PARSE_MODE mode,
+                                     const char **error_ptr,
+                                     const JX_BACKEND_RELOCATION *relocation);
 bool jx_backend_write_elements(JX_ELEMENT *elements,
                                size_t element_count,
                                char *buffer,
                                size_t buffer_size,
                                JX_FORMAT format);
+bool jx_backend_write_elements_to_sink(JX_ELEMENT *elements,
+                                       size_t element_count,
+                                       char *chunk,
+                                       size_t chunk_size,
+                                       JX_FORMAT format,
+                                       JX_SINK_FN sink,
+                                       void *sink_context);
+
+/* Fan-in: one root object from several mappings; a NULL sink writes to buffer alone. */
+bool jx_backend_write_parts(const JX_DOCUMENT_PART *parts,
+                            size_t part_count,
+                            char *buffer,
+                            size_t buffer_size,
+                            JX_FORMAT format,
+                            JX_SINK_FN sink,
+                            void *sink_context);
+
+/* Seqlock support: pack mapped scalars in mapping order, then format from the pack. */
+size_t jx_backend_snapshot_size(const JX_ELEMENT *elements, size_t element_count);
+bool jx_backend_snapshot_elements(const JX_ELEMENT *elements,
+                                  size_t element_count,
+                                  void *staging,
+                                  size_t staging_size);
+bool jx_backend_write_snapshot(JX_ELEMENT *elements,
+                               size_t element_count,
+                               const void *snapshot,
+                               char *buffer,
+                               size_t buffer_size,
+                               JX_FORMAT format);
+
+/* Record arrays: write one range of records plus the document text it owns. */
+bool jx_backend_write_range(JX_ELEMENT *elements,
+                            size_t element_count,
+                            const JX_ELEMENT *range_element,
+                            size_t first,
+                            size_t count,
+                            char *buffer,
+                            size_t buffer_size,
+                            JX_FORMAT format,
+                            size_t *written);
+
+/* Top-level array items: parse one object that must end at span + length. */
+JX_STATUS jx_backend_parse_span(const char *span,
+                                size_t length,
+                                JX_ELEMENT *elements,
+                                size_t element_count,
+                                JX_PARSE_MODE mode,
+                                const char **error_ptr,
+                                const JX_BACKEND_RELOCATION *relocation);
+
+/* Standalone validation: check one value with full grammar rules up to JX_VALIDATE_MAX_DEPTH; *end gets the byte after it. */
+bool jx_backend_skip_value(const char *text, const char **end);
+
+/* Comparison: run a relaxed parse that compares mapped values instead of storing them. */
+JX_STATUS jx_backend_compare_elements(const char *json,
+                                      JX_ELEMENT *elements,
+                                      size_t element_count,
+                                      bool *equal);
+
+/* Shape cache: replay a recorded layout, or parse in full and record it. */
+JX_STATUS jx_backend_parse_shaped(char *buffer,
+                                  JX_ELEMENT *elements,
+                                  size_t element_count,
+                                  JX_PARSE_MODE mode,
+                                  const char **error_ptr,
+                                  JX_SHAPE *shape);
+
+/* Fan-out: one pass over the root object, each member parsed into every mapping that knows it. */
+JX_STATUS jx_backend_parse_fanout(char *buffer,
+                                  JX_FANOUT_TARGET *targets,
+                                  size_t target_count,
+                                  JX_PARSE_MODE mode,
+                                  const char **error_ptr);
+
+/* Projection: copy the members selected by dot-separated paths, skipping the rest. */
+JX_STATUS jx_backend_project(const char *json,
+                             const char *const *paths,
+                             size_t path_count,
+                             char *buffer,
+                             size_t buffer_size,
+                             size_t *written);
 
 #ifdef __cplusplus
 }
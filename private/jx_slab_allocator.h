@@ -0,0 +1,90 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_slab_allocator.h                                             */
+/*  @brief Interface for the Size-Class Slab Allocator (JsonX)            */
+/*                                                                        */
+/*  Provides O(1) allocate/free over a caller-provided buffer for         */
+/*  long-running baremetal deployments without a heap.                    */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+
+#ifndef JX_SLAB_ALLOCATOR_H
+#define JX_SLAB_ALLOCATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "jx_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************************************************/
+/*                                                                        */
+/*  HOW IT WORKS                                                          */
+/*                                                                        */
+/*  Every block carries a 4-byte header holding its size class and the    */
+/*  requested size. Blocks are carved lazily from the pool; freed blocks  */
+/*  go to the free list of their class and are reused before carving     */
+/*  more. Requests above the largest class are carved exactly and can     */
+/*  only be returned while they are the last carve. A reset reclaims all. */
+/*                                                                        */
+/**************************************************************************/
+
+/**
+ * @brief Slab allocator context structure.
+ */
+typedef struct
+{
+    JX_ARENA  carve;                                ///< Uncarved remainder of the pool
+    void     *free_list[JX_SLAB_CLASS_COUNT];       ///< Free blocks per size class
+    size_t    live_bytes;                           ///< Requested bytes in use
+    size_t    live_block_bytes;                     ///< Block bytes in use
+    size_t    free_list_bytes;                      ///< Block bytes in free lists
+    size_t    live_allocations;                     ///< Live allocation count
+    size_t    failed_allocations;                   ///< Failed allocation count
+} jx_slab_allocator_t;
+
+/**
+ * @brief Initialize a slab allocator at the start of @p buffer.
+ *
+ * @param buffer Pointer to a user-allocated memory buffer.
+ * @param size   Total size of the buffer (including allocator and pool).
+ * @return Pointer to allocator instance or NULL if size is too small.
+ */
+jx_slab_allocator_t *jx_slab_allocator_init(void *buffer, size_t size);
+
+/**
+ * @brief Allocate a block of at least @p size bytes.
+ *
+ * @return Pointer to 4-byte aligned memory or NULL if not enough space.
+ */
+void *jx_slab_malloc(jx_slab_allocator_t *slab, size_t size);
+
+/**
+ * @brief Return a block to its size-class free list.
+ *
+ * NULL and already freed blocks are ignored.
+ */
+void jx_slab_free(jx_slab_allocator_t *slab, void *ptr);
+
+/**
+ * @brief Reclaim the whole pool and clear all free lists.
+ */
+void jx_slab_reset(jx_slab_allocator_t *slab);
+
+/**
+ * @brief Report usage and fragmentation counters.
+ */
+void jx_slab_get_stats(const jx_slab_allocator_t *slab, JX_ALLOCATOR_STATS *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JX_SLAB_ALLOCATOR_H */
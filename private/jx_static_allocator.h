@@ -19,7 +19,10 @@
 #include <stdbool.h>
 #include <string.h>
 
-#include "jx_config.h"
+#include "jx_types.h"
+#if JX_ENABLE_SLAB_ALLOCATOR
+#include "jx_slab_allocator.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -46,13 +49,16 @@ extern "C" {
 
 /**
  * @brief Static allocator context structure.
+ *
+ * The library pool is a regular bump arena placed at the start of the
+ * user buffer. With JX_ENABLE_ATOMIC_ARENA it is created shared. With
+ * JX_ENABLE_SLAB_ALLOCATOR the same buffer is managed as size classes.
  */
-typedef struct jx_static_allocator_t
-{
-    uint8_t  *pool_start;     ///< Start of memory pool (after instance)
-    size_t    pool_size;      ///< Total size of memory pool
-    size_t    pool_offset;    ///< Current allocation offset in pool
-} jx_static_allocator_t;
+#if JX_ENABLE_SLAB_ALLOCATOR
+typedef jx_slab_allocator_t jx_static_allocator_t;
+#else
+typedef JX_ARENA jx_static_allocator_t;
+#endif
 
 /**
  * @brief Initialize the static allocator using the given buffer.
@@ -74,7 +80,10 @@ jx_static_allocator_t *jx_static_allocator_init(void *buffer, size_t size);
 void *jx_static_malloc(size_t size);
 
 /**
- * @brief Free a block of memory (no-op for static allocator).
+ * @brief Free a block of memory.
+ *
+ * No-op for the bump pool; returns the block to its size class when
+ * JX_ENABLE_SLAB_ALLOCATOR is set.
  *
  * @param ptr Pointer to previously allocated block.
  */
@@ -85,6 +94,13 @@ void jx_static_free(void *ptr);
  * @brief Reset the allocator to reuse the entire pool.
  */
 void jx_static_reset(void);
+
+/**
+ * @brief Report usage counters of the static pool.
+ *
+ * @param stats Destination for the counters.
+ */
+void jx_static_get_stats(JX_ALLOCATOR_STATS *stats);
 #else
 // Heap mode: no reset needed
 #endif
@@ -0,0 +1,70 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_utf8.h                                                       */
+/*  @brief UTF-8 validation and encoding helpers (JsonX)                  */
+/*                                                                        */
+/*  Used by the native backend while it scans strings, so validation      */
+/*  costs nothing for ASCII bytes.                                        */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef JX_UTF8_H
+#define JX_UTF8_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Largest Unicode scalar value. */
+#define JX_UTF8_MAX_CODE_POINT  0x10FFFFUL
+
+/**
+ * @brief Return the length of the well-formed sequence at @p text.
+ *
+ * Rejects stray continuation bytes, overlong forms, UTF-16 surrogates and
+ * values above U+10FFFF. Never reads past a NUL byte.
+ *
+ * @return 1 to 4, or 0 when the sequence is malformed.
+ */
+size_t jx_utf8_sequence_length(const uint8_t *text);
+
+/**
+ * @brief Decode the well-formed sequence at @p text.
+ *
+ * @param[in]  text Sequence start.
+ * @param[out] code Decoded scalar value.
+ *
+ * @return Sequence length 1 to 4, or 0 when the sequence is malformed.
+ */
+size_t jx_utf8_decode(const uint8_t *text, uint32_t *code);
+
+/**
+ * @brief Encode a Unicode scalar value.
+ *
+ * @param[in]  code   Scalar value, not a surrogate.
+ * @param[out] output At least four bytes.
+ *
+ * @return Number of bytes written, or 0 for an invalid value.
+ */
+size_t jx_utf8_encode(uint32_t code, uint8_t *output);
+
+/**
+ * @brief Length of @p text up to a sequence that runs past its end.
+ *
+ * Used to hold back a sequence cut by a chunk boundary until its remaining
+ * bytes arrive. Only lead bytes are inspected.
+ *
+ * @return @p length, or the offset of the cut sequence.
+ */
+size_t jx_utf8_complete_length(const uint8_t *text, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JX_UTF8_H */
@@ -0,0 +1,153 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_arena.c                                                      */
+/*  @brief Caller-owned bump arenas for JsonX                             */
+/*                                                                        */
+/*  Arenas carve memory from a caller-provided buffer. A local arena is   */
+/*  owned by one thread or context and needs no synchronization; a shared */
+/*  arena bumps its offset atomically when JX_ENABLE_ATOMIC_ARENA is set. */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "../private/jx_internal.h"
+#if JX_ENABLE_ATOMIC_ARENA
+#include "../private/jx_atomic.h"
+#endif
+
+#ifndef ALIGN_4
+#define ALIGN_4(x)  (((x) + 3) & ~3)
+#endif
+
+/**************************************************************************/
+/*                                                                        */
+/*  Arena API                                                             */
+/*                                                                        */
+/**************************************************************************/
+
+JX_STATUS jx_arena_init(JX_ARENA *arena, void *buffer, size_t size)
+{
+    if ((arena == NULL) || (buffer == NULL))
+    {
+        return JX_ERROR;
+    }
+
+    arena->pool_start  = (uint8_t *)buffer;
+    arena->pool_size   = size;
+    arena->pool_offset = 0U;
+    arena->shared      = false;
+    return JX_SUCCESS;
+}
+
+#if JX_ENABLE_ATOMIC_ARENA
+JX_STATUS jx_arena_init_shared(JX_ARENA *arena, void *buffer, size_t size)
+{
+    if (jx_arena_init(arena, buffer, size) != JX_SUCCESS)
+    {
+        return JX_ERROR;
+    }
+
+    arena->shared = true;
+    return JX_SUCCESS;
+}
+#endif
+
+void *jx_arena_alloc(JX_ARENA *arena, size_t size)
+{
+    size_t offset;
+
+    if ((arena == NULL) || (arena->pool_start == NULL) ||
+        (size == 0U) || (size > (SIZE_MAX - 3U)))
+    {
+        return NULL;
+    }
+
+    size = ALIGN_4(size);
+
+#if JX_ENABLE_ATOMIC_ARENA
+    if (arena->shared)
+    {
+        offset = jx_atomic_load_size(&arena->pool_offset);
+        do
+        {
+            if (size > (arena->pool_size - offset))
+            {
+                return NULL;
+            }
+        } while (!jx_atomic_cas_size(&arena->pool_offset, &offset, offset + size));
+
+        return arena->pool_start + offset;
+    }
+#endif
+
+    offset = arena->pool_offset;
+    if (size > (arena->pool_size - offset))
+    {
+        return NULL;
+    }
+
+    arena->pool_offset = offset + size;
+    return arena->pool_start + offset;
+}
+
+void jx_arena_reset(JX_ARENA *arena)
+{
+    if (arena == NULL)
+    {
+        return;
+    }
+
+#if JX_ENABLE_ATOMIC_ARENA
+    if (arena->shared)
+    {
+        jx_atomic_store_size(&arena->pool_offset, 0U);
+        return;
+    }
+#endif
+
+    arena->pool_offset = 0U;
+}
+
+size_t jx_arena_used(const JX_ARENA *arena)
+{
+    if (arena == NULL)
+    {
+        return 0U;
+    }
+
+#if JX_ENABLE_ATOMIC_ARENA
+    if (arena->shared)
+    {
+        return jx_atomic_load_size(&arena->pool_offset);
+    }
+#endif
+
+    return arena->pool_offset;
+}
+
+JX_ARENA_MARK jx_arena_mark(const JX_ARENA *arena)
+{
+    return (JX_ARENA_MARK)jx_arena_used(arena);
+}
+
+void jx_arena_release(JX_ARENA *arena, JX_ARENA_MARK mark)
+{
+    if (arena == NULL)
+    {
+        return;
+    }
+
+    /* Other threads may hold memory above any mark of a shared arena. */
+    if (arena->shared)
+    {
+        return;
+    }
+
+    /* A mark above the offset belongs to a scope that was already released. */
+    if (mark < arena->pool_offset)
+    {
+        arena->pool_offset = mark;
+    }
+}
@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_batch.c                                                      */
+/*  @brief Batch serialization of independent mappings (JsonX)            */
+/*                                                                        */
+/*  Batches run on the native writer only, without the global parser      */
+/*  instance, so concurrent batches need no lock.                         */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "../private/jx_backend.h"
+
+#include <limits.h>
+
+/**************************************************************************/
+/*                                                                        */
+/*  Local Functions                                                       */
+/*                                                                        */
+/**************************************************************************/
+
+static JX_STATUS jx_batch_format(JX_BATCH_JOB *job)
+{
+    if ((!job->element) || (job->element_size == 0U) ||
+        (!job->buffer) || (job->buffer_size == 0U) || (job->buffer_size > (size_t)INT_MAX) ||
+        (!JX_BACKEND_FORMAT_VALID(job->format)))
+    {
+        job->status = JX_ERROR;
+    }
+    else
+    {
+        job->status = jx_backend_write_elements(job->element, job->element_size,
+                                                job->buffer, job->buffer_size, job->format)
+                    ? JX_SUCCESS : JX_ERROR;
+    }
+
+    return job->status;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  Batch API                                                             */
+/*                                                                        */
+/**************************************************************************/
+
+JX_STATUS jx_struct_to_json_batch(JX_BATCH_JOB *jobs, size_t job_count)
+{
+    JX_STATUS status = JX_SUCCESS;
+
+    if ((!jobs) || (job_count == 0U))
+    {
+        return JX_ERROR;
+    }
+
+    for (size_t i = 0U; i < job_count; ++i)
+    {
+        if (jx_batch_format(&jobs[i]) != JX_SUCCESS)
+        {
+            status = JX_ERROR;
+        }
+    }
+
+    return status;
+}
+
+#if JX_ENABLE_PARALLEL_WRITE
+JX_STATUS jx_struct_to_json_batch_shared(JX_RANGE_JOB *job, JX_BATCH_JOB *jobs)
+{
+    JX_STATUS status = JX_SUCCESS;
+    size_t index;
+    size_t first;
+    size_t count;
+
+    if ((!job) || (!jobs))
+    {
+        return JX_ERROR;
+    }
+
+    while (jx_range_job_claim(job, &index, &first, &count))
+    {
+        for (size_t i = first; i < (first + count); ++i)
+        {
+            if (jx_batch_format(&jobs[i]) != JX_SUCCESS)
+            {
+                status = JX_ERROR;
+            }
+        }
+    }
+
+    return status;
+}
+#endif
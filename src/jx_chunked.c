@@ -0,0 +1,254 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_chunked.c                                                    */
+/*  @brief HTTP/1.1 chunked transfer-coding input for JsonX               */
+/*                                                                        */
+/*  Removes chunk framing from a request body while it is received and    */
+/*  copies the payload runs straight into an incremental input stream.    */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "../private/jx_internal.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  Decoder States                                                        */
+/*                                                                        */
+/**************************************************************************/
+
+enum
+{
+    JX_CHUNKED_STATE_SIZE_START = 0,
+    JX_CHUNKED_STATE_SIZE,
+    JX_CHUNKED_STATE_EXTENSION,
+    JX_CHUNKED_STATE_SIZE_LF,
+    JX_CHUNKED_STATE_DATA,
+    JX_CHUNKED_STATE_DATA_CR,
+    JX_CHUNKED_STATE_DATA_LF,
+    JX_CHUNKED_STATE_TRAILER_START,
+    JX_CHUNKED_STATE_TRAILER,
+    JX_CHUNKED_STATE_TRAILER_LF,
+    JX_CHUNKED_STATE_END_LF,
+    JX_CHUNKED_STATE_DONE,
+    JX_CHUNKED_STATE_ERROR
+};
+
+static int jx_chunked_hex_value(char c)
+{
+    if ((c >= '0') && (c <= '9'))
+    {
+        return c - '0';
+    }
+    if ((c >= 'a') && (c <= 'f'))
+    {
+        return c - 'a' + 10;
+    }
+    if ((c >= 'A') && (c <= 'F'))
+    {
+        return c - 'A' + 10;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Advance the framing state machine by one byte outside chunk data.
+ *
+ * Chunk-size lines must end in CRLF; extensions and trailer fields are
+ * skipped without interpretation.
+ */
+static void jx_chunked_step(JX_CHUNKED *chunked, char c)
+{
+    int digit;
+
+    switch (chunked->state)
+    {
+    case JX_CHUNKED_STATE_SIZE_START:
+    case JX_CHUNKED_STATE_SIZE:
+        digit = jx_chunked_hex_value(c);
+        if (digit >= 0)
+        {
+            if (chunked->remaining > (SIZE_MAX >> 4))
+            {
+                chunked->state = JX_CHUNKED_STATE_ERROR;
+                break;
+            }
+            chunked->remaining = (chunked->remaining << 4) | (size_t)digit;
+            chunked->state = JX_CHUNKED_STATE_SIZE;
+            break;
+        }
+        if (chunked->state == JX_CHUNKED_STATE_SIZE_START)
+        {
+            chunked->state = JX_CHUNKED_STATE_ERROR;
+            break;
+        }
+        if (c == '\r')
+        {
+            chunked->state = JX_CHUNKED_STATE_SIZE_LF;
+        }
+        else if ((c == ';') || (c == ' ') || (c == '\t'))
+        {
+            chunked->state = JX_CHUNKED_STATE_EXTENSION;
+        }
+        else
+        {
+            chunked->state = JX_CHUNKED_STATE_ERROR;
+        }
+        break;
+
+    case JX_CHUNKED_STATE_EXTENSION:
+    case JX_CHUNKED_STATE_TRAILER:
+        if (c == '\r')
+        {
+            chunked->state = (chunked->state == JX_CHUNKED_STATE_EXTENSION) ?
+                             JX_CHUNKED_STATE_SIZE_LF : JX_CHUNKED_STATE_TRAILER_LF;
+        }
+        else if (c == '\n')
+        {
+            chunked->state = JX_CHUNKED_STATE_ERROR;
+        }
+        break;
+
+    case JX_CHUNKED_STATE_SIZE_LF:
+        if (c != '\n')
+        {
+            chunked->state = JX_CHUNKED_STATE_ERROR;
+        }
+        else
+        {
+            /* A zero-size chunk ends the body; trailer fields may follow. */
+            chunked->state = (chunked->remaining == 0U) ? JX_CHUNKED_STATE_TRAILER_START : JX_CHUNKED_STATE_DATA;
+        }
+        break;
+
+    case JX_CHUNKED_STATE_DATA_CR:
+        chunked->state = (c == '\r') ? JX_CHUNKED_STATE_DATA_LF : JX_CHUNKED_STATE_ERROR;
+        break;
+
+    case JX_CHUNKED_STATE_DATA_LF:
+        chunked->state = (c == '\n') ? JX_CHUNKED_STATE_SIZE_START : JX_CHUNKED_STATE_ERROR;
+        break;
+
+    case JX_CHUNKED_STATE_TRAILER_START:
+        chunked->state = (c == '\r') ? JX_CHUNKED_STATE_END_LF : JX_CHUNKED_STATE_TRAILER;
+        break;
+
+    case JX_CHUNKED_STATE_TRAILER_LF:
+        chunked->state = (c == '\n') ? JX_CHUNKED_STATE_TRAILER_START : JX_CHUNKED_STATE_ERROR;
+        break;
+
+    case JX_CHUNKED_STATE_END_LF:
+        chunked->state = (c == '\n') ? JX_CHUNKED_STATE_DONE : JX_CHUNKED_STATE_ERROR;
+        break;
+
+    default:
+        chunked->state = JX_CHUNKED_STATE_ERROR;
+        break;
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  Public Chunked API                                                    */
+/*                                                                        */
+/**************************************************************************/
+
+JX_STATUS jx_chunked_init(JX_CHUNKED *chunked, JX_STREAM *stream)
+{
+    if ((chunked == NULL) || (stream == NULL) || (stream->buffer == NULL))
+    {
+        return JX_ERROR;
+    }
+
+    memset(chunked, 0, sizeof(JX_CHUNKED));
+    chunked->stream = stream;
+    return JX_SUCCESS;
+}
+
+void jx_chunked_reset(JX_CHUNKED *chunked)
+{
+    if (chunked == NULL)
+    {
+        return;
+    }
+
+    chunked->remaining = 0U;
+    chunked->state = JX_CHUNKED_STATE_SIZE_START;
+}
+
+JX_STATUS jx_chunked_feed(JX_CHUNKED *chunked, const char *data, size_t length, size_t *consumed)
+{
+    size_t used = 0U;
+
+    if (consumed != NULL)
+    {
+        *consumed = 0U;
+    }
+
+    if ((chunked == NULL) || (chunked->stream == NULL) ||
+        ((data == NULL) && (length != 0U)) ||
+        (chunked->state == JX_CHUNKED_STATE_ERROR))
+    {
+        return JX_ERROR;
+    }
+
+    while ((used < length) && (chunked->state != JX_CHUNKED_STATE_DONE) &&
+           (chunked->state != JX_CHUNKED_STATE_ERROR))
+    {
+        if (chunked->state == JX_CHUNKED_STATE_DATA)
+        {
+            JX_STREAM *stream = chunked->stream;
+            size_t run = length - used;
+
+            /*
+             * The last chunk marks the end of the body, so payload needs no
+             * JSON framing: each run is copied into the stream in one step.
+             */
+            run = (run < chunked->remaining) ? run : chunked->remaining;
+            if (stream->complete || (run >= (stream->size - stream->length)) ||
+                (memchr(&data[used], '\0', run) != NULL))
+            {
+                chunked->state = JX_CHUNKED_STATE_ERROR;
+                break;
+            }
+
+            memcpy(&stream->buffer[stream->length], &data[used], run);
+            stream->length += run;
+            stream->buffer[stream->length] = '\0';
+            if (stream->digest != NULL)
+            {
+                jx_digest_update(stream->digest, &data[used], run);
+            }
+
+            used += run;
+            chunked->remaining -= run;
+            if (chunked->remaining == 0U)
+            {
+                chunked->state = JX_CHUNKED_STATE_DATA_CR;
+            }
+            continue;
+        }
+
+        jx_chunked_step(chunked, data[used]);
+        used++;
+        if (chunked->state == JX_CHUNKED_STATE_DONE)
+        {
+            chunked->stream->complete = (chunked->stream->length != 0U);
+        }
+    }
+
+    if (consumed != NULL)
+    {
+        *consumed = used;
+    }
+
+    return (chunked->state == JX_CHUNKED_STATE_ERROR) ? JX_ERROR : JX_SUCCESS;
+}
+
+bool jx_chunked_is_finished(const JX_CHUNKED *chunked)
+{
+    return (chunked != NULL) && (chunked->state == JX_CHUNKED_STATE_DONE);
+}
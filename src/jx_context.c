@@ -0,0 +1,151 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_context.c                                                    */
+/*  @brief Caller-owned conversion contexts for JsonX                     */
+/*                                                                        */
+/*  Context functions run the native backend without the global parser    */
+/*  instance: no jx_init(), no allocator calls and no shared state.       */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "../private/jx_backend.h"
+
+#include <limits.h>
+
+/**************************************************************************/
+/*                                                                        */
+/*  Context API                                                           */
+/*                                                                        */
+/**************************************************************************/
+
+JX_STATUS jx_context_json_to_struct(JX_CONTEXT *context,
+                                    char *buffer,
+                                    JX_ELEMENT *element,
+                                    size_t element_size,
+                                    JX_PARSE_MODE mode)
+{
+    if ((!context) || (!buffer) || (!element) || (element_size == 0U) ||
+        ((mode != JX_MODE_RELAXED) && (mode != JX_MODE_STRICT) && (mode != JX_MODE_TRUSTED)))
+    {
+        return JX_ERROR;
+    }
+
+    return jx_backend_parse_into_elements(buffer, element, element_size, mode, &context->error_ptr);
+}
+
+JX_STATUS jx_context_json_to_struct_fanout(JX_CONTEXT *context,
+                                           char *buffer,
+                                           JX_FANOUT_TARGET *targets,
+                                           size_t target_count,
+                                           JX_PARSE_MODE mode)
+{
+    if (!context)
+    {
+        return JX_ERROR;
+    }
+
+    return jx_backend_parse_fanout(buffer, targets, target_count, mode, &context->error_ptr);
+}
+
+JX_STATUS jx_context_struct_to_json(JX_CONTEXT *context,
+                                    JX_ELEMENT *element,
+                                    size_t element_size,
+                                    char *buffer,
+                                    size_t buffer_size,
+                                    JX_FORMAT format)
+{
+    if ((!context) || (!element) || (element_size == 0U) ||
+        (!buffer) || (buffer_size == 0U) || (buffer_size > (size_t)INT_MAX) ||
+        (!JX_BACKEND_FORMAT_VALID(format)))
+    {
+        return JX_ERROR;
+    }
+
+    if (!jx_backend_write_elements(element, element_size, buffer, buffer_size, format))
+    {
+        return JX_ERROR;
+    }
+
+    return JX_SUCCESS;
+}
+
+JX_STATUS jx_context_struct_to_json_chunked(JX_CONTEXT *context,
+                                            JX_ELEMENT *element,
+                                            size_t element_size,
+                                            char *chunk,
+                                            size_t chunk_size,
+                                            JX_FORMAT format,
+                                            JX_SINK_FN sink,
+                                            void *sink_context)
+{
+    if ((!context) || (!element) || (element_size == 0U) ||
+        (!chunk) || (chunk_size < 2U) || (!sink) ||
+        (!JX_BACKEND_FORMAT_VALID(format)))
+    {
+        return JX_ERROR;
+    }
+
+    if (!jx_backend_write_elements_to_sink(element, element_size, chunk, chunk_size,
+                                           format, sink, sink_context))
+    {
+        return JX_ERROR;
+    }
+
+    return JX_SUCCESS;
+}
+
+JX_STATUS jx_context_struct_to_json_parts(JX_CONTEXT *context,
+                                          const JX_DOCUMENT_PART *parts,
+                                          size_t part_count,
+                                          char *buffer,
+                                          size_t buffer_size,
+                                          JX_FORMAT format)
+{
+    if ((!context) || (!buffer) || (buffer_size == 0U) || (buffer_size > (size_t)INT_MAX))
+    {
+        return JX_ERROR;
+    }
+
+    if (!jx_backend_write_parts(parts, part_count, buffer, buffer_size, format, NULL, NULL))
+    {
+        return JX_ERROR;
+    }
+
+    return JX_SUCCESS;
+}
+
+JX_STATUS jx_context_struct_to_json_parts_chunked(JX_CONTEXT *context,
+                                                  const JX_DOCUMENT_PART *parts,
+                                                  size_t part_count,
+                                                  char *chunk,
+                                                  size_t chunk_size,
+                                                  JX_FORMAT format,
+                                                  JX_SINK_FN sink,
+                                                  void *sink_context)
+{
+    if ((!context) || (!sink))
+    {
+        return JX_ERROR;
+    }
+
+    if (!jx_backend_write_parts(parts, part_count, chunk, chunk_size, format, sink, sink_context))
+    {
+        return JX_ERROR;
+    }
+
+    return JX_SUCCESS;
+}
+
+size_t jx_context_get_last_error_offset(const JX_CONTEXT *context, const char *buffer)
+{
+    if ((context == NULL) || (buffer == NULL) ||
+        (context->error_ptr == NULL) || (context->error_ptr < buffer))
+    {
+        return (size_t)-1;
+    }
+
+    return (size_t)(context->error_ptr - buffer);
+}
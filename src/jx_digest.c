@@ -0,0 +1,411 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_digest.c                                                     */
+/*  @brief CRC-32C, SHA-256 and HMAC-SHA256 stages (JsonX)                */
+/*                                                                        */
+/*  Digests are updated from the serializer's chunks and the stream's     */
+/*  input slices, so integrity checks need no extra pass over a buffer.   */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+
+#include <string.h>
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#define JX_DIGEST_CRC_HARDWARE 1
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define JX_DIGEST_CRC_HARDWARE 1
+#else
+#define JX_DIGEST_CRC_HARDWARE 0
+#endif
+
+#define JX_DIGEST_CRC_SIZE      4U
+#define JX_DIGEST_SHA256_SIZE   32U
+#define JX_DIGEST_BLOCK_SIZE    64U
+
+/* Reflected CRC-32C table for polynomial 0x82F63B78, one byte per step. */
+static const uint32_t jx_digest_crc_table[256] =
+{
+    0x00000000U, 0xF26B8303U, 0xE13B70F7U, 0x1350F3F4U, 0xC79A971FU, 0x35F1141CU,
+    0x26A1E7E8U, 0xD4CA64EBU, 0x8AD958CFU, 0x78B2DBCCU, 0x6BE22838U, 0x9989AB3BU,
+    0x4D43CFD0U, 0xBF284CD3U, 0xAC78BF27U, 0x5E133C24U, 0x105EC76FU, 0xE235446CU,
+    0xF165B798U, 0x030E349BU, 0xD7C45070U, 0x25AFD373U, 0x36FF2087U, 0xC494A384U,
+    0x9A879FA0U, 0x68EC1CA3U, 0x7BBCEF57U, 0x89D76C54U, 0x5D1D08BFU, 0xAF768BBCU,
+    0xBC267848U, 0x4E4DFB4BU, 0x20BD8EDEU, 0xD2D60DDDU, 0xC186FE29U, 0x33ED7D2AU,
+    0xE72719C1U, 0x154C9AC2U, 0x061C6936U, 0xF477EA35U, 0xAA64D611U, 0x580F5512U,
+    0x4B5FA6E6U, 0xB93425E5U, 0x6DFE410EU, 0x9F95C20DU, 0x8CC531F9U, 0x7EAEB2FAU,
+    0x30E349B1U, 0xC288CAB2U, 0xD1D83946U, 0x23B3BA45U, 0xF779DEAEU, 0x05125DADU,
+    0x1642AE59U, 0xE4292D5AU, 0xBA3A117EU, 0x4851927DU, 0x5B016189U, 0xA96AE28AU,
+    0x7DA08661U, 0x8FCB0562U, 0x9C9BF696U, 0x6EF07595U, 0x417B1DBCU, 0xB3109EBFU,
+    0xA0406D4BU, 0x522BEE48U, 0x86E18AA3U, 0x748A09A0U, 0x67DAFA54U, 0x95B17957U,
+    0xCBA24573U, 0x39C9C670U, 0x2A993584U, 0xD8F2B687U, 0x0C38D26CU, 0xFE53516FU,
+    0xED03A29BU, 0x1F682198U, 0x5125DAD3U, 0xA34E59D0U, 0xB01EAA24U, 0x42752927U,
+    0x96BF4DCCU, 0x64D4CECFU, 0x77843D3BU, 0x85EFBE38U, 0xDBFC821CU, 0x2997011FU,
+    0x3AC7F2EBU, 0xC8AC71E8U, 0x1C661503U, 0xEE0D9600U, 0xFD5D65F4U, 0x0F36E6F7U,
+    0x61C69362U, 0x93AD1061U, 0x80FDE395U, 0x72966096U, 0xA65C047DU, 0x5437877EU,
+    0x4767748AU, 0xB50CF789U, 0xEB1FCBADU, 0x197448AEU, 0x0A24BB5AU, 0xF84F3859U,
+    0x2C855CB2U, 0xDEEEDFB1U, 0xCDBE2C45U, 0x3FD5AF46U, 0x7198540DU, 0x83F3D70EU,
+    0x90A324FAU, 0x62C8A7F9U, 0xB602C312U, 0x44694011U, 0x5739B3E5U, 0xA55230E6U,
+    0xFB410CC2U, 0x092A8FC1U, 0x1A7A7C35U, 0xE811FF36U, 0x3CDB9BDDU, 0xCEB018DEU,
+    0xDDE0EB2AU, 0x2F8B6829U, 0x82F63B78U, 0x709DB87BU, 0x63CD4B8FU, 0x91A6C88CU,
+    0x456CAC67U, 0xB7072F64U, 0xA457DC90U, 0x563C5F93U, 0x082F63B7U, 0xFA44E0B4U,
+    0xE9141340U, 0x1B7F9043U, 0xCFB5F4A8U, 0x3DDE77ABU, 0x2E8E845FU, 0xDCE5075CU,
+    0x92A8FC17U, 0x60C37F14U, 0x73938CE0U, 0x81F80FE3U, 0x55326B08U, 0xA759E80BU,
+    0xB4091BFFU, 0x466298FCU, 0x1871A4D8U, 0xEA1A27DBU, 0xF94AD42FU, 0x0B21572CU,
+    0xDFEB33C7U, 0x2D80B0C4U, 0x3ED04330U, 0xCCBBC033U, 0xA24BB5A6U, 0x502036A5U,
+    0x4370C551U, 0xB11B4652U, 0x65D122B9U, 0x97BAA1BAU, 0x84EA524EU, 0x7681D14DU,
+    0x2892ED69U, 0xDAF96E6AU, 0xC9A99D9EU, 0x3BC21E9DU, 0xEF087A76U, 0x1D63F975U,
+    0x0E330A81U, 0xFC588982U, 0xB21572C9U, 0x407EF1CAU, 0x532E023EU, 0xA145813DU,
+    0x758FE5D6U, 0x87E466D5U, 0x94B49521U, 0x66DF1622U, 0x38CC2A06U, 0xCAA7A905U,
+    0xD9F75AF1U, 0x2B9CD9F2U, 0xFF56BD19U, 0x0D3D3E1AU, 0x1E6DCDEEU, 0xEC064EEDU,
+    0xC38D26C4U, 0x31E6A5C7U, 0x22B65633U, 0xD0DDD530U, 0x0417B1DBU, 0xF67C32D8U,
+    0xE52CC12CU, 0x1747422FU, 0x49547E0BU, 0xBB3FFD08U, 0xA86F0EFCU, 0x5A048DFFU,
+    0x8ECEE914U, 0x7CA56A17U, 0x6FF599E3U, 0x9D9E1AE0U, 0xD3D3E1ABU, 0x21B862A8U,
+    0x32E8915CU, 0xC083125FU, 0x144976B4U, 0xE622F5B7U, 0xF5720643U, 0x07198540U,
+    0x590AB964U, 0xAB613A67U, 0xB831C993U, 0x4A5A4A90U, 0x9E902E7BU, 0x6CFBAD78U,
+    0x7FAB5E8CU, 0x8DC0DD8FU, 0xE330A81AU, 0x115B2B19U, 0x020BD8EDU, 0xF0605BEEU,
+    0x24AA3F05U, 0xD6C1BC06U, 0xC5914FF2U, 0x37FACCF1U, 0x69E9F0D5U, 0x9B8273D6U,
+    0x88D28022U, 0x7AB90321U, 0xAE7367CAU, 0x5C18E4C9U, 0x4F48173DU, 0xBD23943EU,
+    0xF36E6F75U, 0x0105EC76U, 0x12551F82U, 0xE03E9C81U, 0x34F4F86AU, 0xC69F7B69U,
+    0xD5CF889DU, 0x27A40B9EU, 0x79B737BAU, 0x8BDCB4B9U, 0x988C474DU, 0x6AE7C44EU,
+    0xBE2DA0A5U, 0x4C4623A6U, 0x5F16D052U, 0xAD7D5351U
+};
+
+static const uint32_t jx_digest_sha256_init[8] =
+{
+    0x6A09E667U, 0xBB67AE85U, 0x3C6EF372U, 0xA54FF53AU,
+    0x510E527FU, 0x9B05688CU, 0x1F83D9ABU, 0x5BE0CD19U
+};
+
+static const uint32_t jx_digest_sha256_k[64] =
+{
+    0x428A2F98U, 0x71374491U, 0xB5C0FBCFU, 0xE9B5DBA5U, 0x3956C25BU, 0x59F111F1U, 0x923F82A4U, 0xAB1C5ED5U,
+    0xD807AA98U, 0x12835B01U, 0x243185BEU, 0x550C7DC3U, 0x72BE5D74U, 0x80DEB1FEU, 0x9BDC06A7U, 0xC19BF174U,
+    0xE49B69C1U, 0xEFBE4786U, 0x0FC19DC6U, 0x240CA1CCU, 0x2DE92C6FU, 0x4A7484AAU, 0x5CB0A9DCU, 0x76F988DAU,
+    0x983E5152U, 0xA831C66DU, 0xB00327C8U, 0xBF597FC7U, 0xC6E00BF3U, 0xD5A79147U, 0x06CA6351U, 0x14292967U,
+    0x27B70A85U, 0x2E1B2138U, 0x4D2C6DFCU, 0x53380D13U, 0x650A7354U, 0x766A0ABBU, 0x81C2C92EU, 0x92722C85U,
+    0xA2BFE8A1U, 0xA81A664BU, 0xC24B8B70U, 0xC76C51A3U, 0xD192E819U, 0xD6990624U, 0xF40E3585U, 0x106AA070U,
+    0x19A4C116U, 0x1E376C08U, 0x2748774CU, 0x34B0BCB5U, 0x391C0CB3U, 0x4ED8AA4AU, 0x5B9CCA4FU, 0x682E6FF3U,
+    0x748F82EEU, 0x78A5636FU, 0x84C87814U, 0x8CC70208U, 0x90BEFFFAU, 0xA4506CEBU, 0xBEF9A3F7U, 0xC67178F2U
+};
+
+/**************************************************************************/
+/*                                                                        */
+/*  CRC-32C                                                               */
+/*                                                                        */
+/**************************************************************************/
+
+/* Works on the inverted register; callers invert on entry and exit. */
+static uint32_t jx_digest_crc_update(uint32_t crc, const uint8_t *bytes, size_t length)
+{
+#if JX_DIGEST_CRC_HARDWARE
+    while (length >= sizeof(uint64_t))
+    {
+        uint64_t word;
+
+        memcpy(&word, bytes, sizeof(word));
+#if defined(__SSE4_2__)
+        crc = (uint32_t)_mm_crc32_u64(crc, word);
+#else
+        crc = __crc32cd(crc, word);
+#endif
+        bytes += sizeof(uint64_t);
+        length -= sizeof(uint64_t);
+    }
+#endif
+
+    while (length-- > 0U)
+    {
+        crc = jx_digest_crc_table[(crc ^ *bytes++) & 0xFFU] ^ (crc >> 8);
+    }
+
+    return crc;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  SHA-256                                                               */
+/*                                                                        */
+/**************************************************************************/
+
+static uint32_t jx_digest_rotr(uint32_t value, unsigned int bits)
+{
+    return (value >> bits) | (value << (32U - bits));
+}
+
+static uint32_t jx_digest_load_be32(const uint8_t *bytes)
+{
+    return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) |
+           ((uint32_t)bytes[2] << 8) | (uint32_t)bytes[3];
+}
+
+static void jx_digest_store_be32(uint8_t *bytes, uint32_t value)
+{
+    bytes[0] = (uint8_t)(value >> 24);
+    bytes[1] = (uint8_t)(value >> 16);
+    bytes[2] = (uint8_t)(value >> 8);
+    bytes[3] = (uint8_t)value;
+}
+
+static void jx_digest_sha256_block(uint32_t state[8], const uint8_t *block)
+{
+    uint32_t w[64];
+    uint32_t a = state[0];
+    uint32_t b = state[1];
+    uint32_t c = state[2];
+    uint32_t d = state[3];
+    uint32_t e = state[4];
+    uint32_t f = state[5];
+    uint32_t g = state[6];
+    uint32_t h = state[7];
+
+    for (size_t i = 0U; i < 16U; ++i)
+    {
+        w[i] = jx_digest_load_be32(&block[i * 4U]);
+    }
+
+    for (size_t i = 16U; i < 64U; ++i)
+    {
+        uint32_t s0 = jx_digest_rotr(w[i - 15U], 7U) ^ jx_digest_rotr(w[i - 15U], 18U) ^ (w[i - 15U] >> 3);
+        uint32_t s1 = jx_digest_rotr(w[i - 2U], 17U) ^ jx_digest_rotr(w[i - 2U], 19U) ^ (w[i - 2U] >> 10);
+
+        w[i] = w[i - 16U] + s0 + w[i - 7U] + s1;
+    }
+
+    for (size_t i = 0U; i < 64U; ++i)
+    {
+        uint32_t s1 = jx_digest_rotr(e, 6U) ^ jx_digest_rotr(e, 11U) ^ jx_digest_rotr(e, 25U);
+        uint32_t choice = (e & f) ^ (~e & g);
+        uint32_t t1 = h + s1 + choice + jx_digest_sha256_k[i] + w[i];
+        uint32_t s0 = jx_digest_rotr(a, 2U) ^ jx_digest_rotr(a, 13U) ^ jx_digest_rotr(a, 22U);
+        uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t t2 = s0 + majority;
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+static void jx_digest_sha256_start(JX_DIGEST *digest)
+{
+    memcpy(digest->state, jx_digest_sha256_init, sizeof(digest->state));
+    digest->length = 0U;
+}
+
+static void jx_digest_sha256_update(JX_DIGEST *digest, const uint8_t *bytes, size_t length)
+{
+    size_t used = (size_t)(digest->length % JX_DIGEST_BLOCK_SIZE);
+
+    digest->length += length;
+
+    if (used != 0U)
+    {
+        size_t take = JX_DIGEST_BLOCK_SIZE - used;
+
+        if (length < take)
+        {
+            memcpy(&digest->block[used], bytes, length);
+            return;
+        }
+
+        memcpy(&digest->block[used], bytes, take);
+        jx_digest_sha256_block(digest->state, digest->block);
+        bytes += take;
+        length -= take;
+    }
+
+    /* Whole blocks are hashed straight from the caller's data. */
+    while (length >= JX_DIGEST_BLOCK_SIZE)
+    {
+        jx_digest_sha256_block(digest->state, bytes);
+        bytes += JX_DIGEST_BLOCK_SIZE;
+        length -= JX_DIGEST_BLOCK_SIZE;
+    }
+
+    memcpy(digest->block, bytes, length);
+}
+
+static void jx_digest_sha256_finish(JX_DIGEST *digest, uint8_t out[JX_DIGEST_SHA256_SIZE])
+{
+    static const uint8_t padding[JX_DIGEST_BLOCK_SIZE] = { 0x80U };
+    uint64_t bits = digest->length * 8U;
+    size_t used = (size_t)(digest->length % JX_DIGEST_BLOCK_SIZE);
+    uint8_t trailer[8];
+
+    for (size_t i = 0U; i < sizeof(trailer); ++i)
+    {
+        trailer[i] = (uint8_t)(bits >> (56U - (i * 8U)));
+    }
+
+    /* Pad with 0x80 and zeros up to 56 bytes into a block, then the bit length. */
+    jx_digest_sha256_update(digest, padding,
+                            (used < 56U) ? (56U - used) : ((JX_DIGEST_BLOCK_SIZE + 56U) - used));
+    jx_digest_sha256_update(digest, trailer, sizeof(trailer));
+
+    for (size_t i = 0U; i < 8U; ++i)
+    {
+        jx_digest_store_be32(&out[i * 4U], digest->state[i]);
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  Public API                                                            */
+/*                                                                        */
+/**************************************************************************/
+
+uint32_t jx_crc32c(uint32_t crc, const void *data, size_t length)
+{
+    if ((data == NULL) && (length != 0U))
+    {
+        return crc;
+    }
+
+    return ~jx_digest_crc_update(~crc, (const uint8_t *)data, length);
+}
+
+JX_STATUS jx_digest_init(JX_DIGEST *digest,
+                         JX_DIGEST_KIND kind,
+                         const uint8_t *key,
+                         size_t key_length,
+                         JX_SINK_FN next,
+                         void *next_context)
+{
+    uint8_t inner_pad[JX_DIGEST_BLOCK_SIZE];
+
+    if ((digest == NULL) || (kind > JX_DIGEST_HMAC_SHA256) ||
+        ((kind == JX_DIGEST_HMAC_SHA256) && (key == NULL) && (key_length != 0U)))
+    {
+        return JX_ERROR;
+    }
+
+    memset(digest, 0, sizeof(JX_DIGEST));
+    digest->kind = kind;
+    digest->next = next;
+    digest->next_context = next_context;
+
+    if (kind == JX_DIGEST_CRC32C)
+    {
+        digest->crc = 0xFFFFFFFFU;
+        return JX_SUCCESS;
+    }
+
+    jx_digest_sha256_start(digest);
+    if (kind == JX_DIGEST_SHA256)
+    {
+        return JX_SUCCESS;
+    }
+
+    /* Keys longer than a block are replaced by their hash (RFC 2104). */
+    memset(inner_pad, 0, sizeof(inner_pad));
+    if (key_length > JX_DIGEST_BLOCK_SIZE)
+    {
+        jx_digest_sha256_update(digest, key, key_length);
+        jx_digest_sha256_finish(digest, inner_pad);
+        jx_digest_sha256_start(digest);
+    }
+    else if (key_length != 0U)
+    {
+        memcpy(inner_pad, key, key_length);
+    }
+
+    for (size_t i = 0U; i < JX_DIGEST_BLOCK_SIZE; ++i)
+    {
+        digest->outer_pad[i] = (uint8_t)(inner_pad[i] ^ 0x5CU);
+        inner_pad[i] ^= 0x36U;
+    }
+
+    jx_digest_sha256_update(digest, inner_pad, sizeof(inner_pad));
+    memset(inner_pad, 0, sizeof(inner_pad));
+    return JX_SUCCESS;
+}
+
+void jx_digest_update(JX_DIGEST *digest, const void *data, size_t length)
+{
+    if ((digest == NULL) || (data == NULL) || (length == 0U))
+    {
+        return;
+    }
+
+    if (digest->kind == JX_DIGEST_CRC32C)
+    {
+        digest->crc = jx_digest_crc_update(digest->crc, (const uint8_t *)data, length);
+    }
+    else
+    {
+        jx_digest_sha256_update(digest, (const uint8_t *)data, length);
+    }
+}
+
+bool jx_digest_sink(void *context, const char *data, size_t length)
+{
+    JX_DIGEST *digest = (JX_DIGEST *)context;
+
+    if (digest == NULL)
+    {
+        return false;
+    }
+
+    jx_digest_update(digest, data, length);
+    return (digest->next == NULL) || digest->next(digest->next_context, data, length);
+}
+
+size_t jx_digest_final(JX_DIGEST *digest, uint8_t *out, size_t out_size)
+{
+    uint8_t inner[JX_DIGEST_SHA256_SIZE];
+
+    if ((digest == NULL) || (out == NULL))
+    {
+        return 0U;
+    }
+
+    if (digest->kind == JX_DIGEST_CRC32C)
+    {
+        if (out_size < JX_DIGEST_CRC_SIZE)
+        {
+            return 0U;
+        }
+
+        jx_digest_store_be32(out, ~digest->crc);
+        return JX_DIGEST_CRC_SIZE;
+    }
+
+    if (out_size < JX_DIGEST_SHA256_SIZE)
+    {
+        return 0U;
+    }
+
+    if (digest->kind == JX_DIGEST_SHA256)
+    {
+        jx_digest_sha256_finish(digest, out);
+        return JX_DIGEST_SHA256_SIZE;
+    }
+
+    jx_digest_sha256_finish(digest, inner);
+    jx_digest_sha256_start(digest);
+    jx_digest_sha256_update(digest, digest->outer_pad, sizeof(digest->outer_pad));
+    jx_digest_sha256_update(digest, inner, sizeof(inner));
+    jx_digest_sha256_finish(digest, out);
+    memset(digest->outer_pad, 0, sizeof(digest->outer_pad));
+    return JX_DIGEST_SHA256_SIZE;
+}
@@ -0,0 +1,160 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_double_buffer.c                                              */
+/*  @brief Double-buffered parsing with atomic publication (JsonX)        */
+/*                                                                        */
+/*  The writer parses into the inactive copy through a relocated mapping  */
+/*  and publishes it with one atomic store. Readers pin the published     */
+/*  copy with a per-copy counter and never block.                         */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+
+#if JX_ENABLE_DOUBLE_BUFFER
+
+#include "../private/jx_atomic.h"
+#include "../private/jx_backend.h"
+
+#include <string.h>
+
+/**************************************************************************/
+/*                                                                        */
+/*  Private Helpers                                                       */
+/*                                                                        */
+/**************************************************************************/
+
+/*
+ * Array lengths live in the mapping rather than in either copy, and record
+ * arrays cannot be relocated, so mappings containing them are refused.
+ */
+static bool jx_double_buffer_mapping_supported(const JX_ELEMENT *element, size_t element_size)
+{
+    for (size_t i = 0U; i < element_size; ++i)
+    {
+        if ((element[i].type == JX_ARRAY) || (element[i].type == JX_RECORD_ARRAY))
+        {
+            return false;
+        }
+
+        if ((element[i].type == JX_OBJECT) && (element[i].element != NULL) &&
+            (!jx_double_buffer_mapping_supported(element[i].element, element[i].value_len)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  Double Buffer API                                                     */
+/*                                                                        */
+/**************************************************************************/
+
+JX_STATUS jx_double_buffer_init(JX_DOUBLE_BUFFER *buffer,
+                                void *primary,
+                                void *secondary,
+                                size_t slot_size,
+                                JX_ELEMENT *element,
+                                size_t element_size)
+{
+    if ((!buffer) || (!primary) || (!secondary) || (primary == secondary) ||
+        (slot_size == 0U) || (!element) || (element_size == 0U) ||
+        (!jx_double_buffer_mapping_supported(element, element_size)))
+    {
+        return JX_ERROR;
+    }
+
+    memset(buffer, 0, sizeof(JX_DOUBLE_BUFFER));
+    buffer->slot[0]      = (uint8_t *)primary;
+    buffer->slot[1]      = (uint8_t *)secondary;
+    buffer->slot_size    = slot_size;
+    buffer->element      = element;
+    buffer->element_size = element_size;
+    memcpy(secondary, primary, slot_size);
+    jx_atomic_store_size(&buffer->active, 0U);
+    return JX_SUCCESS;
+}
+
+JX_STATUS jx_double_buffer_parse(JX_DOUBLE_BUFFER *buffer, char *json, JX_PARSE_MODE mode)
+{
+    JX_BACKEND_RELOCATION relocation;
+    size_t active;
+    size_t inactive;
+
+    if ((!buffer) || (!json) || ((mode != JX_MODE_RELAXED) && (mode != JX_MODE_STRICT) && (mode != JX_MODE_TRUSTED)))
+    {
+        return JX_ERROR;
+    }
+
+    active = jx_atomic_load_size(&buffer->active);
+    inactive = active ^ 1U;
+
+    /* Pairs with the fence in acquire: a reader that pinned the old copy is seen here. */
+    jx_atomic_fence();
+    if (jx_atomic_load_size(&buffer->readers[inactive]) != 0U)
+    {
+        return JX_ERROR;
+    }
+
+    memcpy(buffer->slot[inactive], buffer->slot[active], buffer->slot_size);
+
+    relocation.source = buffer->slot[0];
+    relocation.target = buffer->slot[inactive];
+    relocation.size   = buffer->slot_size;
+    if (jx_backend_parse_relocated(json, buffer->element, buffer->element_size, mode,
+                                   &buffer->context.error_ptr, &relocation) != JX_SUCCESS)
+    {
+        return JX_ERROR;
+    }
+
+    jx_atomic_store_size(&buffer->active, inactive);
+    return JX_SUCCESS;
+}
+
+const void *jx_double_buffer_acquire(JX_DOUBLE_BUFFER *buffer)
+{
+    if (buffer == NULL)
+    {
+        return NULL;
+    }
+
+    for (;;)
+    {
+        size_t active = jx_atomic_load_size(&buffer->active);
+
+        (void)jx_atomic_add_size(&buffer->readers[active], 1U);
+        jx_atomic_fence();
+
+        /* The writer may have switched copies before the pin became visible. */
+        if (jx_atomic_load_size(&buffer->active) == active)
+        {
+            return buffer->slot[active];
+        }
+
+        (void)jx_atomic_sub_size(&buffer->readers[active], 1U);
+    }
+}
+
+void jx_double_buffer_release(JX_DOUBLE_BUFFER *buffer, const void *slot)
+{
+    if ((buffer == NULL) || (slot == NULL))
+    {
+        return;
+    }
+
+    for (size_t i = 0U; i < 2U; ++i)
+    {
+        if (slot == buffer->slot[i])
+        {
+            (void)jx_atomic_sub_size(&buffer->readers[i], 1U);
+            return;
+        }
+    }
+}
+
+#endif /* JX_ENABLE_DOUBLE_BUFFER */
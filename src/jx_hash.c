@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_hash.c                                                       */
+/*  @brief Document hashing and change detection (JsonX)                 */
+/*                                                                        */
+/*  A 64-bit multiply-rotate hash over four independent lanes, so long    */
+/*  documents are not limited by one multiply chain.                      */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "../private/jx_backend.h"
+
+#include <string.h>
+
+#define JX_HASH_PRIME_1     0x9E3779B185EBCA87ULL
+#define JX_HASH_PRIME_2     0xC2B2AE3D27D4EB4FULL
+#define JX_HASH_PRIME_3     0x165667B19E3779F9ULL
+#define JX_HASH_LANES       4U
+
+/**************************************************************************/
+/*                                                                        */
+/*  Local Functions                                                       */
+/*                                                                        */
+/**************************************************************************/
+
+static uint64_t jx_hash_rotate(uint64_t value, unsigned int bits)
+{
+    return (value << bits) | (value >> (64U - bits));
+}
+
+static uint64_t jx_hash_round(uint64_t lane, uint64_t word)
+{
+    return jx_hash_rotate(lane ^ (word * JX_HASH_PRIME_2), 31U) * JX_HASH_PRIME_1;
+}
+
+static uint64_t jx_hash_load(const uint8_t *bytes, size_t length)
+{
+    uint64_t word = 0U;
+
+    memcpy(&word, bytes, length);
+    return word;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  Public API                                                            */
+/*                                                                        */
+/**************************************************************************/
+
+uint64_t jx_hash(const void *data, size_t length)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint64_t lanes[JX_HASH_LANES] =
+    {
+        JX_HASH_PRIME_1, JX_HASH_PRIME_2, JX_HASH_PRIME_3, JX_HASH_PRIME_1 ^ JX_HASH_PRIME_2
+    };
+    uint64_t hash = (uint64_t)length * JX_HASH_PRIME_3;
+
+    if ((data == NULL) && (length != 0U))
+    {
+        return 0U;
+    }
+
+    while (length >= (JX_HASH_LANES * sizeof(uint64_t)))
+    {
+        for (size_t i = 0U; i < JX_HASH_LANES; ++i)
+        {
+            lanes[i] = jx_hash_round(lanes[i], jx_hash_load(bytes, sizeof(uint64_t)));
+            bytes += sizeof(uint64_t);
+        }
+        length -= JX_HASH_LANES * sizeof(uint64_t);
+    }
+
+    for (size_t i = 0U; i < JX_HASH_LANES; ++i)
+    {
+        hash = jx_hash_round(hash, lanes[i]);
+    }
+
+    while (length >= sizeof(uint64_t))
+    {
+        hash = jx_hash_round(hash, jx_hash_load(bytes, sizeof(uint64_t)));
+        bytes += sizeof(uint64_t);
+        length -= sizeof(uint64_t);
+    }
+
+    if (length != 0U)
+    {
+        hash = jx_hash_round(hash, jx_hash_load(bytes, length));
+    }
+
+    /* Final avalanche so every input bit reaches every output bit. */
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+JX_STATUS jx_json_equals_struct(const char *json, JX_ELEMENT *element, size_t element_size, bool *equal)
+{
+    if ((!json) || (!element) || (element_size == 0U) || (!equal))
+    {
+        return JX_ERROR;
+    }
+
+    return jx_backend_compare_elements(json, element, element_size, equal);
+}
+
+JX_STATUS jx_context_json_to_struct_if_changed(JX_CONTEXT *context,
+                                               JX_APPLIED *applied,
+                                               char *buffer,
+                                               JX_ELEMENT *element,
+                                               size_t element_size,
+                                               JX_PARSE_MODE mode,
+                                               bool *changed)
+{
+    JX_STATUS status;
+    uint64_t hash;
+
+    if ((!context) || (!applied) || (!buffer))
+    {
+        return JX_ERROR;
+    }
+
+    hash = jx_hash(buffer, strlen(buffer));
+    if (applied->valid && (applied->hash == hash))
+    {
+        context->error_ptr = NULL;
+        if (changed)
+        {
+            *changed = false;
+        }
+        return JX_SUCCESS;
+    }
+
+    /* A failed parse may have applied part of the document. */
+    applied->valid = false;
+    status = jx_context_json_to_struct(context, buffer, element, element_size, mode);
+    if (status == JX_SUCCESS)
+    {
+        applied->hash = hash;
+        applied->valid = true;
+    }
+
+    if (changed)
+    {
+        *changed = (status == JX_SUCCESS);
+    }
+    return status;
+}
@@ -12,6 +12,7 @@
 
 #include "../private/jx_backend.h"
 #include "../private/jx_internal.h"
+#include "../private/jx_utf8.h"
 
 #include <string.h>
 
@@ -21,8 +22,68 @@ typedef struct
     const char *cursor;
     const char *error;
     uint8_t depth;
+    bool trusted;
+    bool compare;       /* Compare values with the mapping instead of storing them */
+    bool differs;       /* A compared value differs from the mapping */
+    bool validate_only; /* Nothing is decoded: JX_VALIDATE_MAX_DEPTH applies and \u0000 is allowed */
+    const JX_BACKEND_RELOCATION *relocation;
+    JX_SHAPE *shape;            /* Shape being recorded, or NULL */
+    const char *shape_copied;   /* Document bytes before this are in the skeleton */
 } JX_NATIVE_READER;
 
+/* Assign a parsed value, or only note whether it differs when comparing. */
+#define JX_NATIVE_ASSIGN(_reader, _lvalue, _value)                             \
+    do                                                                         \
+    {                                                                          \
+        if ((_reader)->compare)                                                \
+        {                                                                      \
+            if ((_lvalue) != (_value))                                         \
+            {                                                                  \
+                (_reader)->differs = true;                                     \
+            }                                                                  \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+            (_lvalue) = (_value);                                              \
+        }                                                                      \
+    } while (0)
+
+/* Mark an element as parsed; a comparison leaves the mapping untouched. */
+#define JX_NATIVE_MARK(_reader, _element)                                      \
+    do                                                                         \
+    {                                                                          \
+        if (!(_reader)->compare)                                               \
+        {                                                                      \
+            jx_set_updated(_element);                                          \
+        }                                                                      \
+    } while (0)
+
+/* Shape steps: a value slot, a skipped member, an array item mark, a record
+ * template status clear and a container close. */
+#define JX_NATIVE_SHAPE_VALUE       0U
+#define JX_NATIVE_SHAPE_SKIP        1U
+#define JX_NATIVE_SHAPE_MARK        2U
+#define JX_NATIVE_SHAPE_CLEAR       3U
+#define JX_NATIVE_SHAPE_CLOSE       4U
+
+/* Record a shape step when a shape is being recorded. */
+#define JX_NATIVE_SHAPE_STEP(_reader, _kind, _element, _count)                 \
+    do                                                                         \
+    {                                                                          \
+        if ((_reader)->shape != NULL)                                          \
+        {                                                                      \
+            jx_native_shape_step((_reader), (_kind), (_element), (_count));    \
+        }                                                                      \
+    } while (0)
+
+/* Store a parsed value through the (possibly relocated) mapping target. */
+#define JX_NATIVE_STORE(_reader, _element, _type, _value)                      \
+    do                                                                         \
+    {                                                                          \
+        JX_NATIVE_ASSIGN((_reader), *((_type *)jx_native_target((_reader), (_element))), (_value)); \
+        JX_NATIVE_MARK((_reader), (_element));                                 \
+    } while (0)
+
 typedef struct
 {
     char *buffer;
@@ -30,11 +91,51 @@ typedef struct
     size_t pos;
     bool formatted;
     bool failed;
+    JX_SINK_FN sink;
+    void *sink_context;
+    const uint8_t *snapshot;
+    size_t snapshot_pos;
+    const JX_BACKEND_RELOCATION *relocation;
+    const JX_ELEMENT *range_element;
+    size_t range_first;
+    size_t range_count;
+    bool range_seen;
+    bool muted;
+    bool ascii;
+    bool aliases;
+    bool columns;
 } JX_NATIVE_WRITER;
 
+/* SWAR helpers: each byte lane of a 64-bit word is tested independently. */
+#define JX_NATIVE_LANES(_byte)          ((uint64_t)(_byte) * 0x0101010101010101ULL)
+#define JX_NATIVE_HAS_ZERO(_word)       ((((_word) - JX_NATIVE_LANES(0x01U)) & ~(_word) & JX_NATIVE_LANES(0x80U)) != 0U)
+#define JX_NATIVE_HAS_BELOW(_word, _n)  ((((_word) - JX_NATIVE_LANES(_n)) & ~(_word) & JX_NATIVE_LANES(0x80U)) != 0U)
+
+/* Bytes that end a plain string run: quote, backslash, control and non-ASCII bytes. */
+static const uint8_t jx_native_string_stop[256] =
+{
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
 static const char *jx_native_error_ptr = NULL;
 
 static void jx_native_writer_putc(JX_NATIVE_WRITER *writer, char c);
+static bool jx_native_writer_flush(JX_NATIVE_WRITER *writer);
 static void jx_native_writer_puts(JX_NATIVE_WRITER *writer, const char *text);
 static bool jx_native_set_error(JX_NATIVE_READER *reader);
 static bool jx_native_write_elements(JX_NATIVE_WRITER *writer,
@@ -43,13 +144,16 @@ static bool jx_native_write_elements(JX_NATIVE_WRITER *writer,
                                      uint8_t depth,
                                      bool object_context);
 static bool jx_native_write_element_value(JX_NATIVE_WRITER *writer, JX_ELEMENT *element, uint8_t depth);
+static bool jx_native_write_records(JX_NATIVE_WRITER *writer, JX_ELEMENT *element, uint8_t depth);
+static bool jx_native_write_item_stream(JX_NATIVE_WRITER *writer, JX_ELEMENT *element, uint8_t depth);
 static bool jx_native_enter_container(JX_NATIVE_READER *reader);
 static bool jx_native_skip_value(JX_NATIVE_READER *reader);
 static bool jx_native_skip_string(JX_NATIVE_READER *reader);
 static bool jx_native_skip_number(JX_NATIVE_READER *reader);
 static bool jx_native_skip_object(JX_NATIVE_READER *reader);
 static bool jx_native_skip_array(JX_NATIVE_READER *reader);
-static bool jx_native_parse_string_into_buffer(JX_NATIVE_READER *reader, char *buffer, size_t buffer_size);
+static bool jx_native_parse_string_into_buffer(JX_NATIVE_READER *reader, char *buffer, size_t buffer_size, bool compare);
+static bool jx_native_parse_string_stream(JX_NATIVE_READER *reader, JX_STRING_STREAM *stream);
 #if JX_ENABLE_DOUBLE
 static bool jx_native_parse_number_value(JX_NATIVE_READER *reader, double *value);
 #endif
@@ -58,9 +162,13 @@ static bool jx_native_parse_i32_value(JX_NATIVE_READER *reader, int32_t *value);
 static bool jx_native_parse_u64_value(JX_NATIVE_READER *reader, uint64_t *value);
 static bool jx_native_parse_i64_value(JX_NATIVE_READER *reader, int64_t *value);
 static JX_ELEMENT *jx_native_find_element(JX_ELEMENT *elements, size_t element_count, const char *property);
-static JX_STATUS jx_native_handle_type_mismatch(JX_ELEMENT *element, JX_PARSE_MODE mode);
+static JX_STATUS jx_native_handle_type_mismatch(JX_NATIVE_READER *reader, JX_ELEMENT *element, JX_PARSE_MODE mode);
 static JX_STATUS jx_native_parse_element_value(JX_NATIVE_READER *reader, JX_ELEMENT *element, JX_PARSE_MODE mode);
+static void jx_native_shape_step(JX_NATIVE_READER *reader, uint8_t kind, JX_ELEMENT *element, size_t count);
 static JX_STATUS jx_native_parse_array_into_elements(JX_NATIVE_READER *reader, JX_ELEMENT *element, JX_PARSE_MODE mode);
+static JX_STATUS jx_native_parse_records(JX_NATIVE_READER *reader, JX_ELEMENT *element, JX_PARSE_MODE mode);
+static JX_STATUS jx_native_parse_columns(JX_NATIVE_READER *reader, JX_ELEMENT *element, JX_PARSE_MODE mode);
+static JX_STATUS jx_native_parse_item_stream(JX_NATIVE_READER *reader, JX_ELEMENT *element, JX_PARSE_MODE mode);
 static JX_STATUS jx_native_parse_object_into_elements(JX_NATIVE_READER *reader,
                                                       JX_ELEMENT *elements,
                                                       size_t element_count,
@@ -129,11 +237,21 @@ static bool jx_native_set_error(JX_NATIVE_READER *reader)
     return false;
 }
 
-static bool jx_native_match_literal(JX_NATIVE_READER *reader, const char *literal)
+static bool jx_native_match_literal(JX_NATIVE_READER *reader, const char *literal, size_t length)
 {
-    size_t length = strlen(literal);
-
-    if (strncmp(reader->cursor, literal, length) != 0)
+    if (reader->trusted)
+    {
+        /* Only the terminator is checked, so the cursor never passes it. */
+        for (size_t i = 1U; i < length; ++i)
+        {
+            if (reader->cursor[i] == '\0')
+            {
+                reader->cursor += i;
+                return jx_native_set_error(reader);
+            }
+        }
+    }
+    else if (strncmp(reader->cursor, literal, length) != 0)
     {
         return jx_native_set_error(reader);
     }
@@ -149,7 +267,7 @@ static bool jx_native_enter_container(JX_NATIVE_READER *reader)
         return false;
     }
 
-    if (reader->depth >= JX_MAX_NESTING_LEVEL)
+    if (reader->depth >= (reader->validate_only ? JX_VALIDATE_MAX_DEPTH : JX_MAX_NESTING_LEVEL))
     {
         return jx_native_set_error(reader);
     }
@@ -158,6 +276,21 @@ static bool jx_native_enter_container(JX_NATIVE_READER *reader)
     return true;
 }
 
+static void *jx_native_target(const JX_NATIVE_READER *reader, const JX_ELEMENT *element)
+{
+    const JX_BACKEND_RELOCATION *relocation = reader->relocation;
+    uintptr_t address = (uintptr_t)element->value_p;
+
+    if ((relocation != NULL) &&
+        (address >= (uintptr_t)relocation->source) &&
+        ((address - (uintptr_t)relocation->source) < relocation->size))
+    {
+        return relocation->target + (address - (uintptr_t)relocation->source);
+    }
+
+    return (void *)address;
+}
+
 static int jx_native_hex_value(char c)
 {
     if ((c >= '0') && (c <= '9'))
@@ -176,6 +309,78 @@ static int jx_native_hex_value(char c)
     return -1;
 }
 
+static bool jx_native_parse_hex4(JX_NATIVE_READER *reader, uint32_t *value)
+{
+    uint32_t code = 0U;
+
+    for (uint8_t i = 0U; i < 4U; ++i)
+    {
+        int hex = jx_native_hex_value(*reader->cursor);
+
+        if (hex < 0)
+        {
+            return jx_native_set_error(reader);
+        }
+        code = (code << 4) | (uint32_t)hex;
+        reader->cursor++;
+    }
+
+    *value = code;
+    return true;
+}
+
+/*
+ * Decode the escape after "\u", joining a surrogate pair into one scalar
+ * value. Lone surrogates are rejected; \u0000 is rejected because mapped
+ * strings are NUL-terminated, unless the reader only validates.
+ */
+static bool jx_native_parse_unicode_escape(JX_NATIVE_READER *reader, uint32_t *code)
+{
+    uint32_t low;
+
+    if (!jx_native_parse_hex4(reader, code))
+    {
+        return false;
+    }
+
+    if ((*code == 0U) && !reader->validate_only)
+    {
+        reader->cursor -= 4;
+        return jx_native_set_error(reader);
+    }
+
+    if ((*code >= 0xDC00U) && (*code <= 0xDFFFU))
+    {
+        reader->cursor -= 4;
+        return jx_native_set_error(reader);
+    }
+
+    if ((*code < 0xD800U) || (*code > 0xDBFFU))
+    {
+        return true;
+    }
+
+    if ((reader->cursor[0] != '\\') || (reader->cursor[1] != 'u'))
+    {
+        return jx_native_set_error(reader);
+    }
+
+    reader->cursor += 2;
+    if (!jx_native_parse_hex4(reader, &low))
+    {
+        return false;
+    }
+
+    if ((low < 0xDC00U) || (low > 0xDFFFU))
+    {
+        reader->cursor -= 4;
+        return jx_native_set_error(reader);
+    }
+
+    *code = 0x10000UL + (((*code - 0xD800U) << 10) | (low - 0xDC00U));
+    return true;
+}
+
 static bool jx_native_skip_string(JX_NATIVE_READER *reader)
 {
     if ((reader == NULL) || (*reader->cursor != '"'))
@@ -186,21 +391,47 @@ static bool jx_native_skip_string(JX_NATIVE_READER *reader)
     reader->cursor++;
     while (*reader->cursor != '\0')
     {
-        char c = *reader->cursor++;
+        char c;
+
+        while (jx_native_string_stop[(uint8_t)*reader->cursor] == 0U)
+        {
+            reader->cursor++;
+        }
+
+        if (*reader->cursor == '\0')
+        {
+            break;
+        }
 
+        c = *reader->cursor++;
         if (c == '"')
         {
             return true;
         }
 
-        if ((unsigned char)c < 0x20U)
+        if (((unsigned char)c < 0x20U) && !reader->trusted)
         {
             reader->cursor--;
             return jx_native_set_error(reader);
         }
 
+        if (((unsigned char)c >= 0x80U) && !reader->trusted)
+        {
+            size_t sequence = jx_utf8_sequence_length((const uint8_t *)reader->cursor - 1);
+
+            if (sequence == 0U)
+            {
+                reader->cursor--;
+                return jx_native_set_error(reader);
+            }
+            reader->cursor += sequence - 1U;
+            continue;
+        }
+
         if (c == '\\')
         {
+            uint32_t code;
+
             c = *reader->cursor++;
             switch (c)
             {
@@ -215,12 +446,9 @@ static bool jx_native_skip_string(JX_NATIVE_READER *reader)
                 break;
 
             case 'u':
-                for (uint8_t i = 0U; i < 4U; ++i)
+                if (!jx_native_parse_unicode_escape(reader, &code))
                 {
-                    if (jx_native_hex_value(*reader->cursor++) < 0)
-                    {
-                        return jx_native_set_error(reader);
-                    }
+                    return false;
                 }
                 break;
 
@@ -234,7 +462,75 @@ static bool jx_native_skip_string(JX_NATIVE_READER *reader)
     return jx_native_set_error(reader);
 }
 
-static bool jx_native_parse_string_into_buffer(JX_NATIVE_READER *reader, char *buffer, size_t buffer_size)
+/* Decodes the escape after a backslash into at most four bytes. */
+static bool jx_native_decode_escape(JX_NATIVE_READER *reader, uint8_t *encoded, size_t *length)
+{
+    char c = *reader->cursor++;
+
+    *length = 1U;
+    switch (c)
+    {
+    case '"':
+    case '\\':
+    case '/':
+        break;
+
+    case 'b':
+        c = '\b';
+        break;
+
+    case 'f':
+        c = '\f';
+        break;
+
+    case 'n':
+        c = '\n';
+        break;
+
+    case 'r':
+        c = '\r';
+        break;
+
+    case 't':
+        c = '\t';
+        break;
+
+    case 'u':
+    {
+        uint32_t code;
+
+        if (!jx_native_parse_unicode_escape(reader, &code))
+        {
+            return false;
+        }
+
+        *length = jx_utf8_encode(code, encoded);
+        return true;
+    }
+
+    default:
+        reader->cursor--;
+        return jx_native_set_error(reader);
+    }
+
+    encoded[0] = (uint8_t)c;
+    return true;
+}
+
+/* Emit decoded string bytes, or compare them with the mapped string. */
+static void jx_native_string_put(JX_NATIVE_READER *reader, bool compare, char *write, const void *data, size_t length)
+{
+    if (!compare)
+    {
+        memcpy(write, data, length);
+    }
+    else if (!reader->differs && (memcmp(write, data, length) != 0))
+    {
+        reader->differs = true;
+    }
+}
+
+static bool jx_native_parse_string_into_buffer(JX_NATIVE_READER *reader, char *buffer, size_t buffer_size, bool compare)
 {
     char *write;
     size_t remaining;
@@ -250,84 +546,216 @@ static bool jx_native_parse_string_into_buffer(JX_NATIVE_READER *reader, char *b
 
     while (*reader->cursor != '\0')
     {
-        char c = *reader->cursor++;
+        char c;
+
+        /* Copy the plain run up to the next byte that needs attention in one step. */
+        {
+            const char *run = reader->cursor;
+            size_t length;
+
+            while (jx_native_string_stop[(uint8_t)*run] == 0U)
+            {
+                run++;
+            }
+
+            length = (size_t)(run - reader->cursor);
+            if (length >= remaining)
+            {
+                return jx_native_set_error(reader);
+            }
+
+            jx_native_string_put(reader, compare, write, reader->cursor, length);
+            write += length;
+            remaining -= length;
+            reader->cursor = run;
+            if (*run == '\0')
+            {
+                break;
+            }
+        }
+
+        c = *reader->cursor++;
 
         if (c == '"')
         {
-            *write = '\0';
+            jx_native_string_put(reader, compare, write, "", 1U);
             return true;
         }
 
-        if ((unsigned char)c < 0x20U)
+        if (((unsigned char)c < 0x20U) && !reader->trusted)
         {
             reader->cursor--;
             return jx_native_set_error(reader);
         }
 
+        /* Multi-byte sequences are validated and copied whole. */
+        if (((unsigned char)c >= 0x80U) && !reader->trusted)
+        {
+            size_t sequence = jx_utf8_sequence_length((const uint8_t *)reader->cursor - 1);
+
+            if (sequence == 0U)
+            {
+                reader->cursor--;
+                return jx_native_set_error(reader);
+            }
+            if (remaining <= sequence)
+            {
+                return jx_native_set_error(reader);
+            }
+
+            jx_native_string_put(reader, compare, write, reader->cursor - 1, sequence);
+            write += sequence;
+            remaining -= sequence;
+            reader->cursor += sequence - 1U;
+            continue;
+        }
+
         if (c == '\\')
         {
-            c = *reader->cursor++;
-            switch (c)
+            uint8_t encoded[4];
+            size_t length;
+
+            if (!jx_native_decode_escape(reader, encoded, &length))
             {
-            case '"':
-            case '\\':
-            case '/':
-                break;
+                return false;
+            }
 
-            case 'b':
-                c = '\b';
-                break;
+            if (remaining <= length)
+            {
+                return jx_native_set_error(reader);
+            }
 
-            case 'f':
-                c = '\f';
-                break;
+            jx_native_string_put(reader, compare, write, encoded, length);
+            write += length;
+            remaining -= length;
+            continue;
+        }
 
-            case 'n':
-                c = '\n';
-                break;
+        if (remaining <= 1U)
+        {
+            return jx_native_set_error(reader);
+        }
 
-            case 'r':
-                c = '\r';
-                break;
+        jx_native_string_put(reader, compare, write++, &c, 1U);
+        remaining--;
+    }
 
-            case 't':
-                c = '\t';
-                break;
+    return jx_native_set_error(reader);
+}
 
-            case 'u':
+/* Hands the collected chunk of a streamed string to its sink. */
+static bool jx_native_stream_flush(JX_NATIVE_READER *reader, JX_STRING_STREAM *stream, const char *chunk,
+                                   size_t *used)
+{
+    if ((*used > 0U) && (stream->sink != NULL) && !stream->sink(stream->sink_context, chunk, *used))
+    {
+        return jx_native_set_error(reader);
+    }
+
+    stream->length += *used;
+    *used = 0U;
+    return true;
+}
+
+/*
+ * Decodes a string through a fixed chunk into the stream sink. A multi-byte
+ * sequence never straddles two chunks, so every chunk is valid UTF-8.
+ */
+static bool jx_native_parse_string_stream(JX_NATIVE_READER *reader, JX_STRING_STREAM *stream)
+{
+    char chunk[JX_STRING_STREAM_CHUNK];
+    size_t used = 0U;
+
+    /* The sink keeps no copy to compare against, so streamed text always counts as a change. */
+    if (reader->compare)
+    {
+        reader->differs = true;
+        return jx_native_skip_string(reader);
+    }
+
+    stream->length = 0U;
+    reader->cursor++;
+    while (*reader->cursor != '\0')
+    {
+        const uint8_t *bytes;
+        uint8_t encoded[4];
+        size_t length;
+        char c;
+
+        /* Plain runs fill the chunk in bulk; they are ASCII, so any cut is safe. */
+        for (;;)
+        {
+            const char *run = reader->cursor;
+            size_t room = sizeof(chunk) - used;
+
+            while ((jx_native_string_stop[(uint8_t)*run] == 0U) && ((size_t)(run - reader->cursor) < room))
             {
-                int code = 0;
+                run++;
+            }
 
-                for (uint8_t i = 0U; i < 4U; ++i)
-                {
-                    int hex = jx_native_hex_value(*reader->cursor++);
-                    if (hex < 0)
-                    {
-                        return jx_native_set_error(reader);
-                    }
-                    code = (code << 4) | hex;
-                }
-                if ((code <= 0x1F) || (code > 0x7F))
-                {
-                    return jx_native_set_error(reader);
-                }
-                c = (char)code;
+            length = (size_t)(run - reader->cursor);
+            memcpy(&chunk[used], reader->cursor, length);
+            used += length;
+            reader->cursor = run;
+            if (jx_native_string_stop[(uint8_t)*run] != 0U)
+            {
                 break;
             }
+            if (!jx_native_stream_flush(reader, stream, chunk, &used))
+            {
+                return false;
+            }
+        }
 
-            default:
+        if (*reader->cursor == '\0')
+        {
+            break;
+        }
+
+        c = *reader->cursor++;
+        if (c == '"')
+        {
+            return jx_native_stream_flush(reader, stream, chunk, &used);
+        }
+
+        if (((unsigned char)c < 0x20U) && !reader->trusted)
+        {
+            reader->cursor--;
+            return jx_native_set_error(reader);
+        }
+
+        if ((unsigned char)c >= 0x80U)
+        {
+            bytes = (const uint8_t *)reader->cursor - 1;
+            length = jx_utf8_sequence_length(bytes);
+            if ((length == 0U) && !reader->trusted)
+            {
                 reader->cursor--;
                 return jx_native_set_error(reader);
             }
+            length = (length == 0U) ? 1U : length;
+            reader->cursor += length - 1U;
         }
-
-        if (remaining <= 1U)
+        else if (c == '\\')
         {
-            return jx_native_set_error(reader);
+            if (!jx_native_decode_escape(reader, encoded, &length))
+            {
+                return false;
+            }
+            bytes = encoded;
+        }
+        else
+        {
+            bytes = (const uint8_t *)reader->cursor - 1;
+            length = 1U;
         }
 
-        *write++ = c;
-        remaining--;
+        if (((used + length) > sizeof(chunk)) && !jx_native_stream_flush(reader, stream, chunk, &used))
+        {
+            return false;
+        }
+        memcpy(&chunk[used], bytes, length);
+        used += length;
     }
 
     return jx_native_set_error(reader);
@@ -344,6 +772,19 @@ static bool jx_native_skip_number(JX_NATIVE_READER *reader)
     }
 
     cursor = reader->cursor;
+    if (reader->trusted)
+    {
+        while (((*cursor >= '0') && (*cursor <= '9')) ||
+               (*cursor == '-') || (*cursor == '+') || (*cursor == '.') ||
+               (*cursor == 'e') || (*cursor == 'E'))
+        {
+            cursor++;
+        }
+
+        reader->cursor = cursor;
+        return true;
+    }
+
     if (*cursor == '-')
     {
         cursor++;
@@ -561,7 +1002,7 @@ static bool jx_native_parse_unsigned_integer(JX_NATIVE_READER *reader,
     }
 
     cursor = reader->cursor;
-    if (*cursor == '0')
+    if ((*cursor == '0') && !reader->trusted)
     {
         has_digit = true;
         cursor++;
@@ -595,7 +1036,8 @@ static bool jx_native_parse_unsigned_integer(JX_NATIVE_READER *reader,
         return jx_native_set_error(reader);
     }
 
-    if ((*cursor == '.') || (*cursor == 'e') || (*cursor == 'E'))
+    /* Fractions and exponents still stop at the next delimiter check. */
+    if (((*cursor == '.') || (*cursor == 'e') || (*cursor == 'E')) && !reader->trusted)
     {
         reader->cursor = cursor;
         return jx_native_set_error(reader);
@@ -851,13 +1293,13 @@ static bool jx_native_skip_value(JX_NATIVE_READER *reader)
         return jx_native_skip_string(reader);
 
     case 't':
-        return jx_native_match_literal(reader, "true");
+        return jx_native_match_literal(reader, "true", 4U);
 
     case 'f':
-        return jx_native_match_literal(reader, "false");
+        return jx_native_match_literal(reader, "false", 5U);
 
     case 'n':
-        return jx_native_match_literal(reader, "null");
+        return jx_native_match_literal(reader, "null", 4U);
 
     default:
         if ((*reader->cursor == '-') || ((*reader->cursor >= '0') && (*reader->cursor <= '9')))
@@ -868,35 +1310,171 @@ static bool jx_native_skip_value(JX_NATIVE_READER *reader)
     }
 }
 
-static JX_ELEMENT *jx_native_find_element(JX_ELEMENT *elements, size_t element_count, const char *property)
+/* Short name stored by JX_ALIAS() after the full name's terminator, or NULL. */
+static const char *jx_native_alias(const JX_ELEMENT *element)
 {
-    if ((elements == NULL) || (property == NULL))
+    const char *name = element->property;
+    const char *end = memchr(name, '\0', JX_PROPERTY_MAX_SIZE);
+    size_t remaining;
+
+    if (end == NULL)
+    {
+        return NULL;
+    }
+
+    /* Only JX_ALIAS() writes the mark, so stale bytes after a copied name are ignored. */
+    end++;
+    remaining = JX_PROPERTY_MAX_SIZE - (size_t)(end - name);
+    if ((remaining < 2U) || (end[0] != JX_ALIAS_MARK[0]) || (end[1] == '\0') ||
+        (memchr(&end[1], '\0', remaining - 1U) == NULL))
+    {
+        return NULL;
+    }
+
+    return &end[1];
+}
+
+static JX_ELEMENT *jx_native_find_element(JX_ELEMENT *elements, size_t element_count, const char *property)
+{
+    if ((elements == NULL) || (property == NULL))
     {
         return NULL;
     }
 
+    /* Full name and alias are checked in the same pass over the mapping. */
     for (size_t i = 0U; i < element_count; ++i)
     {
+        const char *alias;
+
         if (strncmp(elements[i].property, property, JX_PROPERTY_MAX_SIZE) == 0)
         {
             return &elements[i];
         }
+
+        alias = jx_native_alias(&elements[i]);
+        if ((alias != NULL) && (strcmp(alias, property) == 0))
+        {
+            return &elements[i];
+        }
     }
 
     return NULL;
 }
 
-static JX_STATUS jx_native_handle_type_mismatch(JX_ELEMENT *element, JX_PARSE_MODE mode)
+static JX_STATUS jx_native_handle_type_mismatch(JX_NATIVE_READER *reader, JX_ELEMENT *element, JX_PARSE_MODE mode)
 {
     if ((element == NULL) || (mode == JX_MODE_STRICT))
     {
         return JX_ERROR;
     }
 
-    jx_clear_status(element);
+    if (!reader->compare)
+    {
+        jx_clear_status(element);
+    }
     return JX_SUCCESS;
 }
 
+/* True when parsing element from a value starting with c descends into a container. */
+static bool jx_native_shape_descends(const JX_ELEMENT *element, char c)
+{
+    switch (element->type)
+    {
+    case JX_OBJECT:
+        return (c == '{') && (element->element != NULL);
+    case JX_ARRAY:
+        return c == '[';
+    case JX_RECORD_ARRAY:
+        return (c == '[') || (c == '{');
+    default:
+        return false;
+    }
+}
+
+/*
+ * Appends the document bytes since the last step to the skeleton. A shape
+ * that runs out of room stops recording and stays invalid; the parse itself
+ * goes on.
+ */
+static bool jx_native_shape_copy(JX_NATIVE_READER *reader)
+{
+    JX_SHAPE *shape = reader->shape;
+    size_t length = (size_t)(reader->cursor - reader->shape_copied);
+
+    if (length > (shape->skeleton_size - shape->skeleton_length))
+    {
+        reader->shape = NULL;
+        return false;
+    }
+
+    memcpy(&shape->skeleton[shape->skeleton_length], reader->shape_copied, length);
+    shape->skeleton_length += length;
+    reader->shape_copied = reader->cursor;
+    return true;
+}
+
+static void jx_native_shape_step(JX_NATIVE_READER *reader, uint8_t kind, JX_ELEMENT *element, size_t count)
+{
+    JX_SHAPE *shape = reader->shape;
+    JX_SHAPE_SLOT *slot;
+
+    if ((shape->slot_count >= shape->slot_capacity) || !jx_native_shape_copy(reader))
+    {
+        reader->shape = NULL;
+        return;
+    }
+
+    slot = &shape->slots[shape->slot_count++];
+    slot->element = element;
+    slot->target = ((kind == JX_NATIVE_SHAPE_VALUE) && (element != NULL)) ? jx_native_target(reader, element) : NULL;
+    slot->offset = shape->skeleton_length;
+    slot->count = count;
+    slot->kind = kind;
+}
+
+/* Skips a member the mapping does not know; a recorded shape skips it too. */
+static bool jx_native_skip_member(JX_NATIVE_READER *reader)
+{
+    if (reader->shape == NULL)
+    {
+        return jx_native_skip_value(reader);
+    }
+
+    jx_native_skip_ws(reader);
+    jx_native_shape_step(reader, JX_NATIVE_SHAPE_SKIP, NULL, reader->depth);
+    if (!jx_native_skip_value(reader))
+    {
+        return false;
+    }
+
+    if (reader->shape != NULL)
+    {
+        reader->shape_copied = reader->cursor;
+    }
+    return true;
+}
+
+/*
+ * Records a value that is not descended into as a value slot, keeping its
+ * bytes out of the skeleton, and parses it with recording paused.
+ */
+static JX_STATUS jx_native_shape_value(JX_NATIVE_READER *reader, JX_ELEMENT *element, JX_PARSE_MODE mode)
+{
+    JX_SHAPE *shape;
+    JX_STATUS status;
+
+    jx_native_shape_step(reader, JX_NATIVE_SHAPE_VALUE, element, reader->depth);
+    shape = reader->shape;
+    reader->shape = NULL;
+    status = jx_native_parse_element_value(reader, element, mode);
+    if (shape != NULL)
+    {
+        reader->shape = shape;
+        reader->shape_copied = reader->cursor;
+    }
+    return status;
+}
+
 static JX_STATUS jx_native_parse_element_value(JX_NATIVE_READER *reader, JX_ELEMENT *element, JX_PARSE_MODE mode)
 {
     if ((reader == NULL) || (element == NULL))
@@ -906,45 +1484,41 @@ static JX_STATUS jx_native_parse_element_value(JX_NATIVE_READER *reader, JX_ELEM
 
     jx_native_skip_ws(reader);
 
+    if ((reader->shape != NULL) && !jx_native_shape_descends(element, *reader->cursor))
+    {
+        return jx_native_shape_value(reader, element, mode);
+    }
+
     switch (element->type)
     {
     case JX_NULL:
-        if (strncmp(reader->cursor, "null", 4U) == 0)
+        if ((*reader->cursor == 'n') && jx_native_match_literal(reader, "null", 4U))
         {
-            reader->cursor += 4U;
-            jx_set_updated(element);
+            JX_NATIVE_MARK(reader, element);
             return JX_SUCCESS;
         }
         if (jx_native_skip_value(reader))
         {
-            return jx_native_handle_type_mismatch(element, mode);
+            return jx_native_handle_type_mismatch(reader, element, mode);
         }
         return JX_ERROR;
 
     case JX_BOOLEAN:
-        if (strncmp(reader->cursor, "true", 4U) == 0)
+        if ((*reader->cursor == 't') || (*reader->cursor == 'f'))
         {
-            if (element->value_p == NULL)
-            {
-                return JX_ERROR;
-            }
-            reader->cursor += 4U;
-            jx_set_bool(element, true);
-            return JX_SUCCESS;
-        }
-        if (strncmp(reader->cursor, "false", 5U) == 0)
-        {
-            if (element->value_p == NULL)
+            bool value = (*reader->cursor == 't');
+
+            if ((element->value_p == NULL) ||
+                !jx_native_match_literal(reader, value ? "true" : "false", value ? 4U : 5U))
             {
                 return JX_ERROR;
             }
-            reader->cursor += 5U;
-            jx_set_bool(element, false);
+            JX_NATIVE_STORE(reader, element, bool, value);
             return JX_SUCCESS;
         }
         if (jx_native_skip_value(reader))
         {
-            return jx_native_handle_type_mismatch(element, mode);
+            return jx_native_handle_type_mismatch(reader, element, mode);
         }
         return JX_ERROR;
 
@@ -962,17 +1536,17 @@ static JX_STATUS jx_native_parse_element_value(JX_NATIVE_READER *reader, JX_ELEM
             {
                 return JX_ERROR;
             }
-            jx_set_number(element, value);
+            JX_NATIVE_STORE(reader, element, double, value);
             return JX_SUCCESS;
         }
         if (jx_native_skip_value(reader))
         {
-            return jx_native_handle_type_mismatch(element, mode);
+            return jx_native_handle_type_mismatch(reader, element, mode);
         }
 #else
         if (jx_native_skip_value(reader))
         {
-            return jx_native_handle_type_mismatch(element, JX_MODE_STRICT);
+            return jx_native_handle_type_mismatch(reader, element, JX_MODE_STRICT);
         }
 #endif
         return JX_ERROR;
@@ -990,12 +1564,12 @@ static JX_STATUS jx_native_parse_element_value(JX_NATIVE_READER *reader, JX_ELEM
             {
                 return JX_ERROR;
             }
-            jx_set_u32(element, value);
+            JX_NATIVE_STORE(reader, element, uint32_t, value);
             return JX_SUCCESS;
         }
         if (jx_native_skip_value(reader))
         {
-            return jx_native_handle_type_mismatch(element, mode);
+            return jx_native_handle_type_mismatch(reader, element, mode);
         }
         return JX_ERROR;
 
@@ -1012,12 +1586,12 @@ static JX_STATUS jx_native_parse_element_value(JX_NATIVE_READER *reader, JX_ELEM
             {
                 return JX_ERROR;
             }
-            jx_set_i32(element, value);
+            JX_NATIVE_STORE(reader, element, int32_t, value);
             return JX_SUCCESS;
         }
         if (jx_native_skip_value(reader))
         {
-            return jx_native_handle_type_mismatch(element, mode);
+            return jx_native_handle_type_mismatch(reader, element, mode);
         }
         return JX_ERROR;
 
@@ -1034,12 +1608,12 @@ static JX_STATUS jx_native_parse_element_value(JX_NATIVE_READER *reader, JX_ELEM
             {
                 return JX_ERROR;
             }
-            jx_set_u64(element, value);
+            JX_NATIVE_STORE(reader, element, uint64_t, value);
             return JX_SUCCESS;
         }
         if (jx_native_skip_value(reader))
         {
-            return jx_native_handle_type_mismatch(element, mode);
+            return jx_native_handle_type_mismatch(reader, element, mode);
         }
         return JX_ERROR;
 
@@ -1056,12 +1630,12 @@ static JX_STATUS jx_native_parse_element_value(JX_NATIVE_READER *reader, JX_ELEM
             {
                 return JX_ERROR;
             }
-            jx_set_i64(element, value);
+            JX_NATIVE_STORE(reader, element, int64_t, value);
             return JX_SUCCESS;
         }
         if (jx_native_skip_value(reader))
         {
-            return jx_native_handle_type_mismatch(element, mode);
+            return jx_native_handle_type_mismatch(reader, element, mode);
         }
         return JX_ERROR;
 
@@ -1076,16 +1650,38 @@ static JX_STATUS jx_native_parse_element_value(JX_NATIVE_READER *reader, JX_ELEM
             }
 
             capacity = (element->value_capacity != 0U) ? element->value_capacity : JX_PROPERTY_MAX_SIZE;
-            if (!jx_native_parse_string_into_buffer(reader, (char *)(uintptr_t)element->value_p, capacity))
+            if (!jx_native_parse_string_into_buffer(reader, (char *)jx_native_target(reader, element), capacity,
+                                                    reader->compare))
             {
                 return JX_ERROR;
             }
-            jx_set_updated(element);
+            JX_NATIVE_MARK(reader, element);
+            return JX_SUCCESS;
+        }
+        if (jx_native_skip_value(reader))
+        {
+            return jx_native_handle_type_mismatch(reader, element, mode);
+        }
+        return JX_ERROR;
+
+    case JX_STREAMED_STRING:
+        if (*reader->cursor == '"')
+        {
+            if (element->value_p == NULL)
+            {
+                return JX_ERROR;
+            }
+
+            if (!jx_native_parse_string_stream(reader, (JX_STRING_STREAM *)jx_native_target(reader, element)))
+            {
+                return JX_ERROR;
+            }
+            JX_NATIVE_MARK(reader, element);
             return JX_SUCCESS;
         }
         if (jx_native_skip_value(reader))
         {
-            return jx_native_handle_type_mismatch(element, mode);
+            return jx_native_handle_type_mismatch(reader, element, mode);
         }
         return JX_ERROR;
 
@@ -1104,12 +1700,13 @@ static JX_STATUS jx_native_parse_element_value(JX_NATIVE_READER *reader, JX_ELEM
                 return JX_ERROR;
             }
 
-            jx_set_updated(element);
+            JX_NATIVE_MARK(reader, element);
+            JX_NATIVE_SHAPE_STEP(reader, JX_NATIVE_SHAPE_CLOSE, element, 0U);
             return JX_SUCCESS;
         }
         if (jx_native_skip_value(reader))
         {
-            return jx_native_handle_type_mismatch(element, mode);
+            return jx_native_handle_type_mismatch(reader, element, mode);
         }
         return JX_ERROR;
 
@@ -1120,14 +1717,40 @@ static JX_STATUS jx_native_parse_element_value(JX_NATIVE_READER *reader, JX_ELEM
         }
         if (jx_native_skip_value(reader))
         {
-            return jx_native_handle_type_mismatch(element, mode);
+            return jx_native_handle_type_mismatch(reader, element, mode);
+        }
+        return JX_ERROR;
+
+    case JX_STREAMED_ARRAY:
+        if (*reader->cursor == '[')
+        {
+            return jx_native_parse_item_stream(reader, element, mode);
+        }
+        if (jx_native_skip_value(reader))
+        {
+            return jx_native_handle_type_mismatch(reader, element, mode);
+        }
+        return JX_ERROR;
+
+    case JX_RECORD_ARRAY:
+        if (*reader->cursor == '[')
+        {
+            return jx_native_parse_records(reader, element, mode);
+        }
+        if (*reader->cursor == '{')
+        {
+            return jx_native_parse_columns(reader, element, mode);
+        }
+        if (jx_native_skip_value(reader))
+        {
+            return jx_native_handle_type_mismatch(reader, element, mode);
         }
         return JX_ERROR;
 
     default:
         if (jx_native_skip_value(reader))
         {
-            return jx_native_handle_type_mismatch(element, mode);
+            return jx_native_handle_type_mismatch(reader, element, mode);
         }
         return JX_ERROR;
     }
@@ -1161,8 +1784,9 @@ static JX_STATUS jx_native_parse_array_into_elements(JX_NATIVE_READER *reader, J
     {
         reader->cursor++;
         reader->depth--;
-        element->value_len = 0U;
-        jx_set_updated(element);
+        JX_NATIVE_ASSIGN(reader, element->value_len, 0U);
+        JX_NATIVE_MARK(reader, element);
+        JX_NATIVE_SHAPE_STEP(reader, JX_NATIVE_SHAPE_CLOSE, element, 0U);
         return JX_SUCCESS;
     }
 
@@ -1183,7 +1807,8 @@ static JX_STATUS jx_native_parse_array_into_elements(JX_NATIVE_READER *reader, J
             return JX_ERROR;
         }
 
-        jx_set_updated(item);
+        JX_NATIVE_MARK(reader, item);
+        JX_NATIVE_SHAPE_STEP(reader, JX_NATIVE_SHAPE_MARK, item, 0U);
         parsed_count++;
 
         jx_native_skip_ws(reader);
@@ -1191,8 +1816,101 @@ static JX_STATUS jx_native_parse_array_into_elements(JX_NATIVE_READER *reader, J
         {
             reader->cursor++;
             reader->depth--;
-            element->value_len = parsed_count;
-            jx_set_updated(element);
+            JX_NATIVE_ASSIGN(reader, element->value_len, parsed_count);
+            JX_NATIVE_MARK(reader, element);
+            JX_NATIVE_SHAPE_STEP(reader, JX_NATIVE_SHAPE_CLOSE, element, parsed_count);
+            return JX_SUCCESS;
+        }
+
+        if (*reader->cursor != ',')
+        {
+            reader->depth--;
+            jx_native_set_error(reader);
+            return JX_ERROR;
+        }
+
+        reader->cursor++;
+        jx_native_skip_ws(reader);
+    }
+
+    reader->depth--;
+    jx_native_set_error(reader);
+    return JX_ERROR;
+}
+
+/*
+ * Record arrays parse each object through the template bound to the first
+ * record, relocated to the record being filled.
+ */
+static JX_STATUS jx_native_parse_records(JX_NATIVE_READER *reader, JX_ELEMENT *element, JX_PARSE_MODE mode)
+{
+    JX_RECORDS *records = (JX_RECORDS *)(uintptr_t)element->value_p;
+    JX_BACKEND_RELOCATION relocation;
+    size_t count = 0U;
+
+    if ((records == NULL) || (records->records == NULL) || (records->stride == 0U) ||
+        (element->element == NULL) || (reader->relocation != NULL))
+    {
+        return JX_ERROR;
+    }
+
+    if (!jx_native_enter_container(reader))
+    {
+        return JX_ERROR;
+    }
+
+    reader->cursor++;
+    jx_native_skip_ws(reader);
+
+    if (*reader->cursor == ']')
+    {
+        reader->cursor++;
+        reader->depth--;
+        JX_NATIVE_ASSIGN(reader, records->count, 0U);
+        JX_NATIVE_MARK(reader, element);
+        JX_NATIVE_SHAPE_STEP(reader, JX_NATIVE_SHAPE_CLOSE, element, 0U);
+        return JX_SUCCESS;
+    }
+
+    relocation.source = (const uint8_t *)records->records;
+    relocation.size = records->stride;
+
+    while (*reader->cursor != '\0')
+    {
+        JX_STATUS status;
+
+        if (count >= records->capacity)
+        {
+            reader->depth--;
+            return JX_ERROR;
+        }
+
+        JX_NATIVE_SHAPE_STEP(reader, JX_NATIVE_SHAPE_CLEAR, element, 0U);
+        for (size_t i = 0U; (i < element->value_len) && !reader->compare; ++i)
+        {
+            jx_clear_status(&element->element[i]);
+        }
+
+        relocation.target = (uint8_t *)records->records + (count * records->stride);
+        reader->relocation = &relocation;
+        status = jx_native_parse_object_into_elements(reader, element->element, element->value_len, mode);
+        reader->relocation = NULL;
+        if (status != JX_SUCCESS)
+        {
+            reader->depth--;
+            return JX_ERROR;
+        }
+
+        count++;
+
+        jx_native_skip_ws(reader);
+        if (*reader->cursor == ']')
+        {
+            reader->cursor++;
+            reader->depth--;
+            JX_NATIVE_ASSIGN(reader, records->count, count);
+            JX_NATIVE_MARK(reader, element);
+            JX_NATIVE_SHAPE_STEP(reader, JX_NATIVE_SHAPE_CLOSE, element, count);
             return JX_SUCCESS;
         }
 
@@ -1212,6 +1930,109 @@ static JX_STATUS jx_native_parse_array_into_elements(JX_NATIVE_READER *reader, J
     return JX_ERROR;
 }
 
+/* A template of one unnamed entry maps scalar items; any other maps object members. */
+static bool jx_native_item_scalar(const JX_ELEMENT *element)
+{
+    return (element->value_len == 1U) && (element->element[0].property[0] == '\0');
+}
+
+/*
+ * Parses an array one item at a time into the item template and hands each
+ * item to the consume callback before the next one overwrites it. Template
+ * storage is never relocated: it holds one item wherever the array sits.
+ */
+static JX_STATUS jx_native_parse_item_stream(JX_NATIVE_READER *reader, JX_ELEMENT *element, JX_PARSE_MODE mode)
+{
+    const JX_BACKEND_RELOCATION *relocation = reader->relocation;
+    JX_ITEM_STREAM *stream;
+    JX_STATUS status = JX_ERROR;
+    size_t count = 0U;
+
+    if ((element->value_p == NULL) || (element->element == NULL) || (element->value_len == 0U))
+    {
+        return JX_ERROR;
+    }
+
+    /* Delivered items are gone, so there is nothing to compare against: always a change. */
+    if (reader->compare)
+    {
+        reader->differs = true;
+        return jx_native_skip_array(reader) ? JX_SUCCESS : JX_ERROR;
+    }
+
+    if (!jx_native_enter_container(reader))
+    {
+        return JX_ERROR;
+    }
+
+    stream = (JX_ITEM_STREAM *)jx_native_target(reader, element);
+    reader->relocation = NULL;
+    reader->cursor++;
+    jx_native_skip_ws(reader);
+
+    if (*reader->cursor == ']')
+    {
+        reader->cursor++;
+        status = JX_SUCCESS;
+    }
+
+    while ((status != JX_SUCCESS) && (*reader->cursor != '\0'))
+    {
+        JX_STATUS item;
+
+        for (size_t i = 0U; i < element->value_len; ++i)
+        {
+            jx_clear_status(&element->element[i]);
+        }
+
+        item = jx_native_item_scalar(element) ?
+               jx_native_parse_element_value(reader, &element->element[0], mode) :
+               jx_native_parse_object_into_elements(reader, element->element, element->value_len, mode);
+        if (item != JX_SUCCESS)
+        {
+            break;
+        }
+
+        if ((stream->consume != NULL) && !stream->consume(stream->context, count))
+        {
+            jx_native_set_error(reader);
+            break;
+        }
+        count++;
+
+        jx_native_skip_ws(reader);
+        if (*reader->cursor == ']')
+        {
+            reader->cursor++;
+            status = JX_SUCCESS;
+        }
+        else if (*reader->cursor == ',')
+        {
+            reader->cursor++;
+            jx_native_skip_ws(reader);
+        }
+        else
+        {
+            jx_native_set_error(reader);
+            break;
+        }
+    }
+
+    if (status != JX_SUCCESS)
+    {
+        jx_native_set_error(reader);
+    }
+
+    reader->relocation = relocation;
+    reader->depth--;
+    stream->count = count;
+    if (status == JX_SUCCESS)
+    {
+        JX_NATIVE_MARK(reader, element);
+    }
+    return status;
+}
+
 static JX_STATUS jx_native_parse_object_into_elements(JX_NATIVE_READER *reader,
                                                       JX_ELEMENT *elements,
                                                       size_t element_count,
@@ -1242,7 +2063,7 @@ static JX_STATUS jx_native_parse_object_into_elements(JX_NATIVE_READER *reader,
         char property[JX_PROPERTY_MAX_SIZE];
         JX_ELEMENT *element;
 
-        if (!jx_native_parse_string_into_buffer(reader, property, sizeof(property)))
+        if (!jx_native_parse_string_into_buffer(reader, property, sizeof(property), false))
         {
             reader->depth--;
             return JX_ERROR;
@@ -1260,7 +2081,7 @@ static JX_STATUS jx_native_parse_object_into_elements(JX_NATIVE_READER *reader,
         element = jx_native_find_element(elements, element_count, property);
         if (element == NULL)
         {
-            if (!jx_native_skip_value(reader))
+            if (!jx_native_skip_member(reader))
             {
                 reader->depth--;
                 return JX_ERROR;
@@ -1310,432 +2131,2212 @@ check_required:
     return JX_SUCCESS;
 }
 
-static void jx_native_writer_putc(JX_NATIVE_WRITER *writer, char c)
+/* Skips whitespace, then requires and consumes c. */
+static bool jx_native_expect(JX_NATIVE_READER *reader, char c)
 {
-    if ((writer == NULL) || writer->failed)
-    {
-        return;
-    }
-
-    if ((writer->pos + 1U) >= writer->size)
+    jx_native_skip_ws(reader);
+    if (*reader->cursor != c)
     {
-        writer->failed = true;
-        return;
+        return jx_native_set_error(reader);
     }
 
-    writer->buffer[writer->pos++] = c;
-    writer->buffer[writer->pos] = '\0';
+    reader->cursor++;
+    jx_native_skip_ws(reader);
+    return true;
 }
 
-static void jx_native_writer_puts(JX_NATIVE_WRITER *writer, const char *text)
+/*
+ * Reads the "cols" member of a columnar record array into template indices.
+ * Names the template does not know map to JX_NATIVE_COLUMN_UNKNOWN and their
+ * values are skipped.
+ */
+#define JX_NATIVE_COLUMN_UNKNOWN    UINT8_MAX
+
+static bool jx_native_parse_column_names(JX_NATIVE_READER *reader,
+                                         const JX_ELEMENT *element,
+                                         uint8_t *columns,
+                                         size_t *column_count)
 {
-    if (text == NULL)
+    size_t count = 0U;
+
+    if (!jx_native_expect(reader, '['))
     {
-        return;
+        return false;
     }
 
-    while (*text != '\0')
+    while (*reader->cursor != ']')
     {
-        jx_native_writer_putc(writer, *text++);
+        char property[JX_PROPERTY_MAX_SIZE];
+        JX_ELEMENT *column;
+
+        if ((count != 0U) && !jx_native_expect(reader, ','))
+        {
+            return false;
+        }
+        if (count >= JX_MAX_RECORD_COLUMNS)
+        {
+            return jx_native_set_error(reader);
+        }
+        if (!jx_native_parse_string_into_buffer(reader, property, sizeof(property), false))
+        {
+            return false;
+        }
+
+        column = jx_native_find_element(element->element, element->value_len, property);
+        columns[count++] = (column != NULL) ? (uint8_t)(column - element->element) : JX_NATIVE_COLUMN_UNKNOWN;
+        jx_native_skip_ws(reader);
     }
+
+    reader->cursor++;
+    *column_count = count;
+    return true;
 }
 
-static void jx_native_writer_indent(JX_NATIVE_WRITER *writer, uint8_t depth)
+/* One row of a columnar record array, parsed into the relocated template. */
+static JX_STATUS jx_native_parse_row(JX_NATIVE_READER *reader,
+                                     JX_ELEMENT *element,
+                                     const uint8_t *columns,
+                                     size_t column_count,
+                                     JX_PARSE_MODE mode)
 {
-    if (!writer->formatted)
+    if (*reader->cursor != '[')
     {
-        return;
+        jx_native_set_error(reader);
+        return JX_ERROR;
     }
 
-    jx_native_writer_putc(writer, '\n');
-    for (uint8_t i = 0U; i < depth; ++i)
+    if (!jx_native_enter_container(reader))
     {
-        jx_native_writer_puts(writer, "\t");
+        return JX_ERROR;
     }
-}
 
-static bool jx_native_print_string(JX_NATIVE_WRITER *writer, const char *value)
-{
-    jx_native_writer_putc(writer, '"');
-    if (value != NULL)
+    reader->cursor++;
+    for (size_t i = 0U; i < column_count; ++i)
     {
-        while (*value != '\0')
+        JX_STATUS status;
+
+        if ((i != 0U) && !jx_native_expect(reader, ','))
         {
-            switch (*value)
-            {
-            case '"':
-                jx_native_writer_puts(writer, "\\\"");
-                break;
-            case '\\':
-                jx_native_writer_puts(writer, "\\\\");
-                break;
-            case '\b':
-                jx_native_writer_puts(writer, "\\b");
-                break;
-            case '\f':
-                jx_native_writer_puts(writer, "\\f");
-                break;
-            case '\n':
-                jx_native_writer_puts(writer, "\\n");
-                break;
-            case '\r':
-                jx_native_writer_puts(writer, "\\r");
-                break;
-            case '\t':
-                jx_native_writer_puts(writer, "\\t");
-                break;
-            default:
-                if ((unsigned char)*value < 0x20U)
-                {
-                    writer->failed = true;
-                    return false;
-                }
-                jx_native_writer_putc(writer, *value);
-                break;
-            }
-            value++;
+            reader->depth--;
+            return JX_ERROR;
         }
-    }
-    jx_native_writer_putc(writer, '"');
-    return !writer->failed;
-}
-
-static void jx_native_print_unsigned(JX_NATIVE_WRITER *writer, uint64_t value)
-{
-    char digits[20];
-    size_t count = 0U;
+        jx_native_skip_ws(reader);
 
-    do
-    {
-        digits[count++] = (char)('0' + (value % 10U));
-        value /= 10U;
-    } while ((value != 0U) && (count < sizeof(digits)));
+        if (columns[i] == JX_NATIVE_COLUMN_UNKNOWN)
+        {
+            status = jx_native_skip_member(reader) ? JX_SUCCESS : JX_ERROR;
+        }
+        else
+        {
+            status = jx_native_parse_element_value(reader, &element->element[columns[i]], mode);
+        }
 
-    while (count > 0U)
-    {
-        jx_native_writer_putc(writer, digits[--count]);
+        if (status != JX_SUCCESS)
+        {
+            reader->depth--;
+            return JX_ERROR;
+        }
     }
+
+    reader->depth--;
+    return jx_native_expect(reader, ']') ? JX_SUCCESS : JX_ERROR;
 }
 
-static void jx_native_print_signed(JX_NATIVE_WRITER *writer, int64_t value)
+/*
+ * Columnar record arrays: {"cols":[names],"rows":[[values],...]}. The wrapper
+ * counts as the array level and each row as a record, so nesting limits match
+ * the array-of-objects form. Keys are matched once per column instead of once
+ * per record.
+ */
+static JX_STATUS jx_native_parse_columns(JX_NATIVE_READER *reader, JX_ELEMENT *element, JX_PARSE_MODE mode)
 {
-    uint64_t magnitude;
+    JX_RECORDS *records = (JX_RECORDS *)(uintptr_t)element->value_p;
+    JX_BACKEND_RELOCATION relocation;
+    uint8_t columns[JX_MAX_RECORD_COLUMNS];
+    size_t column_count = 0U;
+    size_t count = 0U;
 
-    if (value < 0)
-    {
-        jx_native_writer_putc(writer, '-');
-        magnitude = (uint64_t)(-(value + 1)) + 1U;
-    }
-    else
+    if ((records == NULL) || (records->records == NULL) || (records->stride == 0U) ||
+        (element->element == NULL) || (reader->relocation != NULL))
     {
-        magnitude = (uint64_t)value;
+        return JX_ERROR;
     }
 
-    jx_native_print_unsigned(writer, magnitude);
-}
-
-#if JX_ENABLE_DOUBLE
-static bool jx_native_print_number(JX_NATIVE_WRITER *writer, double value)
-{
-    uint64_t integer_part;
-    double fraction;
-
-    if (value < 0.0)
+    if (!jx_native_enter_container(reader))
     {
-        jx_native_writer_putc(writer, '-');
-        value = -value;
+        return JX_ERROR;
     }
 
-    if (value > 18446744073709551615.0)
+    reader->cursor++;
+    jx_native_skip_ws(reader);
+    if (!jx_native_match_literal(reader, "\"cols\"", 6U) || !jx_native_expect(reader, ':') ||
+        !jx_native_parse_column_names(reader, element, columns, &column_count) ||
+        !jx_native_expect(reader, ',') ||
+        !jx_native_match_literal(reader, "\"rows\"", 6U) || !jx_native_expect(reader, ':') ||
+        !jx_native_expect(reader, '['))
     {
-        return false;
+        reader->depth--;
+        return JX_ERROR;
     }
 
-    integer_part = (uint64_t)value;
-    fraction = value - (double)integer_part;
-    jx_native_print_unsigned(writer, integer_part);
-
-    if (fraction > 0.0000005)
+    /* A strict parse needs every template member, so every one needs a column. */
+    if (mode == JX_MODE_STRICT)
     {
-        char fractional_digits[6];
-        int last_non_zero = -1;
-
-        jx_native_writer_putc(writer, '.');
-        for (uint8_t i = 0U; i < sizeof(fractional_digits); ++i)
+        for (size_t i = 0U; i < element->value_len; ++i)
         {
-            int digit;
+            bool present = false;
 
-            fraction *= 10.0;
-            digit = (int)fraction;
-            if (digit < 0)
+            for (size_t j = 0U; (j < column_count) && !present; ++j)
             {
-                digit = 0;
-            }
-            if (digit > 9)
-            {
-                digit = 9;
+                present = (columns[j] == i);
             }
-            fractional_digits[i] = (char)('0' + digit);
-            if (digit != 0)
+            if (!present)
             {
-                last_non_zero = (int)i;
+                reader->depth--;
+                return JX_ERROR;
             }
-            fraction -= (double)digit;
         }
+    }
 
-        if (last_non_zero < 0)
+    relocation.source = (const uint8_t *)records->records;
+    relocation.size = records->stride;
+
+    while (*reader->cursor != ']')
+    {
+        JX_STATUS status;
+
+        if ((count != 0U) && !jx_native_expect(reader, ','))
         {
-            jx_native_writer_putc(writer, '0');
+            reader->depth--;
+            return JX_ERROR;
         }
-        else
+        if (count >= records->capacity)
         {
-            for (int i = 0; i <= last_non_zero; ++i)
-            {
-                jx_native_writer_putc(writer, fractional_digits[i]);
-            }
+            reader->depth--;
+            return JX_ERROR;
+        }
+
+        relocation.target = (uint8_t *)records->records + (count * records->stride);
+        reader->relocation = &relocation;
+        status = jx_native_parse_row(reader, element, columns, column_count, mode);
+        reader->relocation = NULL;
+        if (status != JX_SUCCESS)
+        {
+            reader->depth--;
+            return JX_ERROR;
         }
+
+        count++;
     }
 
-    return !writer->failed;
+    reader->cursor++;
+    reader->depth--;
+    if (!jx_native_expect(reader, '}'))
+    {
+        return JX_ERROR;
+    }
+
+    JX_NATIVE_ASSIGN(reader, records->count, count);
+    JX_NATIVE_MARK(reader, element);
+    JX_NATIVE_SHAPE_STEP(reader, JX_NATIVE_SHAPE_CLOSE, element, count);
+    return JX_SUCCESS;
 }
-#endif
 
-static bool jx_native_write_elements(JX_NATIVE_WRITER *writer,
-                                     JX_ELEMENT *elements,
-                                     size_t element_count,
-                                     uint8_t depth,
-                                     bool object_context)
+/* Bytes a scalar mapping entry occupies in its target; 0 for containers and null. */
+static size_t jx_native_value_size(const JX_ELEMENT *element)
 {
-    bool first = true;
-    char open_char = object_context ? '{' : '[';
-    char close_char = object_context ? '}' : ']';
-
-    if ((writer == NULL) || ((elements == NULL) && (element_count != 0U)))
+    switch (element->type)
     {
-        return false;
+    case JX_BOOLEAN:
+        return sizeof(bool);
+    case JX_NUMBER:
+        return sizeof(double);
+    case JX_U32:
+    case JX_I32:
+        return sizeof(uint32_t);
+    case JX_U64:
+    case JX_I64:
+        return sizeof(uint64_t);
+    case JX_STRING:
+        return (element->value_capacity != 0U) ? element->value_capacity : JX_PROPERTY_MAX_SIZE;
+    default:
+        return 0U;
     }
+}
 
-    jx_native_writer_putc(writer, open_char);
+/* Snapshot slots are packed in mapping order, scalars at natural alignment. */
+static size_t jx_native_snapshot_align(size_t offset, const JX_ELEMENT *element)
+{
+    size_t align = (element->type == JX_STRING) ? 1U : jx_native_value_size(element);
+
+    return (offset + align - 1U) & ~(align - 1U);
+}
+
+static bool jx_native_snapshot_elements(const JX_ELEMENT *elements,
+                                        size_t element_count,
+                                        uint8_t *staging,
+                                        size_t staging_size,
+                                        size_t *offset)
+{
     for (size_t i = 0U; i < element_count; ++i)
     {
-        if (!first)
+        const JX_ELEMENT *element = &elements[i];
+        size_t size;
+        size_t slot;
+
+        if ((element->type == JX_OBJECT) || (element->type == JX_ARRAY))
         {
-            jx_native_writer_putc(writer, ',');
+            if (element->element == NULL)
+            {
+                if ((element->type == JX_ARRAY) && (element->value_len != 0U))
+                {
+                    return false;
+                }
+                continue;
+            }
+            if (!jx_native_snapshot_elements(element->element, element->value_len,
+                                             staging, staging_size, offset))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        if (element->type == JX_NULL)
+        {
+            continue;
         }
-        first = false;
 
-        if (writer->formatted)
+        size = jx_native_value_size(element);
+        if ((size == 0U) || (element->value_p == NULL))
         {
-            jx_native_writer_indent(writer, (uint8_t)(depth + 1U));
+            return false;
         }
 
-        if (object_context)
+        slot = jx_native_snapshot_align(*offset, element);
+        if (staging != NULL)
         {
-            if (!jx_native_print_string(writer, elements[i].property))
+            if ((slot > staging_size) || (size > (staging_size - slot)))
             {
                 return false;
             }
-            jx_native_writer_putc(writer, ':');
-            if (writer->formatted)
+            memcpy(&staging[slot], element->value_p, size);
+            if (element->type == JX_STRING)
             {
-                jx_native_writer_putc(writer, '\t');
+                staging[slot + size - 1U] = '\0';
             }
         }
+        *offset = slot + size;
+    }
 
-        if (!jx_native_write_element_value(writer, &elements[i], (uint8_t)(depth + 1U)))
+    return true;
+}
+
+/* Value of a scalar entry: the mapped target, or the next snapshot slot. */
+static const void *jx_native_writer_source(JX_NATIVE_WRITER *writer, const JX_ELEMENT *element)
+{
+    const uint8_t *value;
+
+    if (writer->snapshot == NULL)
+    {
+        const JX_BACKEND_RELOCATION *relocation = writer->relocation;
+        uintptr_t address = (uintptr_t)element->value_p;
+
+        if ((relocation != NULL) &&
+            (address >= (uintptr_t)relocation->source) &&
+            ((address - (uintptr_t)relocation->source) < relocation->size))
         {
-            return false;
+            return relocation->target + (address - (uintptr_t)relocation->source);
         }
+        return element->value_p;
+    }
+
+    writer->snapshot_pos = jx_native_snapshot_align(writer->snapshot_pos, element);
+    value = writer->snapshot + writer->snapshot_pos;
+    writer->snapshot_pos += jx_native_value_size(element);
+    return value;
+}
+
+static void jx_native_writer_set_format(JX_NATIVE_WRITER *writer, JX_FORMAT format)
+{
+    JX_FORMAT base = JX_BACKEND_FORMAT_BASE(format);
+
+    writer->formatted = (base == JX_FORMATTED) || (base == JX_FORMATTED_ASCII);
+    writer->ascii = (base == JX_MINIFIED_ASCII) || (base == JX_FORMATTED_ASCII);
+    writer->aliases = (((unsigned int)format & JX_FORMAT_ALIASES) != 0U);
+    writer->columns = (((unsigned int)format & JX_FORMAT_COLUMNS) != 0U);
+}
+
+/* Name written for a member: its JX_ALIAS() short name when aliases are requested. */
+static const char *jx_native_member_name(const JX_NATIVE_WRITER *writer, const JX_ELEMENT *element)
+{
+    const char *alias = writer->aliases ? jx_native_alias(element) : NULL;
+
+    return (alias != NULL) ? alias : element->property;
+}
+
+static void jx_native_writer_putc(JX_NATIVE_WRITER *writer, char c)
+{
+    if ((writer == NULL) || writer->failed || writer->muted)
+    {
+        return;
     }
 
-    if ((element_count != 0U) && writer->formatted)
+    if (((writer->pos + 1U) >= writer->size) && !jx_native_writer_flush(writer))
     {
-        jx_native_writer_indent(writer, depth);
+        writer->failed = true;
+        return;
     }
-    jx_native_writer_putc(writer, close_char);
-    return !writer->failed;
+
+    writer->buffer[writer->pos++] = c;
+    writer->buffer[writer->pos] = '\0';
 }
 
-static bool jx_native_write_element_value(JX_NATIVE_WRITER *writer, JX_ELEMENT *element, uint8_t depth)
+static bool jx_native_writer_flush(JX_NATIVE_WRITER *writer)
 {
-    if ((writer == NULL) || (element == NULL))
+    if (writer->sink == NULL)
     {
         return false;
     }
 
-    switch (element->type)
+    if ((writer->pos != 0U) && !writer->sink(writer->sink_context, writer->buffer, writer->pos))
     {
-    case JX_NULL:
-        jx_native_writer_puts(writer, "null");
-        break;
+        return false;
+    }
 
-    case JX_BOOLEAN:
-        if (element->value_p == NULL)
+    writer->pos = 0U;
+    writer->buffer[0] = '\0';
+    return true;
+}
+
+static void jx_native_writer_write(JX_NATIVE_WRITER *writer, const char *data, size_t length)
+{
+    if ((writer == NULL) || writer->failed || writer->muted)
+    {
+        return;
+    }
+
+    while (length != 0U)
+    {
+        size_t space = writer->size - writer->pos - 1U;
+
+        if (space == 0U)
+        {
+            if (!jx_native_writer_flush(writer))
+            {
+                writer->failed = true;
+                return;
+            }
+            continue;
+        }
+
+        if (space > length)
+        {
+            space = length;
+        }
+
+        memcpy(&writer->buffer[writer->pos], data, space);
+        writer->pos += space;
+        data += space;
+        length -= space;
+    }
+
+    writer->buffer[writer->pos] = '\0';
+}
+
+static void jx_native_writer_puts(JX_NATIVE_WRITER *writer, const char *text)
+{
+    if (text == NULL)
+    {
+        return;
+    }
+
+    while (*text != '\0')
+    {
+        jx_native_writer_putc(writer, *text++);
+    }
+}
+
+static void jx_native_writer_indent(JX_NATIVE_WRITER *writer, uint8_t depth)
+{
+    if (!writer->formatted)
+    {
+        return;
+    }
+
+    jx_native_writer_putc(writer, '\n');
+    for (uint8_t i = 0U; i < depth; ++i)
+    {
+        jx_native_writer_puts(writer, "\t");
+    }
+}
+
+/*
+ * Length of the leading run that needs no escaping. Whole 8-byte words are
+ * classified at once; @p length bounds the loads.
+ */
+static size_t jx_native_plain_run(const char *text, size_t length, bool ascii)
+{
+    size_t run = 0U;
+
+    while ((length - run) >= sizeof(uint64_t))
+    {
+        uint64_t word;
+
+        memcpy(&word, &text[run], sizeof(word));
+        if (JX_NATIVE_HAS_BELOW(word, 0x20U) ||
+            JX_NATIVE_HAS_ZERO(word ^ JX_NATIVE_LANES('"')) ||
+            JX_NATIVE_HAS_ZERO(word ^ JX_NATIVE_LANES('\\')) ||
+            (ascii && ((word & JX_NATIVE_LANES(0x80U)) != 0U)))
+        {
+            break;
+        }
+        run += sizeof(word);
+    }
+
+    while (run < length)
+    {
+        unsigned char c = (unsigned char)text[run];
+
+        if ((c < 0x20U) || (c == '"') || (c == '\\') || (ascii && (c >= 0x80U)))
+        {
+            break;
+        }
+        run++;
+    }
+
+    return run;
+}
+
+static void jx_native_print_u16_escape(JX_NATIVE_WRITER *writer, uint32_t unit)
+{
+    static const char hex[] = "0123456789abcdef";
+    char escape[6];
+
+    escape[0] = '\\';
+    escape[1] = 'u';
+    escape[2] = hex[(unit >> 12) & 0x0FU];
+    escape[3] = hex[(unit >> 8) & 0x0FU];
+    escape[4] = hex[(unit >> 4) & 0x0FU];
+    escape[5] = hex[unit & 0x0FU];
+    jx_native_writer_write(writer, escape, sizeof(escape));
+}
+
+/* Escapes string contents; @p value is NUL-terminated at @p length. */
+static bool jx_native_print_text(JX_NATIVE_WRITER *writer, const char *value, size_t length)
+{
+    size_t pos = 0U;
+
+    while (pos < length)
+    {
+        size_t run = jx_native_plain_run(&value[pos], length - pos, writer->ascii);
+        unsigned char c;
+
+        jx_native_writer_write(writer, &value[pos], run);
+        pos += run;
+        if (pos >= length)
+        {
+            break;
+        }
+
+        c = (unsigned char)value[pos];
+        switch (c)
+        {
+        case '"':
+            jx_native_writer_puts(writer, "\\\"");
+            break;
+        case '\\':
+            jx_native_writer_puts(writer, "\\\\");
+            break;
+        case '\b':
+            jx_native_writer_puts(writer, "\\b");
+            break;
+        case '\f':
+            jx_native_writer_puts(writer, "\\f");
+            break;
+        case '\n':
+            jx_native_writer_puts(writer, "\\n");
+            break;
+        case '\r':
+            jx_native_writer_puts(writer, "\\r");
+            break;
+        case '\t':
+            jx_native_writer_puts(writer, "\\t");
+            break;
+        default:
+            if (c < 0x20U)
+            {
+                jx_native_print_u16_escape(writer, c);
+                break;
+            }
+
+            /* ASCII-only output: one \u escape, or a surrogate pair above the BMP. */
+            {
+                uint32_t code;
+                size_t sequence = jx_utf8_decode((const uint8_t *)&value[pos], &code);
+
+                if (sequence == 0U)
+                {
+                    writer->failed = true;
+                    return false;
+                }
+
+                if (code >= 0x10000UL)
+                {
+                    code -= 0x10000UL;
+                    jx_native_print_u16_escape(writer, 0xD800U | (code >> 10));
+                    jx_native_print_u16_escape(writer, 0xDC00U | (code & 0x3FFU));
+                }
+                else
+                {
+                    jx_native_print_u16_escape(writer, code);
+                }
+                pos += sequence;
+                continue;
+            }
+        }
+        pos++;
+    }
+
+    return !writer->failed;
+}
+
+static bool jx_native_print_string(JX_NATIVE_WRITER *writer, const char *value)
+{
+    jx_native_writer_putc(writer, '"');
+    if (!jx_native_print_text(writer, value, (value != NULL) ? strlen(value) : 0U))
+    {
+        return false;
+    }
+
+    jx_native_writer_putc(writer, '"');
+    return !writer->failed;
+}
+
+/*
+ * Pulls a streamed string from its source one chunk at a time. A sequence cut
+ * by the chunk end is carried into the next pull so it is escaped whole.
+ */
+static bool jx_native_print_stream(JX_NATIVE_WRITER *writer, const JX_STRING_STREAM *stream)
+{
+    char chunk[JX_STRING_STREAM_CHUNK + 1U];
+    size_t carried = 0U;
+
+    if (stream->source == NULL)
+    {
+        writer->failed = true;
+        return false;
+    }
+
+    jx_native_writer_putc(writer, '"');
+    for (;;)
+    {
+        size_t length = 0U;
+        size_t complete;
+
+        if (!stream->source(stream->source_context, &chunk[carried], JX_STRING_STREAM_CHUNK - carried, &length) ||
+            (length > (JX_STRING_STREAM_CHUNK - carried)))
         {
+            writer->failed = true;
             return false;
         }
-        jx_native_writer_puts(writer, *((bool *)element->value_p) ? "true" : "false");
-        break;
 
-    case JX_NUMBER:
-#if JX_ENABLE_DOUBLE
-        if (element->value_p == NULL)
+        if (length == 0U)
+        {
+            break;
+        }
+
+        length += carried;
+        chunk[length] = '\0';
+        complete = jx_utf8_complete_length((const uint8_t *)chunk, length);
+        if (!jx_native_print_text(writer, chunk, complete))
         {
             return false;
         }
-        return jx_native_print_number(writer, *((double *)element->value_p));
-#else
+
+        carried = length - complete;
+        memmove(chunk, &chunk[complete], carried);
+    }
+
+    /* The source ended inside a sequence. */
+    if (carried != 0U)
+    {
+        writer->failed = true;
+        return false;
+    }
+
+    jx_native_writer_putc(writer, '"');
+    return !writer->failed;
+}
+
+static void jx_native_print_unsigned(JX_NATIVE_WRITER *writer, uint64_t value)
+{
+    char digits[20];
+    size_t count = 0U;
+
+    do
+    {
+        digits[count++] = (char)('0' + (value % 10U));
+        value /= 10U;
+    } while ((value != 0U) && (count < sizeof(digits)));
+
+    while (count > 0U)
+    {
+        jx_native_writer_putc(writer, digits[--count]);
+    }
+}
+
+static void jx_native_print_signed(JX_NATIVE_WRITER *writer, int64_t value)
+{
+    uint64_t magnitude;
+
+    if (value < 0)
+    {
+        jx_native_writer_putc(writer, '-');
+        magnitude = (uint64_t)(-(value + 1)) + 1U;
+    }
+    else
+    {
+        magnitude = (uint64_t)value;
+    }
+
+    jx_native_print_unsigned(writer, magnitude);
+}
+
+#if JX_ENABLE_DOUBLE
+static bool jx_native_print_number(JX_NATIVE_WRITER *writer, double value)
+{
+    uint64_t integer_part;
+    double fraction;
+
+    if (value < 0.0)
+    {
+        jx_native_writer_putc(writer, '-');
+        value = -value;
+    }
+
+    if (value > 18446744073709551615.0)
+    {
         return false;
+    }
+
+    integer_part = (uint64_t)value;
+    fraction = value - (double)integer_part;
+    jx_native_print_unsigned(writer, integer_part);
+
+    if (fraction > 0.0000005)
+    {
+        char fractional_digits[6];
+        int last_non_zero = -1;
+
+        jx_native_writer_putc(writer, '.');
+        for (uint8_t i = 0U; i < sizeof(fractional_digits); ++i)
+        {
+            int digit;
+
+            fraction *= 10.0;
+            digit = (int)fraction;
+            if (digit < 0)
+            {
+                digit = 0;
+            }
+            if (digit > 9)
+            {
+                digit = 9;
+            }
+            fractional_digits[i] = (char)('0' + digit);
+            if (digit != 0)
+            {
+                last_non_zero = (int)i;
+            }
+            fraction -= (double)digit;
+        }
+
+        if (last_non_zero < 0)
+        {
+            jx_native_writer_putc(writer, '0');
+        }
+        else
+        {
+            for (int i = 0; i <= last_non_zero; ++i)
+            {
+                jx_native_writer_putc(writer, fractional_digits[i]);
+            }
+        }
+    }
+
+    return !writer->failed;
+}
 #endif
 
-    case JX_U32:
-        if (element->value_p == NULL)
+/* Separator and indentation before a container entry; *first tracks the container. */
+static void jx_native_write_separator(JX_NATIVE_WRITER *writer, uint8_t depth, bool *first)
+{
+    if (!*first)
+    {
+        jx_native_writer_putc(writer, ',');
+    }
+    *first = false;
+
+    if (writer->formatted)
+    {
+        jx_native_writer_indent(writer, (uint8_t)(depth + 1U));
+    }
+}
+
+/* Member name and colon of an object entry. */
+static bool jx_native_write_key(JX_NATIVE_WRITER *writer, const char *name)
+{
+    if (!jx_native_print_string(writer, name))
+    {
+        return false;
+    }
+
+    jx_native_writer_putc(writer, ':');
+    if (writer->formatted)
+    {
+        jx_native_writer_putc(writer, '\t');
+    }
+    return true;
+}
+
+/* Entries of one container without its brackets, so several mappings can share it. */
+static bool jx_native_write_entries(JX_NATIVE_WRITER *writer,
+                                    JX_ELEMENT *elements,
+                                    size_t element_count,
+                                    uint8_t depth,
+                                    bool object_context,
+                                    bool *first)
+{
+    for (size_t i = 0U; i < element_count; ++i)
+    {
+        jx_native_write_separator(writer, depth, first);
+
+        if (object_context && !jx_native_write_key(writer, jx_native_member_name(writer, &elements[i])))
+        {
+            return false;
+        }
+
+        if (!jx_native_write_element_value(writer, &elements[i], (uint8_t)(depth + 1U)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool jx_native_write_elements(JX_NATIVE_WRITER *writer,
+                                     JX_ELEMENT *elements,
+                                     size_t element_count,
+                                     uint8_t depth,
+                                     bool object_context)
+{
+    bool first = true;
+    char open_char = object_context ? '{' : '[';
+    char close_char = object_context ? '}' : ']';
+
+    if ((writer == NULL) || ((elements == NULL) && (element_count != 0U)))
+    {
+        return false;
+    }
+
+    jx_native_writer_putc(writer, open_char);
+    if (!jx_native_write_entries(writer, elements, element_count, depth, object_context, &first))
+    {
+        return false;
+    }
+
+    if (!first && writer->formatted)
+    {
+        jx_native_writer_indent(writer, depth);
+    }
+    jx_native_writer_putc(writer, close_char);
+    return !writer->failed;
+}
+
+/*
+ * Fan-in: one root object from several mappings. A keyed part becomes a nested
+ * object; an unkeyed part lends its members to the root.
+ */
+static bool jx_native_write_parts(JX_NATIVE_WRITER *writer, const JX_DOCUMENT_PART *parts, size_t part_count)
+{
+    bool first = true;
+
+    jx_native_writer_putc(writer, '{');
+    for (size_t i = 0U; i < part_count; ++i)
+    {
+        if (parts[i].key == NULL)
+        {
+            if (!jx_native_write_entries(writer, parts[i].element, parts[i].element_size, 0U, true, &first))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        jx_native_write_separator(writer, 0U, &first);
+        if (!jx_native_write_key(writer, parts[i].key) ||
+            !jx_native_write_elements(writer, parts[i].element, parts[i].element_size, 1U, true))
+        {
+            return false;
+        }
+    }
+
+    if (!first && writer->formatted)
+    {
+        jx_native_writer_indent(writer, 0U);
+    }
+    jx_native_writer_putc(writer, '}');
+    return !writer->failed;
+}
+
+/* Columnar record arrays: the column names once, then one value array per record. */
+static bool jx_native_write_columns_header(JX_NATIVE_WRITER *writer, JX_ELEMENT *element, uint8_t depth)
+{
+    jx_native_writer_putc(writer, '{');
+    jx_native_writer_indent(writer, (uint8_t)(depth + 1U));
+    jx_native_writer_puts(writer, writer->formatted ? "\"cols\":\t[" : "\"cols\":[");
+    for (size_t i = 0U; i < element->value_len; ++i)
+    {
+        if (i != 0U)
+        {
+            jx_native_writer_putc(writer, ',');
+        }
+        if (!jx_native_print_string(writer, jx_native_member_name(writer, &element->element[i])))
+        {
+            return false;
+        }
+    }
+    jx_native_writer_puts(writer, "],");
+    jx_native_writer_indent(writer, (uint8_t)(depth + 1U));
+    jx_native_writer_puts(writer, writer->formatted ? "\"rows\":\t" : "\"rows\":");
+    return !writer->failed;
+}
+
+static bool jx_native_write_row(JX_NATIVE_WRITER *writer, JX_ELEMENT *element, uint8_t depth)
+{
+    jx_native_writer_putc(writer, '[');
+    for (size_t i = 0U; i < element->value_len; ++i)
+    {
+        if (i != 0U)
+        {
+            jx_native_writer_putc(writer, ',');
+        }
+        if (!jx_native_write_element_value(writer, &element->element[i], depth))
+        {
+            return false;
+        }
+    }
+    jx_native_writer_putc(writer, ']');
+    return !writer->failed;
+}
+
+/*
+ * Writes a record array. In range mode only the selected records are
+ * formatted; output before the array belongs to the first range and output
+ * after it to the last, so concatenated ranges form the whole document.
+ */
+static bool jx_native_write_records(JX_NATIVE_WRITER *writer, JX_ELEMENT *element, uint8_t depth)
+{
+    const JX_RECORDS *records = (const JX_RECORDS *)element->value_p;
+    JX_BACKEND_RELOCATION relocation;
+    size_t first = 0U;
+    size_t last;
+
+    if ((records == NULL) || (records->records == NULL) || (records->stride == 0U) ||
+        (element->element == NULL) || (writer->relocation != NULL) || (writer->snapshot != NULL))
+    {
+        return false;
+    }
+
+    last = records->count;
+    if (element == writer->range_element)
+    {
+        if ((writer->range_first > records->count) ||
+            (writer->range_count > (records->count - writer->range_first)))
+        {
+            return false;
+        }
+        first = writer->range_first;
+        last = first + writer->range_count;
+        writer->range_seen = true;
+    }
+
+    if (writer->columns)
+    {
+        if (!jx_native_write_columns_header(writer, element, depth))
+        {
+            return false;
+        }
+        depth++;
+    }
+
+    jx_native_writer_putc(writer, '[');
+    if (element == writer->range_element)
+    {
+        writer->muted = false;
+    }
+
+    relocation.source = (const uint8_t *)records->records;
+    relocation.size = records->stride;
+    for (size_t i = first; i < last; ++i)
+    {
+        bool written;
+
+        if (i != 0U)
+        {
+            jx_native_writer_putc(writer, ',');
+        }
+        jx_native_writer_indent(writer, (uint8_t)(depth + 1U));
+
+        relocation.target = (uint8_t *)records->records + (i * records->stride);
+        writer->relocation = &relocation;
+        written = writer->columns ?
+                  jx_native_write_row(writer, element, (uint8_t)(depth + 1U)) :
+                  jx_native_write_elements(writer, element->element, element->value_len, (uint8_t)(depth + 1U), true);
+        writer->relocation = NULL;
+        if (!written)
+        {
+            return false;
+        }
+    }
+
+    if (element == writer->range_element)
+    {
+        writer->muted = (last != records->count);
+    }
+    if ((records->count != 0U) && writer->formatted)
+    {
+        jx_native_writer_indent(writer, depth);
+    }
+    jx_native_writer_putc(writer, ']');
+
+    if (writer->columns)
+    {
+        jx_native_writer_indent(writer, (uint8_t)(depth - 1U));
+        jx_native_writer_putc(writer, '}');
+    }
+    return !writer->failed;
+}
+
+/* Pulls items from the produce callback into the item template and writes each in turn. */
+static bool jx_native_write_item_stream(JX_NATIVE_WRITER *writer, JX_ELEMENT *element, uint8_t depth)
+{
+    const JX_BACKEND_RELOCATION *relocation = writer->relocation;
+    const JX_ITEM_STREAM *stream;
+    size_t count = 0U;
+
+    if ((element->value_p == NULL) || (element->element == NULL) || (element->value_len == 0U) ||
+        (writer->snapshot != NULL))
+    {
+        return false;
+    }
+
+    stream = (const JX_ITEM_STREAM *)jx_native_writer_source(writer, element);
+    if (stream->produce == NULL)
+    {
+        return false;
+    }
+
+    jx_native_writer_putc(writer, '[');
+    writer->relocation = NULL;
+    for (;;)
+    {
+        bool end = false;
+        bool written;
+
+        if (!stream->produce(stream->context, count, &end))
+        {
+            writer->failed = true;
+            break;
+        }
+        if (end)
+        {
+            break;
+        }
+
+        if (count != 0U)
+        {
+            jx_native_writer_putc(writer, ',');
+        }
+        jx_native_writer_indent(writer, (uint8_t)(depth + 1U));
+
+        written = jx_native_item_scalar(element) ?
+                  jx_native_write_element_value(writer, &element->element[0], (uint8_t)(depth + 1U)) :
+                  jx_native_write_elements(writer, element->element, element->value_len, (uint8_t)(depth + 1U), true);
+        if (!written)
+        {
+            writer->failed = true;
+            break;
+        }
+        count++;
+    }
+    writer->relocation = relocation;
+
+    if ((count != 0U) && writer->formatted)
+    {
+        jx_native_writer_indent(writer, depth);
+    }
+    jx_native_writer_putc(writer, ']');
+    return !writer->failed;
+}
+
+static bool jx_native_write_element_value(JX_NATIVE_WRITER *writer, JX_ELEMENT *element, uint8_t depth)
+{
+    if ((writer == NULL) || (element == NULL))
+    {
+        return false;
+    }
+
+    switch (element->type)
+    {
+    case JX_NULL:
+        jx_native_writer_puts(writer, "null");
+        break;
+
+    case JX_BOOLEAN:
+        if (element->value_p == NULL)
+        {
+            return false;
+        }
+        jx_native_writer_puts(writer, *((const bool *)jx_native_writer_source(writer, element)) ? "true" : "false");
+        break;
+
+    case JX_NUMBER:
+#if JX_ENABLE_DOUBLE
+        if (element->value_p == NULL)
+        {
+            return false;
+        }
+        return jx_native_print_number(writer, *((const double *)jx_native_writer_source(writer, element)));
+#else
+        return false;
+#endif
+
+    case JX_U32:
+        if (element->value_p == NULL)
+        {
+            return false;
+        }
+        jx_native_print_unsigned(writer, *((const uint32_t *)jx_native_writer_source(writer, element)));
+        break;
+
+    case JX_I32:
+        if (element->value_p == NULL)
+        {
+            return false;
+        }
+        jx_native_print_signed(writer, *((const int32_t *)jx_native_writer_source(writer, element)));
+        break;
+
+    case JX_U64:
+        if (element->value_p == NULL)
+        {
+            return false;
+        }
+        jx_native_print_unsigned(writer, *((const uint64_t *)jx_native_writer_source(writer, element)));
+        break;
+
+    case JX_I64:
+        if (element->value_p == NULL)
+        {
+            return false;
+        }
+        jx_native_print_signed(writer, *((const int64_t *)jx_native_writer_source(writer, element)));
+        break;
+
+    case JX_STRING:
+        if (element->value_p == NULL)
+        {
+            return false;
+        }
+        return jx_native_print_string(writer, (const char *)jx_native_writer_source(writer, element));
+
+    case JX_STREAMED_STRING:
+        if (element->value_p == NULL)
+        {
+            return false;
+        }
+        return jx_native_print_stream(writer, (const JX_STRING_STREAM *)jx_native_writer_source(writer, element));
+
+    case JX_OBJECT:
+        return jx_native_write_elements(writer,
+                                        element->element,
+                                        element->element == NULL ? 0U : (size_t)element->value_len,
+                                        depth,
+                                        true);
+
+    case JX_ARRAY:
+        if ((element->element == NULL) && (element->value_len != 0U))
+        {
+            return false;
+        }
+        return jx_native_write_elements(writer,
+                                        element->element,
+                                        element->element == NULL ? 0U : (size_t)element->value_len,
+                                        depth,
+                                        false);
+
+    case JX_RECORD_ARRAY:
+        return jx_native_write_records(writer, element, depth);
+
+    case JX_STREAMED_ARRAY:
+        return jx_native_write_item_stream(writer, element, depth);
+
+    default:
+        return false;
+    }
+
+    return !writer->failed;
+}
+
+/* Raw key text of one enclosing member; levels live in the frames that descend. */
+typedef struct JX_NATIVE_PROJECT_LEVEL
+{
+    const char *key;
+    size_t key_length;
+    const struct JX_NATIVE_PROJECT_LEVEL *parent;
+} JX_NATIVE_PROJECT_LEVEL;
+
+/* Selected paths and the members enclosing the object being projected. */
+typedef struct
+{
+    const char *const *paths;
+    size_t path_count;
+    const JX_NATIVE_PROJECT_LEVEL *level;
+} JX_NATIVE_PROJECTION;
+
+#define JX_NATIVE_PROJECT_SKIP      0
+#define JX_NATIVE_PROJECT_DESCEND   1
+#define JX_NATIVE_PROJECT_COPY      2
+
+/* Returns the rest of segment after the enclosing keys from the top down, or NULL when they differ. */
+static const char *jx_native_project_prefix(const JX_NATIVE_PROJECT_LEVEL *level, const char *segment)
+{
+    if (level == NULL)
+    {
+        return segment;
+    }
+
+    segment = jx_native_project_prefix(level->parent, segment);
+    if ((segment == NULL) || (strncmp(segment, level->key, level->key_length) != 0) ||
+        (segment[level->key_length] != '.'))
+    {
+        return NULL;
+    }
+
+    return segment + level->key_length + 1U;
+}
+
+/* Compares member names as written, so escaped names match only a path spelled the same way. */
+static int jx_native_project_match(const JX_NATIVE_PROJECTION *projection,
+                                   const char *key,
+                                   size_t key_length)
+{
+    int result = JX_NATIVE_PROJECT_SKIP;
+
+    for (size_t i = 0U; i < projection->path_count; ++i)
+    {
+        const char *segment = jx_native_project_prefix(projection->level, projection->paths[i]);
+
+        if ((segment == NULL) || (strncmp(segment, key, key_length) != 0))
+        {
+            continue;
+        }
+
+        if (segment[key_length] == '\0')
+        {
+            return JX_NATIVE_PROJECT_COPY;
+        }
+
+        if (segment[key_length] == '.')
+        {
+            result = JX_NATIVE_PROJECT_DESCEND;
+        }
+    }
+
+    return result;
+}
+
+/* Copies the selected members of the object at the cursor; *selected reports whether any matched. */
+static bool jx_native_project_object(JX_NATIVE_READER *reader,
+                                     JX_NATIVE_WRITER *writer,
+                                     JX_NATIVE_PROJECTION *projection,
+                                     bool *selected)
+{
+    *selected = false;
+    if (!jx_native_enter_container(reader))
+    {
+        return false;
+    }
+
+    reader->cursor++;
+    jx_native_writer_putc(writer, '{');
+    jx_native_skip_ws(reader);
+
+    if (*reader->cursor != '}')
+    {
+        for (;;)
+        {
+            const char *key = reader->cursor;
+            size_t key_length;
+            size_t mark = writer->pos;
+            int match;
+
+            if (!jx_native_skip_string(reader))
+            {
+                return false;
+            }
+            key_length = (size_t)(reader->cursor - key);
+
+            jx_native_skip_ws(reader);
+            if (*reader->cursor != ':')
+            {
+                return jx_native_set_error(reader);
+            }
+            reader->cursor++;
+            jx_native_skip_ws(reader);
+
+            match = jx_native_project_match(projection, key + 1, key_length - 2U);
+            if ((match == JX_NATIVE_PROJECT_DESCEND) && (*reader->cursor == '{'))
+            {
+                JX_NATIVE_PROJECT_LEVEL level;
+                bool inner = false;
+
+                if (*selected)
+                {
+                    jx_native_writer_putc(writer, ',');
+                }
+                jx_native_writer_write(writer, key, key_length);
+                jx_native_writer_putc(writer, ':');
+
+                level.key = key + 1;
+                level.key_length = key_length - 2U;
+                level.parent = projection->level;
+                projection->level = &level;
+                if (!jx_native_project_object(reader, writer, projection, &inner))
+                {
+                    return false;
+                }
+                projection->level = level.parent;
+
+                /* Members without a selected descendant are dropped again. */
+                if (inner)
+                {
+                    *selected = true;
+                }
+                else if (!writer->failed)
+                {
+                    writer->pos = mark;
+                    writer->buffer[mark] = '\0';
+                }
+            }
+            else if (match == JX_NATIVE_PROJECT_COPY)
+            {
+                const char *value = reader->cursor;
+
+                if (!jx_native_skip_value(reader))
+                {
+                    return false;
+                }
+
+                if (*selected)
+                {
+                    jx_native_writer_putc(writer, ',');
+                }
+                jx_native_writer_write(writer, key, key_length);
+                jx_native_writer_putc(writer, ':');
+                jx_native_writer_write(writer, value, (size_t)(reader->cursor - value));
+                *selected = true;
+            }
+            else if (!jx_native_skip_value(reader))
+            {
+                return false;
+            }
+
+            jx_native_skip_ws(reader);
+            if (*reader->cursor == '}')
+            {
+                break;
+            }
+
+            if (*reader->cursor != ',')
+            {
+                return jx_native_set_error(reader);
+            }
+            reader->cursor++;
+            jx_native_skip_ws(reader);
+        }
+    }
+
+    reader->cursor++;
+    reader->depth--;
+    jx_native_writer_putc(writer, '}');
+    return true;
+}
+
+void jx_backend_init_hooks(void *(*malloc_fn)(size_t size), void (*free_fn)(void *ptr))
+{
+    (void)malloc_fn;
+    (void)free_fn;
+    jx_native_error_ptr = NULL;
+}
+
+void jx_backend_reset_hooks(void)
+{
+    jx_native_error_ptr = NULL;
+}
+
+const char *jx_backend_get_error_ptr(void)
+{
+    return jx_native_error_ptr;
+}
+
+/* Parses the root object; outside trusted mode nothing but whitespace may follow. */
+static JX_STATUS jx_native_parse_root(JX_NATIVE_READER *reader,
+                                      JX_ELEMENT *elements,
+                                      size_t element_count,
+                                      JX_PARSE_MODE mode,
+                                      const char **error_ptr)
+{
+    *error_ptr = NULL;
+
+    for (size_t i = 0U; i < element_count; ++i)
+    {
+        jx_clear_status(&elements[i]);
+    }
+
+    jx_native_skip_ws(reader);
+    if (jx_native_parse_object_into_elements(reader, elements, element_count, mode) != JX_SUCCESS)
+    {
+        *error_ptr = (reader->error != NULL) ? reader->error : reader->cursor;
+        return JX_ERROR;
+    }
+
+    if (reader->trusted)
+    {
+        return JX_SUCCESS;
+    }
+
+    jx_native_skip_ws(reader);
+    if (*reader->cursor != '\0')
+    {
+        *error_ptr = reader->cursor;
+        return JX_ERROR;
+    }
+
+    return JX_SUCCESS;
+}
+
+/* Compares the document with the skeleton up to offset and steps over it. */
+static bool jx_native_shape_compare(JX_NATIVE_READER *reader,
+                                    const JX_SHAPE *shape,
+                                    size_t *matched,
+                                    size_t offset,
+                                    const char *end)
+{
+    size_t length = offset - *matched;
+
+    if (((size_t)(end - reader->cursor) < length) ||
+        (memcmp(reader->cursor, &shape->skeleton[*matched], length) != 0))
+    {
+        return false;
+    }
+
+    reader->cursor += length;
+    *matched = offset;
+    return true;
+}
+
+/*
+ * Replays a recorded shape: skeleton runs are compared in bulk and each value
+ * is parsed straight into its recorded target. Any difference returns false
+ * so the caller parses in full.
+ */
+static bool jx_native_shape_match(JX_NATIVE_READER *reader, const JX_SHAPE *shape, JX_PARSE_MODE mode, const char *end)
+{
+    JX_BACKEND_RELOCATION relocation;
+    size_t matched = 0U;
+
+    relocation.size = 1U;
+
+    for (size_t i = 0U; i < shape->slot_count; ++i)
+    {
+        const JX_SHAPE_SLOT *slot = &shape->slots[i];
+        JX_ELEMENT *element = slot->element;
+        JX_STATUS status;
+
+        if (!jx_native_shape_compare(reader, shape, &matched, slot->offset, end))
+        {
+            return false;
+        }
+
+        switch (slot->kind)
+        {
+        case JX_NATIVE_SHAPE_VALUE:
+            /* A container where a value was recorded changes the layout. */
+            if (jx_native_shape_descends(element, *reader->cursor))
+            {
+                return false;
+            }
+
+            relocation.source = (const uint8_t *)element->value_p;
+            relocation.target = (uint8_t *)slot->target;
+            reader->relocation = &relocation;
+            reader->depth = (uint8_t)slot->count;
+            status = jx_native_parse_element_value(reader, element, mode);
+            reader->relocation = NULL;
+            if (status != JX_SUCCESS)
+            {
+                return false;
+            }
+            break;
+
+        case JX_NATIVE_SHAPE_SKIP:
+            reader->depth = (uint8_t)slot->count;
+            if (!jx_native_skip_value(reader))
+            {
+                return false;
+            }
+            break;
+
+        case JX_NATIVE_SHAPE_MARK:
+            jx_set_updated(element);
+            break;
+
+        case JX_NATIVE_SHAPE_CLEAR:
+            for (size_t j = 0U; j < element->value_len; ++j)
+            {
+                jx_clear_status(&element->element[j]);
+            }
+            break;
+
+        default:
+            if (element->type == JX_ARRAY)
+            {
+                element->value_len = (uint8_t)slot->count;
+            }
+            else if (element->type == JX_RECORD_ARRAY)
+            {
+                ((JX_RECORDS *)(uintptr_t)element->value_p)->count = slot->count;
+            }
+            jx_set_updated(element);
+            break;
+        }
+    }
+
+    if (!jx_native_shape_compare(reader, shape, &matched, shape->skeleton_length, end))
+    {
+        return false;
+    }
+
+    /* A trusted parse ignores whatever follows the root object. */
+    return reader->trusted || (reader->cursor == end);
+}
+
+/*
+ * Fan-out: hands one root member to every target mapping that knows its key.
+ * A value one mapping cannot take fails only that mapping; the value is then
+ * skipped with full grammar checks, so a broken document still fails them all.
+ */
+static bool jx_native_fanout_member(JX_NATIVE_READER *reader,
+                                    JX_FANOUT_TARGET *targets,
+                                    size_t target_count,
+                                    const char *property,
+                                    JX_PARSE_MODE mode,
+                                    const char **failed)
+{
+    const char *value;
+    const char *end = NULL;
+    uint8_t depth = reader->depth;
+
+    jx_native_skip_ws(reader);
+    value = reader->cursor;
+
+    for (size_t i = 0U; i < target_count; ++i)
+    {
+        JX_ELEMENT *element;
+
+        if (targets[i].status != JX_SUCCESS)
+        {
+            continue;
+        }
+
+        element = jx_native_find_element(targets[i].element, targets[i].element_size, property);
+        if (element == NULL)
+        {
+            continue;
+        }
+
+        reader->cursor = value;
+        if (jx_native_parse_element_value(reader, element, mode) != JX_SUCCESS)
+        {
+            reader->cursor = value;
+            reader->error = NULL;
+            reader->depth = depth;
+            if (!jx_native_skip_value(reader))
+            {
+                return false;
+            }
+
+            targets[i].status = JX_ERROR;
+            if (*failed == NULL)
+            {
+                *failed = value;
+            }
+        }
+        end = reader->cursor;
+    }
+
+    if (end != NULL)
+    {
+        reader->cursor = end;
+        return true;
+    }
+
+    return jx_native_skip_value(reader);
+}
+
+static JX_STATUS jx_native_parse_fanout(JX_NATIVE_READER *reader,
+                                        JX_FANOUT_TARGET *targets,
+                                        size_t target_count,
+                                        JX_PARSE_MODE mode,
+                                        const char **failed)
+{
+    if ((*reader->cursor != '{') || !jx_native_enter_container(reader))
+    {
+        jx_native_set_error(reader);
+        return JX_ERROR;
+    }
+
+    reader->cursor++;
+    jx_native_skip_ws(reader);
+
+    while (*reader->cursor != '}')
+    {
+        char property[JX_PROPERTY_MAX_SIZE];
+
+        if (!jx_native_parse_string_into_buffer(reader, property, sizeof(property), false) ||
+            !jx_native_expect(reader, ':') ||
+            !jx_native_fanout_member(reader, targets, target_count, property, mode, failed))
+        {
+            return JX_ERROR;
+        }
+
+        jx_native_skip_ws(reader);
+        if (*reader->cursor == ',')
+        {
+            reader->cursor++;
+            jx_native_skip_ws(reader);
+        }
+        else if (*reader->cursor != '}')
+        {
+            jx_native_set_error(reader);
+            return JX_ERROR;
+        }
+    }
+
+    reader->cursor++;
+    reader->depth--;
+    return JX_SUCCESS;
+}
+
+JX_STATUS jx_backend_parse_into_elements(char *buffer,
+                                         JX_ELEMENT *elements,
+                                         size_t element_count,
+                                         JX_PARSE_MODE mode,
+                                         const char **error_ptr)
+{
+    return jx_backend_parse_relocated(buffer, elements, element_count, mode, error_ptr, NULL);
+}
+
+JX_STATUS jx_backend_parse_relocated(char *buffer,
+                                     JX_ELEMENT *elements,
+                                     size_t element_count,
+                                     JX_PARSE_MODE mode,
+                                     const char **error_ptr,
+                                     const JX_BACKEND_RELOCATION *relocation)
+{
+    JX_NATIVE_READER reader;
+
+    /* Context callers keep their own error slot; NULL selects the shared one. */
+    if (error_ptr == NULL)
+    {
+        error_ptr = &jx_native_error_ptr;
+    }
+
+    if ((buffer == NULL) || (elements == NULL) || (element_count == 0U) ||
+        ((mode != JX_MODE_RELAXED) && (mode != JX_MODE_STRICT) && (mode != JX_MODE_TRUSTED)))
+    {
+        return JX_ERROR;
+    }
+
+    reader.start = buffer;
+    reader.cursor = buffer;
+    reader.error = NULL;
+    reader.depth = 0U;
+    reader.trusted = (mode == JX_MODE_TRUSTED);
+    reader.compare = false;
+    reader.differs = false;
+    reader.validate_only = false;
+    reader.shape = NULL;
+    reader.relocation = relocation;
+    return jx_native_parse_root(&reader, elements, element_count, mode, error_ptr);
+}
+
+JX_STATUS jx_backend_parse_shaped(char *buffer,
+                                  JX_ELEMENT *elements,
+                                  size_t element_count,
+                                  JX_PARSE_MODE mode,
+                                  const char **error_ptr,
+                                  JX_SHAPE *shape)
+{
+    JX_NATIVE_READER reader;
+    JX_STATUS status;
+
+    if (error_ptr == NULL)
+    {
+        error_ptr = &jx_native_error_ptr;
+    }
+
+    if ((buffer == NULL) || (elements == NULL) || (element_count == 0U) || (shape == NULL) ||
+        ((mode != JX_MODE_RELAXED) && (mode != JX_MODE_STRICT) && (mode != JX_MODE_TRUSTED)))
+    {
+        return JX_ERROR;
+    }
+
+    reader.start = buffer;
+    reader.cursor = buffer;
+    reader.error = NULL;
+    reader.depth = 0U;
+    reader.trusted = (mode == JX_MODE_TRUSTED);
+    reader.compare = false;
+    reader.differs = false;
+    reader.validate_only = false;
+    reader.shape = NULL;
+    reader.relocation = NULL;
+
+    if (shape->valid && (shape->mapping == elements) && (shape->mapping_size == element_count) &&
+        (shape->mode == mode))
+    {
+        *error_ptr = NULL;
+        for (size_t i = 0U; i < element_count; ++i)
+        {
+            jx_clear_status(&elements[i]);
+        }
+
+        if (jx_native_shape_match(&reader, shape, mode, buffer + strlen(buffer)))
+        {
+            shape->hits++;
+            return JX_SUCCESS;
+        }
+
+        reader.cursor = buffer;
+        reader.error = NULL;
+        reader.depth = 0U;
+    }
+
+    /* Parse in full and record the layout as it goes. */
+    shape->misses++;
+    shape->valid = false;
+    shape->skeleton_length = 0U;
+    shape->slot_count = 0U;
+    shape->mapping = elements;
+    shape->mapping_size = element_count;
+    shape->mode = mode;
+    reader.shape = shape;
+    reader.shape_copied = buffer;
+
+    status = jx_native_parse_root(&reader, elements, element_count, mode, error_ptr);
+    shape->valid = (status == JX_SUCCESS) && (reader.shape != NULL) && jx_native_shape_copy(&reader);
+    return status;
+}
+
+JX_STATUS jx_backend_parse_fanout(char *buffer,
+                                  JX_FANOUT_TARGET *targets,
+                                  size_t target_count,
+                                  JX_PARSE_MODE mode,
+                                  const char **error_ptr)
+{
+    JX_NATIVE_READER reader;
+    const char *failed = NULL;
+    const char *broken = NULL;
+    JX_STATUS status = JX_SUCCESS;
+
+    if (error_ptr == NULL)
+    {
+        error_ptr = &jx_native_error_ptr;
+    }
+
+    if ((buffer == NULL) || (targets == NULL) || (target_count == 0U) ||
+        ((mode != JX_MODE_RELAXED) && (mode != JX_MODE_STRICT) && (mode != JX_MODE_TRUSTED)))
+    {
+        return JX_ERROR;
+    }
+
+    for (size_t i = 0U; i < target_count; ++i)
+    {
+        if ((targets[i].element == NULL) || (targets[i].element_size == 0U))
+        {
+            return JX_ERROR;
+        }
+    }
+
+    reader.start = buffer;
+    reader.cursor = buffer;
+    reader.error = NULL;
+    reader.depth = 0U;
+    reader.trusted = (mode == JX_MODE_TRUSTED);
+    reader.compare = false;
+    reader.differs = false;
+    reader.validate_only = false;
+    reader.shape = NULL;
+    reader.relocation = NULL;
+    *error_ptr = NULL;
+
+    for (size_t i = 0U; i < target_count; ++i)
+    {
+        targets[i].status = JX_SUCCESS;
+        for (size_t j = 0U; j < targets[i].element_size; ++j)
         {
-            return false;
+            jx_clear_status(&targets[i].element[j]);
         }
-        jx_native_print_unsigned(writer, *((uint32_t *)element->value_p));
-        break;
+    }
 
-    case JX_I32:
-        if (element->value_p == NULL)
+    jx_native_skip_ws(&reader);
+    if (jx_native_parse_fanout(&reader, targets, target_count, mode, &failed) != JX_SUCCESS)
+    {
+        broken = (reader.error != NULL) ? reader.error : reader.cursor;
+    }
+    else if (!reader.trusted)
+    {
+        jx_native_skip_ws(&reader);
+        if (*reader.cursor != '\0')
         {
-            return false;
+            broken = reader.cursor;
         }
-        jx_native_print_signed(writer, *((int32_t *)element->value_p));
-        break;
+    }
 
-    case JX_U64:
-        if (element->value_p == NULL)
+    /* Grammar errors belong to the document, so every mapping fails. */
+    if (broken != NULL)
+    {
+        *error_ptr = broken;
+        for (size_t i = 0U; i < target_count; ++i)
         {
-            return false;
+            targets[i].status = JX_ERROR;
         }
-        jx_native_print_unsigned(writer, *((uint64_t *)element->value_p));
-        break;
+        return JX_ERROR;
+    }
 
-    case JX_I64:
-        if (element->value_p == NULL)
+    for (size_t i = 0U; i < target_count; ++i)
+    {
+        for (size_t j = 0U; (j < targets[i].element_size) && (mode == JX_MODE_STRICT); ++j)
         {
-            return false;
+            if (!jx_is_updated(&targets[i].element[j]))
+            {
+                targets[i].status = JX_ERROR;
+            }
         }
-        jx_native_print_signed(writer, *((int64_t *)element->value_p));
-        break;
 
-    case JX_STRING:
-        if (element->value_p == NULL)
+        if (targets[i].status != JX_SUCCESS)
         {
-            return false;
+            status = JX_ERROR;
         }
-        return jx_native_print_string(writer, (const char *)element->value_p);
+    }
 
-    case JX_OBJECT:
-        return jx_native_write_elements(writer,
-                                        element->element,
-                                        element->element == NULL ? 0U : (size_t)element->value_len,
-                                        depth,
-                                        true);
+    if (status != JX_SUCCESS)
+    {
+        *error_ptr = (failed != NULL) ? failed : reader.cursor;
+    }
+    return status;
+}
 
-    case JX_ARRAY:
-        if ((element->element == NULL) && (element->value_len != 0U))
+bool jx_backend_write_elements(JX_ELEMENT *elements,
+                               size_t element_count,
+                               char *buffer,
+                               size_t buffer_size,
+                               JX_FORMAT format)
+{
+    JX_NATIVE_WRITER writer;
+
+    if ((elements == NULL) || (element_count == 0U) ||
+        (buffer == NULL) || (buffer_size == 0U) ||
+        (!JX_BACKEND_FORMAT_VALID(format)))
+    {
+        return false;
+    }
+
+    memset(&writer, 0, sizeof(writer));
+    writer.buffer = buffer;
+    writer.size = buffer_size;
+    jx_native_writer_set_format(&writer, format);
+    writer.buffer[0] = '\0';
+
+    if (!jx_native_write_elements(&writer, elements, element_count, 0U, true))
+    {
+        return false;
+    }
+
+    return !writer.failed;
+}
+
+bool jx_backend_write_elements_to_sink(JX_ELEMENT *elements,
+                                       size_t element_count,
+                                       char *chunk,
+                                       size_t chunk_size,
+                                       JX_FORMAT format,
+                                       JX_SINK_FN sink,
+                                       void *sink_context)
+{
+    JX_NATIVE_WRITER writer;
+
+    if ((elements == NULL) || (element_count == 0U) ||
+        (chunk == NULL) || (chunk_size < 2U) || (sink == NULL) ||
+        (!JX_BACKEND_FORMAT_VALID(format)))
+    {
+        return false;
+    }
+
+    memset(&writer, 0, sizeof(writer));
+    writer.buffer = chunk;
+    writer.size = chunk_size;
+    jx_native_writer_set_format(&writer, format);
+    writer.sink = sink;
+    writer.sink_context = sink_context;
+    writer.buffer[0] = '\0';
+
+    if (!jx_native_write_elements(&writer, elements, element_count, 0U, true))
+    {
+        return false;
+    }
+
+    return !writer.failed && jx_native_writer_flush(&writer);
+}
+
+bool jx_backend_write_parts(const JX_DOCUMENT_PART *parts,
+                            size_t part_count,
+                            char *buffer,
+                            size_t buffer_size,
+                            JX_FORMAT format,
+                            JX_SINK_FN sink,
+                            void *sink_context)
+{
+    JX_NATIVE_WRITER writer;
+
+    if ((parts == NULL) || (part_count == 0U) || (buffer == NULL) ||
+        (buffer_size < ((sink != NULL) ? 2U : 1U)) || (!JX_BACKEND_FORMAT_VALID(format)))
+    {
+        return false;
+    }
+
+    for (size_t i = 0U; i < part_count; ++i)
+    {
+        if ((parts[i].element == NULL) || (parts[i].element_size == 0U))
         {
             return false;
         }
-        return jx_native_write_elements(writer,
-                                        element->element,
-                                        element->element == NULL ? 0U : (size_t)element->value_len,
-                                        depth,
-                                        false);
+    }
 
-    default:
+    memset(&writer, 0, sizeof(writer));
+    writer.buffer = buffer;
+    writer.size = buffer_size;
+    jx_native_writer_set_format(&writer, format);
+    writer.sink = sink;
+    writer.sink_context = sink_context;
+    writer.buffer[0] = '\0';
+
+    if (!jx_native_write_parts(&writer, parts, part_count))
+    {
         return false;
     }
 
-    return !writer->failed;
+    return !writer.failed && ((sink == NULL) || jx_native_writer_flush(&writer));
 }
 
-void jx_backend_init_hooks(void *(*malloc_fn)(size_t size), void (*free_fn)(void *ptr))
+size_t jx_backend_snapshot_size(const JX_ELEMENT *elements, size_t element_count)
 {
-    (void)malloc_fn;
-    (void)free_fn;
-    jx_native_error_ptr = NULL;
+    size_t offset = 0U;
+
+    if ((elements == NULL) || (element_count == 0U) ||
+        !jx_native_snapshot_elements(elements, element_count, NULL, 0U, &offset))
+    {
+        return 0U;
+    }
+
+    return offset;
 }
 
-void jx_backend_reset_hooks(void)
+bool jx_backend_snapshot_elements(const JX_ELEMENT *elements,
+                                  size_t element_count,
+                                  void *staging,
+                                  size_t staging_size)
 {
-    jx_native_error_ptr = NULL;
+    size_t offset = 0U;
+
+    if ((elements == NULL) || (element_count == 0U) || (staging == NULL))
+    {
+        return false;
+    }
+
+    return jx_native_snapshot_elements(elements, element_count, (uint8_t *)staging, staging_size, &offset);
 }
 
-const char *jx_backend_get_error_ptr(void)
+bool jx_backend_write_snapshot(JX_ELEMENT *elements,
+                               size_t element_count,
+                               const void *snapshot,
+                               char *buffer,
+                               size_t buffer_size,
+                               JX_FORMAT format)
 {
-    return jx_native_error_ptr;
+    JX_NATIVE_WRITER writer;
+
+    if ((elements == NULL) || (element_count == 0U) || (snapshot == NULL) ||
+        (buffer == NULL) || (buffer_size == 0U) ||
+        (!JX_BACKEND_FORMAT_VALID(format)))
+    {
+        return false;
+    }
+
+    memset(&writer, 0, sizeof(writer));
+    writer.buffer = buffer;
+    writer.size = buffer_size;
+    jx_native_writer_set_format(&writer, format);
+    writer.snapshot = (const uint8_t *)snapshot;
+    writer.buffer[0] = '\0';
+
+    if (!jx_native_write_elements(&writer, elements, element_count, 0U, true))
+    {
+        return false;
+    }
+
+    return !writer.failed;
 }
 
-JX_STATUS jx_backend_parse_into_elements(char *buffer,
-                                         JX_ELEMENT *elements,
-                                         size_t element_count,
-                                         JX_PARSE_MODE mode)
+bool jx_backend_write_range(JX_ELEMENT *elements,
+                            size_t element_count,
+                            const JX_ELEMENT *range_element,
+                            size_t first,
+                            size_t count,
+                            char *buffer,
+                            size_t buffer_size,
+                            JX_FORMAT format,
+                            size_t *written)
+{
+    JX_NATIVE_WRITER writer;
+
+    if ((elements == NULL) || (element_count == 0U) ||
+        (range_element == NULL) || (range_element->type != JX_RECORD_ARRAY) ||
+        (buffer == NULL) || (buffer_size == 0U) ||
+        (!JX_BACKEND_FORMAT_VALID(format)))
+    {
+        return false;
+    }
+
+    memset(&writer, 0, sizeof(writer));
+    writer.buffer = buffer;
+    writer.size = buffer_size;
+    jx_native_writer_set_format(&writer, format);
+    writer.range_element = range_element;
+    writer.range_first = first;
+    writer.range_count = count;
+    writer.muted = (first != 0U);
+    writer.buffer[0] = '\0';
+
+    if (!jx_native_write_elements(&writer, elements, element_count, 0U, true) ||
+        writer.failed || !writer.range_seen)
+    {
+        return false;
+    }
+
+    if (written != NULL)
+    {
+        *written = writer.pos;
+    }
+    return true;
+}
+
+JX_STATUS jx_backend_parse_span(const char *span,
+                                size_t length,
+                                JX_ELEMENT *elements,
+                                size_t element_count,
+                                JX_PARSE_MODE mode,
+                                const char **error_ptr,
+                                const JX_BACKEND_RELOCATION *relocation)
 {
     JX_NATIVE_READER reader;
 
-    if ((buffer == NULL) || (elements == NULL) || (element_count == 0U) ||
-        ((mode != JX_MODE_RELAXED) && (mode != JX_MODE_STRICT)))
+    if ((span == NULL) || (error_ptr == NULL) || (elements == NULL) || (element_count == 0U) ||
+        ((mode != JX_MODE_RELAXED) && (mode != JX_MODE_STRICT) && (mode != JX_MODE_TRUSTED)))
     {
         return JX_ERROR;
     }
 
-    reader.start = buffer;
-    reader.cursor = buffer;
+    /* The item sits inside the top-level array, one level deep. */
+    reader.start = span;
+    reader.cursor = span;
     reader.error = NULL;
-    reader.depth = 0U;
-    jx_native_error_ptr = NULL;
+    reader.depth = 1U;
+    reader.trusted = (mode == JX_MODE_TRUSTED);
+    reader.compare = false;
+    reader.differs = false;
+    reader.validate_only = false;
+    reader.shape = NULL;
+    reader.relocation = relocation;
+    *error_ptr = NULL;
 
     for (size_t i = 0U; i < element_count; ++i)
     {
         jx_clear_status(&elements[i]);
     }
 
-    jx_native_skip_ws(&reader);
+    if (*reader.cursor != '{')
+    {
+        *error_ptr = reader.cursor;
+        return JX_ERROR;
+    }
+
     if (jx_native_parse_object_into_elements(&reader, elements, element_count, mode) != JX_SUCCESS)
     {
-        jx_native_error_ptr = (reader.error != NULL) ? reader.error : reader.cursor;
+        *error_ptr = (reader.error != NULL) ? reader.error : reader.cursor;
         return JX_ERROR;
     }
 
-    jx_native_skip_ws(&reader);
-    if (*reader.cursor != '\0')
+    /* The object must end exactly where the structural scan ended the item. */
+    if (reader.cursor != (span + length))
     {
-        jx_native_error_ptr = reader.cursor;
+        *error_ptr = reader.cursor;
         return JX_ERROR;
     }
 
     return JX_SUCCESS;
 }
 
+bool jx_backend_skip_value(const char *text, const char **end)
+{
+    JX_NATIVE_READER reader;
 
-bool jx_backend_write_elements(JX_ELEMENT *elements,
-                               size_t element_count,
-                               char *buffer,
-                               size_t buffer_size,
-                               JX_FORMAT format)
+    if ((text == NULL) || (end == NULL))
+    {
+        return false;
+    }
+
+    reader.start = text;
+    reader.cursor = text;
+    reader.error = NULL;
+    reader.depth = 0U;
+    reader.trusted = false;
+    reader.compare = false;
+    reader.differs = false;
+    reader.validate_only = true;
+    reader.shape = NULL;
+    reader.relocation = NULL;
+
+    if (!jx_native_skip_value(&reader))
+    {
+        *end = (reader.error != NULL) ? reader.error : reader.cursor;
+        return false;
+    }
+
+    *end = reader.cursor;
+    return true;
+}
+
+JX_STATUS jx_backend_project(const char *json,
+                             const char *const *paths,
+                             size_t path_count,
+                             char *buffer,
+                             size_t buffer_size,
+                             size_t *written)
 {
+    JX_NATIVE_READER reader;
     JX_NATIVE_WRITER writer;
+    JX_NATIVE_PROJECTION projection;
+    bool selected;
 
-    if ((elements == NULL) || (element_count == 0U) ||
-        (buffer == NULL) || (buffer_size == 0U) ||
-        ((format != JX_MINIFIED) && (format != JX_FORMATTED)))
+    if ((json == NULL) || ((paths == NULL) && (path_count != 0U)) ||
+        (buffer == NULL) || (buffer_size == 0U))
     {
-        return false;
+        return JX_ERROR;
     }
 
+    reader.start = json;
+    reader.cursor = json;
+    reader.error = NULL;
+    reader.depth = 0U;
+    reader.trusted = false;
+    reader.compare = false;
+    reader.differs = false;
+    reader.validate_only = true;
+    reader.shape = NULL;
+    reader.relocation = NULL;
+
     memset(&writer, 0, sizeof(writer));
     writer.buffer = buffer;
     writer.size = buffer_size;
-    writer.formatted = (format == JX_FORMATTED);
     writer.buffer[0] = '\0';
 
-    if (!jx_native_write_elements(&writer, elements, element_count, 0U, true))
+    projection.paths = paths;
+    projection.path_count = path_count;
+    projection.level = NULL;
+
+    jx_native_skip_ws(&reader);
+    if ((*reader.cursor != '{') ||
+        !jx_native_project_object(&reader, &writer, &projection, &selected) ||
+        writer.failed)
     {
-        return false;
+        return JX_ERROR;
     }
 
-    return !writer.failed;
+    jx_native_skip_ws(&reader);
+    if (*reader.cursor != '\0')
+    {
+        return JX_ERROR;
+    }
+
+    if (written != NULL)
+    {
+        *written = writer.pos;
+    }
+    return JX_SUCCESS;
+}
+
+JX_STATUS jx_backend_compare_elements(const char *json,
+                                      JX_ELEMENT *elements,
+                                      size_t element_count,
+                                      bool *equal)
+{
+    JX_NATIVE_READER reader;
+
+    if ((json == NULL) || (elements == NULL) || (element_count == 0U) || (equal == NULL))
+    {
+        return JX_ERROR;
+    }
+
+    /* Relaxed rules need no element status, so the mapping is only read. */
+    reader.start = json;
+    reader.cursor = json;
+    reader.error = NULL;
+    reader.depth = 0U;
+    reader.trusted = false;
+    reader.compare = true;
+    reader.differs = false;
+    reader.validate_only = false;
+    reader.shape = NULL;
+    reader.relocation = NULL;
+
+    jx_native_skip_ws(&reader);
+    if (jx_native_parse_object_into_elements(&reader, elements, element_count, JX_MODE_RELAXED) != JX_SUCCESS)
+    {
+        return JX_ERROR;
+    }
+
+    jx_native_skip_ws(&reader);
+    if (*reader.cursor != '\0')
+    {
+        return JX_ERROR;
+    }
+
+    *equal = !reader.differs;
+    return JX_SUCCESS;
 }
@@ -290,14 +290,11 @@ JX_STATUS jx_struct_to_json(JX_ELEMENT *element, size_t element_size, char *buff
 {
     if ((!_jx_is_initialized()) || (!element) || (element_size == 0U) ||
         (!buffer) || (buffer_size == 0U) || (buffer_size > (size_t)INT_MAX) ||
-        ((format != JX_MINIFIED) && (format != JX_FORMATTED)))
+        (!JX_BACKEND_FORMAT_VALID(format)))
     {
         return JX_ERROR;
     }
 
-#if defined(JX_USE_BAREMETAL) && !defined(JX_USE_HEAP_BAREMETAL)
-	jx_static_reset();
-#endif
     if (!jx_backend_write_elements(element, element_size, buffer, buffer_size, format))
     {
         return JX_ERROR;
@@ -306,18 +303,39 @@ JX_STATUS jx_struct_to_json(JX_ELEMENT *element, size_t element_size, char *buff
     return JX_SUCCESS;
 }
 
+JX_STATUS jx_struct_to_json_chunked(JX_ELEMENT *element,
+                                    size_t element_size,
+                                    char *chunk,
+                                    size_t chunk_size,
+                                    JX_FORMAT format,
+                                    JX_SINK_FN sink,
+                                    void *sink_context)
+{
+    if ((!_jx_is_initialized()) || (!element) || (element_size == 0U) ||
+        (!chunk) || (chunk_size < 2U) || (!sink) ||
+        (!JX_BACKEND_FORMAT_VALID(format)))
+    {
+        return JX_ERROR;
+    }
+
+    if (!jx_backend_write_elements_to_sink(element, element_size, chunk, chunk_size,
+                                           format, sink, sink_context))
+    {
+        return JX_ERROR;
+    }
+
+    return JX_SUCCESS;
+}
+
 JX_STATUS jx_json_to_struct(char *buffer, JX_ELEMENT *element, size_t element_size, JX_PARSE_MODE mode)
 {
     if ((!_jx_is_initialized()) || (!buffer) || (!element) || (element_size == 0U) ||
-        ((mode != JX_MODE_RELAXED) && (mode != JX_MODE_STRICT)))
+        ((mode != JX_MODE_RELAXED) && (mode != JX_MODE_STRICT) && (mode != JX_MODE_TRUSTED)))
     {
         return JX_ERROR;
     }
 
-#if defined(JX_USE_BAREMETAL) && !defined(JX_USE_HEAP_BAREMETAL)
-	jx_static_reset();
-#endif
-    return jx_backend_parse_into_elements(buffer, element, element_size, mode);
+    return jx_backend_parse_into_elements(buffer, element, element_size, mode, NULL);
 }
 
 size_t jx_get_last_error_offset(const char *buffer)
@@ -332,6 +350,31 @@ size_t jx_get_last_error_offset(const char *buffer)
     return (size_t)(error_ptr - buffer);
 }
 
+#if defined(JX_USE_BAREMETAL) && !defined(JX_USE_HEAP_BAREMETAL)
+JX_STATUS jx_get_allocator_stats(JX_ALLOCATOR_STATS *stats)
+{
+    if ((!_jx_is_initialized()) || (!stats))
+    {
+        return JX_ERROR;
+    }
+
+    jx_static_get_stats(stats);
+    return JX_SUCCESS;
+}
+#endif
+
+#if defined(JX_USE_BAREMETAL) && !defined(JX_USE_HEAP_BAREMETAL) && !JX_ENABLE_SLAB_ALLOCATOR
+JX_ARENA *jx_get_arena(void)
+{
+    if (!_jx_is_initialized())
+    {
+        return NULL;
+    }
+
+    return JSON_Parser->allocator;
+}
+#endif
+
 static bool _jx_is_initialized(void)
 {
     return ((JSON_Parser != NULL) && (JSON_Parser->state == JX_INITIALIZED));
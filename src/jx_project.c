@@ -0,0 +1,79 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_project.c                                                    */
+/*  @brief Projection of selected member paths (JsonX)                    */
+/*                                                                        */
+/*  Copies whitelisted subtrees from one document to another in a single  */
+/*  pass; members off every path go through the reader's skip routines.   */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "../private/jx_backend.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  Local Functions                                                       */
+/*                                                                        */
+/**************************************************************************/
+
+/* A path is one or more non-empty member names joined by dots. */
+static bool jx_project_path_valid(const char *path)
+{
+    bool empty_segment = true;
+
+    if (path == NULL)
+    {
+        return false;
+    }
+
+    for (; *path != '\0'; ++path)
+    {
+        if (*path == '.')
+        {
+            if (empty_segment)
+            {
+                return false;
+            }
+            empty_segment = true;
+        }
+        else
+        {
+            empty_segment = false;
+        }
+    }
+
+    return !empty_segment;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  Public API                                                            */
+/*                                                                        */
+/**************************************************************************/
+
+JX_STATUS jx_project(const char *json,
+                     const char *const *paths,
+                     size_t path_count,
+                     char *buffer,
+                     size_t buffer_size,
+                     size_t *written)
+{
+    if ((json == NULL) || (paths == NULL) || (path_count == 0U) ||
+        (buffer == NULL) || (buffer_size == 0U))
+    {
+        return JX_ERROR;
+    }
+
+    for (size_t i = 0U; i < path_count; ++i)
+    {
+        if (!jx_project_path_valid(paths[i]))
+        {
+            return JX_ERROR;
+        }
+    }
+
+    return jx_backend_project(json, paths, path_count, buffer, buffer_size, written);
+}
@@ -0,0 +1,315 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_records.c                                                    */
+/*  @brief Range serialization and parsing of record arrays (JsonX)       */
+/*                                                                        */
+/*  Splits one large record array into ranges that worker threads format  */
+/*  or parse independently; range outputs concatenate into one document.  */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "../private/jx_backend.h"
+#if JX_ENABLE_PARALLEL_WRITE
+#include "../private/jx_atomic.h"
+#endif
+
+#include <limits.h>
+
+/**************************************************************************/
+/*                                                                        */
+/*  Structural scan                                                       */
+/*                                                                        */
+/**************************************************************************/
+
+#define JX_SCAN_STRUCTURE   0x01U   /* Ends a run outside strings */
+#define JX_SCAN_STRING      0x02U   /* Ends a run inside strings */
+
+/* One table lookup per byte; ordinary bytes are skipped in tight loops. */
+static const uint8_t jx_records_scan_class[256] =
+{
+    ['\0'] = JX_SCAN_STRUCTURE | JX_SCAN_STRING,
+    ['"']  = JX_SCAN_STRUCTURE | JX_SCAN_STRING,
+    ['\\'] = JX_SCAN_STRING,
+    ['{']  = JX_SCAN_STRUCTURE,
+    ['}']  = JX_SCAN_STRUCTURE,
+    ['[']  = JX_SCAN_STRUCTURE,
+    [']']  = JX_SCAN_STRUCTURE,
+    [',']  = JX_SCAN_STRUCTURE
+};
+
+static const char *jx_records_skip_ws(const char *cursor)
+{
+    while ((*cursor == ' ') || (*cursor == '\t') || (*cursor == '\n') || (*cursor == '\r'))
+    {
+        cursor++;
+    }
+
+    return cursor;
+}
+
+/* Returns the byte after the closing quote, or NULL for an unterminated string. */
+static const char *jx_records_skip_string(const char *cursor)
+{
+    for (;;)
+    {
+        while ((jx_records_scan_class[(uint8_t)*cursor] & JX_SCAN_STRING) == 0U)
+        {
+            cursor++;
+        }
+
+        if (*cursor == '"')
+        {
+            return cursor + 1;
+        }
+
+        if ((*cursor == '\0') || (cursor[1] == '\0'))
+        {
+            return NULL;
+        }
+
+        cursor += 2;
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  Range API                                                             */
+/*                                                                        */
+/**************************************************************************/
+
+JX_STATUS jx_struct_to_json_range(JX_ELEMENT *element,
+                                  size_t element_size,
+                                  const JX_ELEMENT *records_element,
+                                  size_t first,
+                                  size_t count,
+                                  char *buffer,
+                                  size_t buffer_size,
+                                  JX_FORMAT format,
+                                  size_t *written)
+{
+    if ((!element) || (element_size == 0U) || (!records_element) ||
+        (!buffer) || (buffer_size == 0U) || (buffer_size > (size_t)INT_MAX) ||
+        (!JX_BACKEND_FORMAT_VALID(format)))
+    {
+        return JX_ERROR;
+    }
+
+    if (!jx_backend_write_range(element, element_size, records_element, first, count,
+                                buffer, buffer_size, format, written))
+    {
+        return JX_ERROR;
+    }
+
+    return JX_SUCCESS;
+}
+
+JX_STATUS jx_array_split(const char *json, JX_SPAN *items, size_t capacity, size_t *count)
+{
+    const char *cursor;
+    size_t found = 0U;
+
+    if ((!json) || (!count) || ((!items) && (capacity != 0U)))
+    {
+        return JX_ERROR;
+    }
+
+    *count = 0U;
+    cursor = jx_records_skip_ws(json);
+    if (*cursor != '[')
+    {
+        return JX_ERROR;
+    }
+
+    cursor = jx_records_skip_ws(cursor + 1);
+    if (*cursor == ']')
+    {
+        return (*jx_records_skip_ws(cursor + 1) == '\0') ? JX_SUCCESS : JX_ERROR;
+    }
+
+    for (;;)
+    {
+        const char *item = cursor;
+        const char *end;
+        size_t depth = 0U;
+
+        /* Jump between structural bytes; only strings and nesting matter here. */
+        for (;;)
+        {
+            while ((jx_records_scan_class[(uint8_t)*cursor] & JX_SCAN_STRUCTURE) == 0U)
+            {
+                cursor++;
+            }
+
+            if (*cursor == '\0')
+            {
+                return JX_ERROR;
+            }
+
+            if (*cursor == '"')
+            {
+                cursor = jx_records_skip_string(cursor + 1);
+                if (cursor == NULL)
+                {
+                    return JX_ERROR;
+                }
+                continue;
+            }
+
+            if ((*cursor == '{') || (*cursor == '['))
+            {
+                depth++;
+            }
+            else if (depth > 0U)
+            {
+                if (*cursor != ',')
+                {
+                    depth--;
+                }
+            }
+            else if ((*cursor == ',') || (*cursor == ']'))
+            {
+                break;
+            }
+            else
+            {
+                return JX_ERROR;
+            }
+
+            cursor++;
+        }
+
+        end = cursor;
+        while ((end > item) &&
+               ((end[-1] == ' ') || (end[-1] == '\t') || (end[-1] == '\n') || (end[-1] == '\r')))
+        {
+            end--;
+        }
+
+        if (end == item)
+        {
+            return JX_ERROR;
+        }
+
+        if (items != NULL)
+        {
+            if (found >= capacity)
+            {
+                return JX_ERROR;
+            }
+
+            items[found].offset = (size_t)(item - json);
+            items[found].length = (size_t)(end - item);
+        }
+        found++;
+
+        if (*cursor == ']')
+        {
+            break;
+        }
+
+        cursor = jx_records_skip_ws(cursor + 1);
+    }
+
+    if (*jx_records_skip_ws(cursor + 1) != '\0')
+    {
+        return JX_ERROR;
+    }
+
+    *count = found;
+    return JX_SUCCESS;
+}
+
+JX_STATUS jx_records_parse_items(JX_CONTEXT *context,
+                                 const char *json,
+                                 const JX_SPAN *items,
+                                 size_t first,
+                                 size_t count,
+                                 JX_ELEMENT *records_element,
+                                 JX_PARSE_MODE mode)
+{
+    JX_RECORDS *records;
+    JX_BACKEND_RELOCATION relocation;
+
+    if ((!context) || (!json) || (!items) || (!records_element) ||
+        (records_element->type != JX_RECORD_ARRAY) || (records_element->element == NULL))
+    {
+        return JX_ERROR;
+    }
+
+    records = (JX_RECORDS *)(uintptr_t)records_element->value_p;
+    if ((records == NULL) || (records->records == NULL) || (records->stride == 0U) ||
+        (first > records->capacity) || (count > (records->capacity - first)))
+    {
+        return JX_ERROR;
+    }
+
+    relocation.source = (const uint8_t *)records->records;
+    relocation.size = records->stride;
+
+    for (size_t i = first; i < (first + count); ++i)
+    {
+        relocation.target = (uint8_t *)records->records + (i * records->stride);
+        if (jx_backend_parse_span(&json[items[i].offset], items[i].length,
+                                  records_element->element, records_element->value_len,
+                                  mode, &context->error_ptr, &relocation) != JX_SUCCESS)
+        {
+            return JX_ERROR;
+        }
+    }
+
+    return JX_SUCCESS;
+}
+
+#if JX_ENABLE_PARALLEL_WRITE
+JX_STATUS jx_range_job_init(JX_RANGE_JOB *job, size_t total, size_t range_size)
+{
+    if ((!job) || (range_size == 0U))
+    {
+        return JX_ERROR;
+    }
+
+    job->total = total;
+    job->range_size = range_size;
+    jx_atomic_store_size(&job->next, 0U);
+    return JX_SUCCESS;
+}
+
+size_t jx_range_job_count(const JX_RANGE_JOB *job)
+{
+    if (job == NULL)
+    {
+        return 0U;
+    }
+
+    if (job->total == 0U)
+    {
+        return 1U;
+    }
+
+    return (job->total / job->range_size) + (((job->total % job->range_size) != 0U) ? 1U : 0U);
+}
+
+bool jx_range_job_claim(JX_RANGE_JOB *job, size_t *index, size_t *first, size_t *count)
+{
+    size_t claimed;
+
+    if ((!job) || (!index) || (!first) || (!count))
+    {
+        return false;
+    }
+
+    claimed = jx_atomic_add_size(&job->next, 1U) - 1U;
+    if (claimed >= jx_range_job_count(job))
+    {
+        return false;
+    }
+
+    *index = claimed;
+    *first = claimed * job->range_size;
+    *count = ((job->total - *first) < job->range_size) ? (job->total - *first) : job->range_size;
+    return true;
+}
+#endif
@@ -0,0 +1,104 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_seqlock.c                                                    */
+/*  @brief Seqlock-consistent serialization of live structures (JsonX)    */
+/*                                                                        */
+/*  The writer bumps a caller-owned sequence around each update. The      */
+/*  serializer copies the mapped fields into a packed staging area,       */
+/*  retries if the sequence moved, and formats from the copy.             */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+
+#if JX_ENABLE_SEQLOCK
+
+#include "../private/jx_atomic.h"
+#include "../private/jx_backend.h"
+
+#include <limits.h>
+
+/**************************************************************************/
+/*                                                                        */
+/*  Seqlock API                                                           */
+/*                                                                        */
+/**************************************************************************/
+
+void jx_seqlock_write_begin(JX_SEQUENCE *sequence)
+{
+    if (sequence == NULL)
+    {
+        return;
+    }
+
+    jx_atomic_store_size(sequence, jx_atomic_load_size(sequence) + 1U);
+    jx_atomic_release_fence();
+}
+
+void jx_seqlock_write_end(JX_SEQUENCE *sequence)
+{
+    if (sequence == NULL)
+    {
+        return;
+    }
+
+    jx_atomic_store_size(sequence, jx_atomic_load_size(sequence) + 1U);
+}
+
+size_t jx_struct_snapshot_size(const JX_ELEMENT *element, size_t element_size)
+{
+    return jx_backend_snapshot_size(element, element_size);
+}
+
+JX_STATUS jx_struct_to_json_consistent(const JX_SEQUENCE *sequence,
+                                       JX_ELEMENT *element,
+                                       size_t element_size,
+                                       void *staging,
+                                       size_t staging_size,
+                                       char *buffer,
+                                       size_t buffer_size,
+                                       JX_FORMAT format)
+{
+    if ((!sequence) || (!element) || (element_size == 0U) ||
+        (!staging) || (((uintptr_t)staging % sizeof(uint64_t)) != 0U) ||
+        (!buffer) || (buffer_size == 0U) || (buffer_size > (size_t)INT_MAX) ||
+        (!JX_BACKEND_FORMAT_VALID(format)))
+    {
+        return JX_ERROR;
+    }
+
+    for (uint32_t attempt = 0U; attempt < (uint32_t)JX_SEQLOCK_RETRY_LIMIT; ++attempt)
+    {
+        size_t before = jx_atomic_load_size(sequence);
+
+        if ((before & 1U) != 0U)
+        {
+            continue;
+        }
+
+        if (!jx_backend_snapshot_elements(element, element_size, staging, staging_size))
+        {
+            return JX_ERROR;
+        }
+
+        /* The copy must complete before the sequence is read again. */
+        jx_atomic_acquire_fence();
+        if (jx_atomic_load_size(sequence) != before)
+        {
+            continue;
+        }
+
+        if (!jx_backend_write_snapshot(element, element_size, staging, buffer, buffer_size, format))
+        {
+            return JX_ERROR;
+        }
+
+        return JX_SUCCESS;
+    }
+
+    return JX_ERROR;
+}
+
+#endif /* JX_ENABLE_SEQLOCK */
@@ -0,0 +1,71 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_shape.c                                                      */
+/*  @brief Structural shape cache for repeated document layouts (JsonX)   */
+/*                                                                        */
+/*  Documents that repeat one layout and differ only in values are        */
+/*  checked against the recorded skeleton instead of being tokenized.     */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "../private/jx_backend.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  Shape API                                                             */
+/*                                                                        */
+/**************************************************************************/
+
+JX_STATUS jx_shape_init(JX_SHAPE *shape,
+                        char *skeleton,
+                        size_t skeleton_size,
+                        JX_SHAPE_SLOT *slots,
+                        size_t slot_capacity)
+{
+    if ((!shape) || (!skeleton) || (skeleton_size == 0U) || (!slots) || (slot_capacity == 0U))
+    {
+        return JX_ERROR;
+    }
+
+    shape->skeleton = skeleton;
+    shape->skeleton_size = skeleton_size;
+    shape->slots = slots;
+    shape->slot_capacity = slot_capacity;
+    shape->hits = 0U;
+    shape->misses = 0U;
+    jx_shape_reset(shape);
+    return JX_SUCCESS;
+}
+
+void jx_shape_reset(JX_SHAPE *shape)
+{
+    if (!shape)
+    {
+        return;
+    }
+
+    shape->skeleton_length = 0U;
+    shape->slot_count = 0U;
+    shape->mapping = NULL;
+    shape->mapping_size = 0U;
+    shape->mode = JX_MODE_RELAXED;
+    shape->valid = false;
+}
+
+JX_STATUS jx_context_json_to_struct_shaped(JX_CONTEXT *context,
+                                           JX_SHAPE *shape,
+                                           char *buffer,
+                                           JX_ELEMENT *element,
+                                           size_t element_size,
+                                           JX_PARSE_MODE mode)
+{
+    if ((!context) || (!shape) || (!shape->skeleton) || (!shape->slots))
+    {
+        return JX_ERROR;
+    }
+
+    return jx_backend_parse_shaped(buffer, element, element_size, mode, &context->error_ptr, shape);
+}
@@ -0,0 +1,227 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_slab_allocator.c                                             */
+/*  @brief Size-Class Slab Allocator for Baremetal Mode (JsonX)           */
+/*                                                                        */
+/*  Manages a fixed buffer as power-of-two size classes with per-class    */
+/*  free lists. Selected for the static pool by JX_ENABLE_SLAB_ALLOCATOR. */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "../private/jx_slab_allocator.h"
+
+#include <string.h>
+
+#ifndef ALIGN_4
+#define ALIGN_4(x)  (((x) + 3) & ~3)
+#endif
+
+/**************************************************************************/
+/*                                                                        */
+/*  Block Header                                                          */
+/*                                                                        */
+/**************************************************************************/
+
+/* Header layout: bits 0..6 class index, bit 7 free flag, bits 8..31 size. */
+#define JX_SLAB_HEADER_SIZE     4U
+#define JX_SLAB_CLASS_MASK      0x7FU
+#define JX_SLAB_FREE_FLAG       0x80U
+#define JX_SLAB_CLASS_LARGE     0x7FU
+#define JX_SLAB_MAX_REQUEST     0x00FFFFFFU
+
+static uint32_t jx_slab_read_header(const uint8_t *block)
+{
+    uint32_t header;
+
+    memcpy(&header, block - JX_SLAB_HEADER_SIZE, sizeof(header));
+    return header;
+}
+
+static void jx_slab_write_header(uint8_t *block, uint32_t class_index, size_t size)
+{
+    uint32_t header = (class_index & 0xFFU) | ((uint32_t)size << 8);
+
+    memcpy(block - JX_SLAB_HEADER_SIZE, &header, sizeof(header));
+}
+
+static size_t jx_slab_class_size(uint32_t class_index)
+{
+    return (size_t)JX_SLAB_MIN_BLOCK_SIZE << class_index;
+}
+
+static uint32_t jx_slab_class_for(size_t size)
+{
+    uint32_t class_index = 0U;
+
+    while ((class_index < JX_SLAB_CLASS_COUNT) && (jx_slab_class_size(class_index) < size))
+    {
+        class_index++;
+    }
+
+    return (class_index < JX_SLAB_CLASS_COUNT) ? class_index : JX_SLAB_CLASS_LARGE;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  Slab API                                                              */
+/*                                                                        */
+/**************************************************************************/
+
+jx_slab_allocator_t *jx_slab_allocator_init(void *buffer, size_t size)
+{
+    jx_slab_allocator_t *slab;
+
+    if ((buffer == NULL) || (size < ALIGN_4(sizeof(jx_slab_allocator_t))))
+    {
+        return NULL;
+    }
+
+    slab = (jx_slab_allocator_t *)buffer;
+    memset(slab, 0, sizeof(jx_slab_allocator_t));
+    if (jx_arena_init(&slab->carve,
+                      (uint8_t *)buffer + ALIGN_4(sizeof(jx_slab_allocator_t)),
+                      size - ALIGN_4(sizeof(jx_slab_allocator_t))) != JX_SUCCESS)
+    {
+        return NULL;
+    }
+
+    return slab;
+}
+
+void *jx_slab_malloc(jx_slab_allocator_t *slab, size_t size)
+{
+    uint32_t class_index;
+    size_t block_size;
+    uint8_t *block;
+
+    if (slab == NULL)
+    {
+        return NULL;
+    }
+
+    if ((size == 0U) || (size > JX_SLAB_MAX_REQUEST))
+    {
+        slab->failed_allocations++;
+        return NULL;
+    }
+
+    class_index = jx_slab_class_for(size);
+    if (class_index == JX_SLAB_CLASS_LARGE)
+    {
+        block_size = ALIGN_4(size);
+        block = NULL;
+    }
+    else
+    {
+        block_size = jx_slab_class_size(class_index);
+        block = (uint8_t *)slab->free_list[class_index];
+    }
+
+    if (block != NULL)
+    {
+        void *next;
+
+        memcpy(&next, block, sizeof(next));
+        slab->free_list[class_index] = next;
+        slab->free_list_bytes -= block_size;
+    }
+    else
+    {
+        block = (uint8_t *)jx_arena_alloc(&slab->carve, JX_SLAB_HEADER_SIZE + block_size);
+        if (block == NULL)
+        {
+            slab->failed_allocations++;
+            return NULL;
+        }
+        block += JX_SLAB_HEADER_SIZE;
+    }
+
+    jx_slab_write_header(block, class_index, size);
+    slab->live_bytes += size;
+    slab->live_block_bytes += block_size;
+    slab->live_allocations++;
+    return block;
+}
+
+void jx_slab_free(jx_slab_allocator_t *slab, void *ptr)
+{
+    uint8_t *block = (uint8_t *)ptr;
+    uint32_t header;
+    uint32_t class_index;
+    size_t size;
+    size_t block_size;
+
+    if ((slab == NULL) || (block == NULL))
+    {
+        return;
+    }
+
+    header = jx_slab_read_header(block);
+    if ((header & JX_SLAB_FREE_FLAG) != 0U)
+    {
+        return;
+    }
+
+    class_index = header & JX_SLAB_CLASS_MASK;
+    size = (size_t)(header >> 8);
+    block_size = (class_index == JX_SLAB_CLASS_LARGE) ? ALIGN_4(size) : jx_slab_class_size(class_index);
+
+    slab->live_bytes -= size;
+    slab->live_block_bytes -= block_size;
+    slab->live_allocations--;
+    jx_slab_write_header(block, class_index | JX_SLAB_FREE_FLAG, size);
+
+    if (class_index == JX_SLAB_CLASS_LARGE)
+    {
+        /* Large blocks are only reclaimed when they are the last carve. */
+        if ((block + block_size) == (slab->carve.pool_start + slab->carve.pool_offset))
+        {
+            slab->carve.pool_offset -= JX_SLAB_HEADER_SIZE + block_size;
+        }
+        return;
+    }
+
+    memcpy(block, &slab->free_list[class_index], sizeof(void *));
+    slab->free_list[class_index] = block;
+    slab->free_list_bytes += block_size;
+}
+
+void jx_slab_reset(jx_slab_allocator_t *slab)
+{
+    if (slab == NULL)
+    {
+        return;
+    }
+
+    jx_arena_reset(&slab->carve);
+    memset(slab->free_list, 0, sizeof(slab->free_list));
+    slab->live_bytes = 0U;
+    slab->live_block_bytes = 0U;
+    slab->free_list_bytes = 0U;
+    slab->live_allocations = 0U;
+}
+
+void jx_slab_get_stats(const jx_slab_allocator_t *slab, JX_ALLOCATOR_STATS *stats)
+{
+    if (stats == NULL)
+    {
+        return;
+    }
+
+    memset(stats, 0, sizeof(JX_ALLOCATOR_STATS));
+    if (slab == NULL)
+    {
+        return;
+    }
+
+    stats->pool_size          = slab->carve.pool_size;
+    stats->carved_bytes       = slab->carve.pool_offset;
+    stats->live_bytes         = slab->live_bytes;
+    stats->live_block_bytes   = slab->live_block_bytes;
+    stats->free_list_bytes    = slab->free_list_bytes;
+    stats->live_allocations   = slab->live_allocations;
+    stats->failed_allocations = slab->failed_allocations;
+}
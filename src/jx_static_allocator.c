@@ -15,6 +15,7 @@
 
 #ifdef JX_USE_BAREMETAL
 
+#include "jx_api.h"
 #include "../private/jx_static_allocator.h"
 
 #ifdef JX_USE_HEAP_BAREMETAL
@@ -37,13 +38,30 @@ static jx_static_allocator_t *allocator = NULL;
  */
 jx_static_allocator_t *jx_static_allocator_init(void *buffer, size_t size)
 {
+    jx_static_allocator_t *instance;
+    JX_STATUS status;
+
     if (!buffer || size < ALIGN_4(sizeof(jx_static_allocator_t)))
         return NULL;
 
-    allocator = (jx_static_allocator_t *)buffer;
-    allocator->pool_start  = (uint8_t *)buffer + ALIGN_4(sizeof(jx_static_allocator_t));
-    allocator->pool_size   = size - ALIGN_4(sizeof(jx_static_allocator_t));
-    allocator->pool_offset = 0;
+#if JX_ENABLE_SLAB_ALLOCATOR
+    instance = jx_slab_allocator_init(buffer, size);
+    status = (instance != NULL) ? JX_SUCCESS : JX_ERROR;
+#elif JX_ENABLE_ATOMIC_ARENA
+    instance = (jx_static_allocator_t *)buffer;
+    status = jx_arena_init_shared(instance,
+                                  (uint8_t *)buffer + ALIGN_4(sizeof(jx_static_allocator_t)),
+                                  size - ALIGN_4(sizeof(jx_static_allocator_t)));
+#else
+    instance = (jx_static_allocator_t *)buffer;
+    status = jx_arena_init(instance,
+                           (uint8_t *)buffer + ALIGN_4(sizeof(jx_static_allocator_t)),
+                           size - ALIGN_4(sizeof(jx_static_allocator_t)));
+#endif
+    if (status != JX_SUCCESS)
+        return NULL;
+
+    allocator = instance;
     return allocator;
 }
 #endif /* !JX_USE_HEAP_BAREMETAL */
@@ -62,15 +80,11 @@ void *jx_static_malloc(size_t size)
 #ifdef JX_USE_HEAP_BAREMETAL
     void *ptr = malloc(ALIGN_4(size));
 #else
-    if (!allocator || size == 0)
-        return NULL;
-
-    size = ALIGN_4(size);
-    if (allocator->pool_offset + size > allocator->pool_size)
-        return NULL;
-
-    void *ptr = allocator->pool_start + allocator->pool_offset;
-    allocator->pool_offset += size;
+#if JX_ENABLE_SLAB_ALLOCATOR
+    void *ptr = jx_slab_malloc(allocator, size);
+#else
+    void *ptr = jx_arena_alloc(allocator, size);
+#endif
 #endif
     return ptr;
 }
@@ -78,8 +92,9 @@ void *jx_static_malloc(size_t size)
 /**
  * @brief Free memory block.
  *
- * This is a no-op for static mode, but required to satisfy APIs
- * that expect a deallocation hook.
+ * This is a no-op for the static bump pool, but required to satisfy
+ * APIs that expect a deallocation hook. The slab pool returns the block
+ * to its size-class free list.
  *
  * @param ptr Pointer to memory block (may be NULL).
  */
@@ -87,8 +102,10 @@ void jx_static_free(void *ptr)
 {
 #ifdef JX_USE_HEAP_BAREMETAL
     free(ptr);
+#elif JX_ENABLE_SLAB_ALLOCATOR
+    jx_slab_free(allocator, ptr);
 #endif
-    (void)ptr;// noop in static mode
+    (void)ptr;// noop in static bump mode
 }
 
 #ifndef JX_USE_HEAP_BAREMETAL
@@ -99,8 +116,36 @@ void jx_static_free(void *ptr)
  */
 void jx_static_reset(void)
 {
-    if (allocator)
-        allocator->pool_offset = 0;
+#if JX_ENABLE_SLAB_ALLOCATOR
+    jx_slab_reset(allocator);
+#else
+    jx_arena_reset(allocator);
+#endif
+}
+
+/**
+ * @brief Report usage counters of the static pool.
+ *
+ * The bump pool does not track individual allocations, so only the pool
+ * size and the carved offset are reported.
+ */
+void jx_static_get_stats(JX_ALLOCATOR_STATS *stats)
+{
+#if JX_ENABLE_SLAB_ALLOCATOR
+    jx_slab_get_stats(allocator, stats);
+#else
+    if (!stats)
+        return;
+
+    memset(stats, 0, sizeof(JX_ALLOCATOR_STATS));
+    if (!allocator)
+        return;
+
+    stats->pool_size        = allocator->pool_size;
+    stats->carved_bytes     = jx_arena_used(allocator);
+    stats->live_bytes       = stats->carved_bytes;
+    stats->live_block_bytes = stats->carved_bytes;
+#endif
 }
 #endif /* !JX_USE_HEAP_BAREMETAL */
 
@@ -0,0 +1,278 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_stream.c                                                     */
+/*  @brief Incremental input framing for JsonX                            */
+/*                                                                        */
+/*  Accepts a JSON document in arbitrary byte slices (socket reads, UART  */
+/*  frames) and detects the end of the root value without rescanning.     */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "../private/jx_internal.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  Framing States                                                        */
+/*                                                                        */
+/**************************************************************************/
+
+enum
+{
+    JX_STREAM_STATE_START = 0,
+    JX_STREAM_STATE_VALUE,
+    JX_STREAM_STATE_STRING,
+    JX_STREAM_STATE_ESCAPE,
+#if JX_ENABLE_JSON_COMMENTS
+    JX_STREAM_STATE_SLASH,
+    JX_STREAM_STATE_LINE_COMMENT,
+    JX_STREAM_STATE_BLOCK_COMMENT,
+    JX_STREAM_STATE_BLOCK_STAR,
+#endif
+    JX_STREAM_STATE_ERROR
+};
+
+#if JX_ENABLE_JSON_COMMENTS
+static uint8_t jx_stream_outer_state(const JX_STREAM *stream)
+{
+    return (stream->depth == 0U) ? JX_STREAM_STATE_START : JX_STREAM_STATE_VALUE;
+}
+#endif
+
+/**
+ * @brief Advance the framing state machine by one input byte.
+ *
+ * Only structure is tracked here: string boundaries, escapes, comments and
+ * container depth. Grammar is validated later by the mapping parser.
+ */
+static void jx_stream_step(JX_STREAM *stream, char c)
+{
+    switch (stream->state)
+    {
+    case JX_STREAM_STATE_START:
+        if ((c == ' ') || (c == '\t') || (c == '\n') || (c == '\r'))
+        {
+            break;
+        }
+#if JX_ENABLE_JSON_COMMENTS
+        if (c == '/')
+        {
+            stream->state = JX_STREAM_STATE_SLASH;
+            break;
+        }
+#endif
+        if ((c == '{') || (c == '['))
+        {
+            stream->depth = 1U;
+            stream->state = JX_STREAM_STATE_VALUE;
+            break;
+        }
+        stream->state = JX_STREAM_STATE_ERROR;
+        break;
+
+    case JX_STREAM_STATE_VALUE:
+        if (c == '"')
+        {
+            stream->state = JX_STREAM_STATE_STRING;
+        }
+        else if ((c == '{') || (c == '['))
+        {
+            if (stream->depth == UINT16_MAX)
+            {
+                stream->state = JX_STREAM_STATE_ERROR;
+                break;
+            }
+            stream->depth++;
+        }
+        else if ((c == '}') || (c == ']'))
+        {
+            stream->depth--;
+            if (stream->depth == 0U)
+            {
+                stream->complete = true;
+            }
+        }
+#if JX_ENABLE_JSON_COMMENTS
+        else if (c == '/')
+        {
+            stream->state = JX_STREAM_STATE_SLASH;
+        }
+#endif
+        break;
+
+    case JX_STREAM_STATE_STRING:
+        if (c == '\\')
+        {
+            stream->state = JX_STREAM_STATE_ESCAPE;
+        }
+        else if (c == '"')
+        {
+            stream->state = JX_STREAM_STATE_VALUE;
+        }
+        break;
+
+    case JX_STREAM_STATE_ESCAPE:
+        stream->state = JX_STREAM_STATE_STRING;
+        break;
+
+#if JX_ENABLE_JSON_COMMENTS
+    case JX_STREAM_STATE_SLASH:
+        if (c == '/')
+        {
+            stream->state = JX_STREAM_STATE_LINE_COMMENT;
+        }
+        else if (c == '*')
+        {
+            stream->state = JX_STREAM_STATE_BLOCK_COMMENT;
+        }
+        else
+        {
+            /* Not a comment; the parser reports the stray slash. */
+            stream->state = jx_stream_outer_state(stream);
+            jx_stream_step(stream, c);
+        }
+        break;
+
+    case JX_STREAM_STATE_LINE_COMMENT:
+        if ((c == '\n') || (c == '\r'))
+        {
+            stream->state = jx_stream_outer_state(stream);
+        }
+        break;
+
+    case JX_STREAM_STATE_BLOCK_COMMENT:
+        if (c == '*')
+        {
+            stream->state = JX_STREAM_STATE_BLOCK_STAR;
+        }
+        break;
+
+    case JX_STREAM_STATE_BLOCK_STAR:
+        if (c == '/')
+        {
+            stream->state = jx_stream_outer_state(stream);
+        }
+        else if (c != '*')
+        {
+            stream->state = JX_STREAM_STATE_BLOCK_COMMENT;
+        }
+        break;
+#endif
+
+    default:
+        stream->state = JX_STREAM_STATE_ERROR;
+        break;
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  Public Stream API                                                     */
+/*                                                                        */
+/**************************************************************************/
+
+JX_STATUS jx_stream_init(JX_STREAM *stream, char *buffer, size_t size)
+{
+    if ((stream == NULL) || (buffer == NULL) || (size < 2U))
+    {
+        return JX_ERROR;
+    }
+
+    memset(stream, 0, sizeof(JX_STREAM));
+    stream->buffer = buffer;
+    stream->size = size;
+    stream->buffer[0] = '\0';
+    return JX_SUCCESS;
+}
+
+void jx_stream_reset(JX_STREAM *stream)
+{
+    if (stream == NULL)
+    {
+        return;
+    }
+
+    stream->length = 0U;
+    stream->depth = 0U;
+    stream->state = JX_STREAM_STATE_START;
+    stream->complete = false;
+}
+
+JX_STATUS jx_stream_feed(JX_STREAM *stream, const char *data, size_t length, size_t *consumed)
+{
+    size_t used = 0U;
+
+    if (consumed != NULL)
+    {
+        *consumed = 0U;
+    }
+
+    if ((stream == NULL) || (stream->buffer == NULL) ||
+        ((data == NULL) && (length != 0U)) ||
+        (stream->state == JX_STREAM_STATE_ERROR))
+    {
+        return JX_ERROR;
+    }
+
+    while ((used < length) && !stream->complete)
+    {
+        char c = data[used];
+
+        if ((c == '\0') || ((stream->length + 1U) >= stream->size))
+        {
+            stream->state = JX_STREAM_STATE_ERROR;
+            break;
+        }
+
+        stream->buffer[stream->length++] = c;
+        used++;
+
+        jx_stream_step(stream, c);
+        if (stream->state == JX_STREAM_STATE_ERROR)
+        {
+            break;
+        }
+    }
+
+    stream->buffer[stream->length] = '\0';
+    if ((stream->digest != NULL) && (used != 0U))
+    {
+        jx_digest_update(stream->digest, data, used);
+    }
+
+    if (consumed != NULL)
+    {
+        *consumed = used;
+    }
+
+    return (stream->state == JX_STREAM_STATE_ERROR) ? JX_ERROR : JX_SUCCESS;
+}
+
+void jx_stream_set_digest(JX_STREAM *stream, JX_DIGEST *digest)
+{
+    if (stream != NULL)
+    {
+        stream->digest = digest;
+    }
+}
+
+bool jx_stream_is_complete(const JX_STREAM *stream)
+{
+    return (stream != NULL) && stream->complete;
+}
+
+JX_STATUS jx_stream_parse(JX_STREAM *stream, JX_ELEMENT *element, size_t element_size, JX_PARSE_MODE mode)
+{
+    JX_STATUS status;
+
+    if (!jx_stream_is_complete(stream))
+    {
+        return JX_ERROR;
+    }
+
+    status = jx_json_to_struct(stream->buffer, element, element_size, mode);
+    jx_stream_reset(stream);
+    return status;
+}
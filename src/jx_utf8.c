@@ -0,0 +1,245 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_utf8.c                                                       */
+/*  @brief UTF-8 validation and encoding (JsonX)                          */
+/*                                                                        */
+/*  Scalar validator following the well-formed byte table of Unicode      */
+/*  section 3.9, with an 8-byte ASCII fast path for bounded buffers.      */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "../private/jx_utf8.h"
+
+#include <string.h>
+
+#define JX_UTF8_ASCII_MASK      0x8080808080808080ULL
+
+/**************************************************************************/
+/*                                                                        */
+/*  Local Functions                                                       */
+/*                                                                        */
+/**************************************************************************/
+
+static bool jx_utf8_is_continuation(uint8_t byte)
+{
+    return (byte & 0xC0U) == 0x80U;
+}
+
+/* Bytes a lead byte announces; the sequence itself is checked separately. */
+static size_t jx_utf8_expected_length(uint8_t lead)
+{
+    if (lead < 0x80U)
+    {
+        return 1U;
+    }
+    if (lead < 0xE0U)
+    {
+        return 2U;
+    }
+    if (lead < 0xF0U)
+    {
+        return 3U;
+    }
+
+    return 4U;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  Private API                                                           */
+/*                                                                        */
+/**************************************************************************/
+
+size_t jx_utf8_sequence_length(const uint8_t *text)
+{
+    uint8_t lead = text[0];
+    uint8_t low = 0x80U;
+    uint8_t high = 0xBFU;
+
+    if (lead < 0x80U)
+    {
+        return 1U;
+    }
+
+    /* 0x80..0xC1 are continuations or overlong two-byte leads. */
+    if (lead < 0xC2U)
+    {
+        return 0U;
+    }
+
+    if (lead < 0xE0U)
+    {
+        return jx_utf8_is_continuation(text[1]) ? 2U : 0U;
+    }
+
+    if (lead < 0xF0U)
+    {
+        if (lead == 0xE0U)
+        {
+            low = 0xA0U;            /* overlong */
+        }
+        else if (lead == 0xEDU)
+        {
+            high = 0x9FU;           /* surrogates */
+        }
+
+        return ((text[1] >= low) && (text[1] <= high) && jx_utf8_is_continuation(text[2])) ? 3U : 0U;
+    }
+
+    if (lead < 0xF5U)
+    {
+        if (lead == 0xF0U)
+        {
+            low = 0x90U;            /* overlong */
+        }
+        else if (lead == 0xF4U)
+        {
+            high = 0x8FU;           /* above U+10FFFF */
+        }
+
+        return ((text[1] >= low) && (text[1] <= high) &&
+                jx_utf8_is_continuation(text[2]) && jx_utf8_is_continuation(text[3])) ? 4U : 0U;
+    }
+
+    return 0U;
+}
+
+size_t jx_utf8_decode(const uint8_t *text, uint32_t *code)
+{
+    static const uint8_t lead_mask[5] = { 0x00U, 0x7FU, 0x1FU, 0x0FU, 0x07U };
+    size_t length = jx_utf8_sequence_length(text);
+
+    if (length == 0U)
+    {
+        return 0U;
+    }
+
+    *code = text[0] & lead_mask[length];
+    for (size_t i = 1U; i < length; ++i)
+    {
+        *code = (*code << 6) | (text[i] & 0x3FU);
+    }
+
+    return length;
+}
+
+size_t jx_utf8_encode(uint32_t code, uint8_t *output)
+{
+    if (code < 0x80U)
+    {
+        output[0] = (uint8_t)code;
+        return 1U;
+    }
+
+    if (code < 0x800U)
+    {
+        output[0] = (uint8_t)(0xC0U | (code >> 6));
+        output[1] = (uint8_t)(0x80U | (code & 0x3FU));
+        return 2U;
+    }
+
+    if (code < 0x10000UL)
+    {
+        if ((code >= 0xD800U) && (code <= 0xDFFFU))
+        {
+            return 0U;
+        }
+
+        output[0] = (uint8_t)(0xE0U | (code >> 12));
+        output[1] = (uint8_t)(0x80U | ((code >> 6) & 0x3FU));
+        output[2] = (uint8_t)(0x80U | (code & 0x3FU));
+        return 3U;
+    }
+
+    if (code <= JX_UTF8_MAX_CODE_POINT)
+    {
+        output[0] = (uint8_t)(0xF0U | (code >> 18));
+        output[1] = (uint8_t)(0x80U | ((code >> 12) & 0x3FU));
+        output[2] = (uint8_t)(0x80U | ((code >> 6) & 0x3FU));
+        output[3] = (uint8_t)(0x80U | (code & 0x3FU));
+        return 4U;
+    }
+
+    return 0U;
+}
+
+size_t jx_utf8_complete_length(const uint8_t *text, size_t length)
+{
+    /* A cut sequence starts at most three bytes before the end. */
+    for (size_t back = 1U; (back <= 3U) && (back <= length); ++back)
+    {
+        uint8_t byte = text[length - back];
+
+        if (!jx_utf8_is_continuation(byte))
+        {
+            return (jx_utf8_expected_length(byte) > back) ? (length - back) : length;
+        }
+    }
+
+    return length;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  Public API                                                            */
+/*                                                                        */
+/**************************************************************************/
+
+bool jx_utf8_validate(const char *data, size_t length)
+{
+    const uint8_t *cursor = (const uint8_t *)data;
+    const uint8_t *end;
+
+    if ((data == NULL) && (length != 0U))
+    {
+        return false;
+    }
+
+    end = cursor + length;
+    while (cursor < end)
+    {
+        size_t sequence;
+
+        /* Skip eight ASCII bytes per step; memcpy keeps the load unaligned-safe. */
+        while ((size_t)(end - cursor) >= sizeof(uint64_t))
+        {
+            uint64_t word;
+
+            memcpy(&word, cursor, sizeof(word));
+            if ((word & JX_UTF8_ASCII_MASK) != 0U)
+            {
+                break;
+            }
+            cursor += sizeof(word);
+        }
+
+        if (cursor >= end)
+        {
+            break;
+        }
+
+        if (*cursor < 0x80U)
+        {
+            cursor++;
+            continue;
+        }
+
+        /* The sequence check may read its announced length, so bound it first. */
+        if (jx_utf8_expected_length(*cursor) > (size_t)(end - cursor))
+        {
+            return false;
+        }
+
+        sequence = jx_utf8_sequence_length(cursor);
+        if (sequence == 0U)
+        {
+            return false;
+        }
+        cursor += sequence;
+    }
+
+    return true;
+}
@@ -0,0 +1,465 @@
+/**************************************************************************/
+/*                                                                        */
+/*  @file jx_validate.c                                                   */
+/*  @brief Mapping-free validation and minification (JsonX)               */
+/*                                                                        */
+/*  A bounded structural pass proves the document ends inside the given   */
+/*  length; the native reader then checks the grammar up to that end.     */
+/*                                                                        */
+/*  @author Mihail Zamurca                                                */
+/*                                                                        */
+/**************************************************************************/
+
+#include "jx_api.h"
+#include "../private/jx_backend.h"
+
+#include <string.h>
+
+/* Classes up to SPACE need no attention inside containers, classes below QUOTE none inside strings. */
+#define JX_VALIDATE_TOKEN   0U      /* Number and literal bytes */
+#define JX_VALIDATE_PUNCT   1U      /* Comma and colon */
+#define JX_VALIDATE_SPACE   2U
+#define JX_VALIDATE_OPEN    3U
+#define JX_VALIDATE_CLOSE   4U
+#define JX_VALIDATE_SLASH   5U      /* Comment start, when comments are enabled */
+#define JX_VALIDATE_QUOTE   6U
+#define JX_VALIDATE_ESCAPE  7U
+#define JX_VALIDATE_STOP    8U      /* NUL never occurs in a document */
+
+/* One table lookup per byte; short tokens and strings make wider loads a loss. */
+static const uint8_t jx_validate_class[256] =
+{
+    ['\0'] = JX_VALIDATE_STOP,
+    [' ']  = JX_VALIDATE_SPACE,
+    ['\t'] = JX_VALIDATE_SPACE,
+    ['\n'] = JX_VALIDATE_SPACE,
+    ['\r'] = JX_VALIDATE_SPACE,
+    ['"']  = JX_VALIDATE_QUOTE,
+    ['\\'] = JX_VALIDATE_ESCAPE,
+    ['{']  = JX_VALIDATE_OPEN,
+    ['[']  = JX_VALIDATE_OPEN,
+    ['}']  = JX_VALIDATE_CLOSE,
+    [']']  = JX_VALIDATE_CLOSE,
+    [',']  = JX_VALIDATE_PUNCT,
+    [':']  = JX_VALIDATE_PUNCT,
+#if JX_ENABLE_JSON_COMMENTS
+    ['/']  = JX_VALIDATE_SLASH
+#endif
+};
+
+/**************************************************************************/
+/*                                                                        */
+/*  Local Functions                                                       */
+/*                                                                        */
+/**************************************************************************/
+
+/* Returns the byte after the closing quote, or NULL when the string does not end before end. */
+static const char *jx_validate_skip_string(const char *cursor, const char *end)
+{
+    cursor++;
+    for (;;)
+    {
+        while ((cursor < end) && (jx_validate_class[(uint8_t)*cursor] < JX_VALIDATE_QUOTE))
+        {
+            cursor++;
+        }
+
+        if ((cursor >= end) || (*cursor == '\0'))
+        {
+            return NULL;
+        }
+
+        if (*cursor == '"')
+        {
+            return cursor + 1;
+        }
+
+        /* Skip the escaped byte; the reader checks the escape itself. */
+        if ((end - cursor) < 2)
+        {
+            return NULL;
+        }
+        cursor += 2;
+    }
+}
+
+#if JX_ENABLE_JSON_COMMENTS
+/* Same comment forms as the reader; returns NULL for an unterminated or stray slash. */
+static const char *jx_validate_skip_comment(const char *cursor, const char *end)
+{
+    if (((end - cursor) < 2) || ((cursor[1] != '/') && (cursor[1] != '*')))
+    {
+        return NULL;
+    }
+
+    if (cursor[1] == '/')
+    {
+        cursor += 2;
+        while ((cursor < end) && (*cursor != '\n') && (*cursor != '\r') && (*cursor != '\0'))
+        {
+            cursor++;
+        }
+        return ((cursor < end) && (*cursor == '\0')) ? NULL : cursor;
+    }
+
+    for (cursor += 2; (end - cursor) >= 2; ++cursor)
+    {
+        if (*cursor == '\0')
+        {
+            return NULL;
+        }
+        if ((cursor[0] == '*') && (cursor[1] == '/'))
+        {
+            return cursor + 2;
+        }
+    }
+
+    return NULL;
+}
+#endif
+
+/* Returns the end of a run of decimal digits. */
+static const char *jx_validate_digits(const char *cursor, const char *end)
+{
+    while ((cursor < end) && (*cursor >= '0') && (*cursor <= '9'))
+    {
+        cursor++;
+    }
+
+    return cursor;
+}
+
+/*
+ * Checks a top-level number or literal. It may end exactly at length,
+ * where the reader would read on, so its grammar is checked here.
+ */
+static bool jx_validate_scalar(const char *token, size_t length)
+{
+    const char *cursor = token;
+    const char *end = token + length;
+    const char *digits;
+
+    if (((length == 4U) && ((memcmp(token, "true", 4U) == 0) || (memcmp(token, "null", 4U) == 0))) ||
+        ((length == 5U) && (memcmp(token, "false", 5U) == 0)))
+    {
+        return true;
+    }
+
+    if ((cursor < end) && (*cursor == '-'))
+    {
+        cursor++;
+    }
+
+    digits = cursor;
+    cursor = ((cursor < end) && (*cursor == '0')) ? (cursor + 1) : jx_validate_digits(cursor, end);
+    if (cursor == digits)
+    {
+        return false;
+    }
+
+    if ((cursor < end) && (*cursor == '.'))
+    {
+        digits = ++cursor;
+        cursor = jx_validate_digits(cursor, end);
+        if (cursor == digits)
+        {
+            return false;
+        }
+    }
+
+    if ((cursor < end) && ((*cursor == 'e') || (*cursor == 'E')))
+    {
+        cursor++;
+        if ((cursor < end) && ((*cursor == '+') || (*cursor == '-')))
+        {
+            cursor++;
+        }
+
+        digits = cursor;
+        cursor = jx_validate_digits(cursor, end);
+        if (cursor == digits)
+        {
+            return false;
+        }
+    }
+
+    return cursor == end;
+}
+
+/*
+ * Finds the first byte of the top-level value and the byte after it without
+ * copying anything. Only strings, comments, nesting and token boundaries
+ * are followed; the reader checks the rest.
+ */
+static bool jx_validate_bounds(const char *json, size_t length, const char **start, const char **close)
+{
+    const char *cursor = json;
+    const char *end = json + length;
+    size_t depth = 0U;
+
+    *start = NULL;
+    *close = NULL;
+    while (cursor < end)
+    {
+        if (depth > 0U)
+        {
+            while ((cursor < end) && (jx_validate_class[(uint8_t)*cursor] <= JX_VALIDATE_SPACE))
+            {
+                cursor++;
+            }
+
+            if (cursor >= end)
+            {
+                return false;
+            }
+        }
+        else if ((jx_validate_class[(uint8_t)*cursor] != JX_VALIDATE_SPACE) &&
+                 (jx_validate_class[(uint8_t)*cursor] != JX_VALIDATE_SLASH))
+        {
+            /* Only one value may start at the top level. */
+            if (*start != NULL)
+            {
+                return false;
+            }
+            *start = cursor;
+        }
+
+        switch (jx_validate_class[(uint8_t)*cursor])
+        {
+        case JX_VALIDATE_SPACE:
+            cursor++;
+            break;
+
+#if JX_ENABLE_JSON_COMMENTS
+        case JX_VALIDATE_SLASH:
+            cursor = jx_validate_skip_comment(cursor, end);
+            if (cursor == NULL)
+            {
+                return false;
+            }
+            break;
+#endif
+
+        case JX_VALIDATE_TOKEN:
+            /* Inside containers tokens are skipped above, so this is a top-level scalar. */
+            while ((cursor < end) && (jx_validate_class[(uint8_t)*cursor] == JX_VALIDATE_TOKEN))
+            {
+                cursor++;
+            }
+            *close = cursor;
+            break;
+
+        case JX_VALIDATE_OPEN:
+            if (depth >= JX_VALIDATE_MAX_DEPTH)
+            {
+                return false;
+            }
+            depth++;
+            cursor++;
+            break;
+
+        case JX_VALIDATE_CLOSE:
+            if (depth == 0U)
+            {
+                return false;
+            }
+            cursor++;
+            if (--depth == 0U)
+            {
+                *close = cursor;
+            }
+            break;
+
+        case JX_VALIDATE_QUOTE:
+            cursor = jx_validate_skip_string(cursor, end);
+            if (cursor == NULL)
+            {
+                return false;
+            }
+            if (depth == 0U)
+            {
+                *close = cursor;
+            }
+            break;
+
+        default:
+            return false;
+        }
+    }
+
+    return (*close != NULL) && (depth == 0U);
+}
+
+/*
+ * Copies the document to out without insignificant whitespace (and
+ * comments). Only strings, nesting and token boundaries are checked.
+ */
+static bool jx_validate_minify(const char *json, size_t length, char *out, size_t *written)
+{
+    const char *cursor = json;
+    const char *end = json + length;
+    char *write = out;
+    size_t depth = 0U;
+    bool after_token = false;
+    bool closed = false;
+
+    while (cursor < end)
+    {
+        const char *run = cursor;
+        bool token = false;
+
+        switch (jx_validate_class[(uint8_t)*cursor])
+        {
+        case JX_VALIDATE_SPACE:
+            while ((cursor < end) && (jx_validate_class[(uint8_t)*cursor] == JX_VALIDATE_SPACE))
+            {
+                cursor++;
+            }
+            continue;
+
+#if JX_ENABLE_JSON_COMMENTS
+        case JX_VALIDATE_SLASH:
+            cursor = jx_validate_skip_comment(cursor, end);
+            if (cursor == NULL)
+            {
+                return false;
+            }
+            continue;
+#endif
+
+        case JX_VALIDATE_OPEN:
+            /* Only one value may stand at the top level. */
+            if (closed || (depth >= JX_VALIDATE_MAX_DEPTH))
+            {
+                return false;
+            }
+            depth++;
+            cursor++;
+            break;
+
+        case JX_VALIDATE_CLOSE:
+            if (depth == 0U)
+            {
+                return false;
+            }
+            cursor++;
+            closed = (--depth == 0U);
+            break;
+
+        case JX_VALIDATE_QUOTE:
+            if (closed)
+            {
+                return false;
+            }
+            cursor = jx_validate_skip_string(cursor, end);
+            if (cursor == NULL)
+            {
+                return false;
+            }
+            closed = (depth == 0U);
+            break;
+
+        case JX_VALIDATE_PUNCT:
+            if (depth == 0U)
+            {
+                return false;
+            }
+            cursor++;
+            break;
+
+        case JX_VALIDATE_TOKEN:
+            /* Dropping the gap between two tokens would join them into one. */
+            if (closed || after_token)
+            {
+                return false;
+            }
+            token = true;
+            while ((cursor < end) && (jx_validate_class[(uint8_t)*cursor] == JX_VALIDATE_TOKEN))
+            {
+                cursor++;
+            }
+            closed = (depth == 0U);
+            break;
+
+        default:
+            return false;
+        }
+
+        after_token = token;
+
+        /* Output never outgrows input, so an in-place copy only moves bytes back. */
+        if (write != run)
+        {
+            memmove(write, run, (size_t)(cursor - run));
+        }
+        write += cursor - run;
+    }
+
+    *written = (size_t)(write - out);
+    return closed;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  Public API                                                            */
+/*                                                                        */
+/**************************************************************************/
+
+JX_STATUS jx_validate(const char *json, size_t length)
+{
+    const char *start;
+    const char *close;
+    const char *end;
+
+    if ((json == NULL) || (length == 0U))
+    {
+        return JX_ERROR;
+    }
+
+    if (!jx_validate_bounds(json, length, &start, &close))
+    {
+        return JX_ERROR;
+    }
+
+    if (jx_validate_class[(uint8_t)*start] == JX_VALIDATE_TOKEN)
+    {
+        return jx_validate_scalar(start, (size_t)(close - start)) ? JX_SUCCESS : JX_ERROR;
+    }
+
+    /* The reader stops at the container or string the scan closed, so it stays inside length. */
+    if ((!jx_backend_skip_value(json, &end)) || (end != close))
+    {
+        return JX_ERROR;
+    }
+
+    return JX_SUCCESS;
+}
+
+JX_STATUS jx_minify(const char *json, size_t length, char *out, size_t *written)
+{
+    const char *end;
+    size_t minified = 0U;
+
+    if ((json == NULL) || (length == 0U) || (out == NULL))
+    {
+        return JX_ERROR;
+    }
+
+    if (!jx_validate_minify(json, length, out, &minified))
+    {
+        return JX_ERROR;
+    }
+
+    /* Check the grammar on the terminated output, which has less to skip. */
+    out[minified] = '\0';
+    if ((!jx_backend_skip_value(out, &end)) || (end != &out[minified]))
+    {
+        return JX_ERROR;
+    }
+
+    if (written != NULL)
+    {
+        *written = minified;
+    }
+    return JX_SUCCESS;
+}
@@ -0,0 +1,175 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_BUFFER_SIZE     256U
+
+static uint32_t jsonx_test_voltage;
+static int32_t jsonx_test_temperature;
+static char jsonx_test_state[16];
+static uint32_t jsonx_test_cells[2];
+static uint32_t jsonx_test_sequence;
+
+static JX_ELEMENT jsonx_test_cell_items[] =
+{
+    JX_U32_VAL(jsonx_test_cells[0]),
+    JX_U32_VAL(jsonx_test_cells[1])
+};
+
+static JX_ELEMENT jsonx_test_battery[] =
+{
+    JX_PROPERTY_U32(JX_ALIAS("battery_voltage_mv", "bv"), jsonx_test_voltage),
+    JX_PROPERTY_I32(JX_ALIAS("battery_temperature_c", "bt"), jsonx_test_temperature),
+    JX_PROPERTY_ARRAY(JX_ALIAS("cell_voltages_mv", "cv"), jsonx_test_cell_items)
+};
+
+static JX_ELEMENT jsonx_test_root[] =
+{
+    JX_PROPERTY_OBJECT(JX_ALIAS("battery", "b"), jsonx_test_battery),
+    JX_PROPERTY_STRING_BUFFER(JX_ALIAS("charge_state", "cs"), jsonx_test_state),
+    JX_PROPERTY_U32("sequence", jsonx_test_sequence)
+};
+
+#define JSONX_TEST_ROOT_COUNT (sizeof(jsonx_test_root) / sizeof(jsonx_test_root[0]))
+
+static const char jsonx_test_full[] =
+    "{\"battery\":{\"battery_voltage_mv\":3712,\"battery_temperature_c\":-4,\"cell_voltages_mv\":[3700,3724]},"
+    "\"charge_state\":\"float\",\"sequence\":9}";
+
+static const char jsonx_test_short[] =
+    "{\"b\":{\"bv\":3712,\"bt\":-4,\"cv\":[3700,3724]},\"cs\":\"float\",\"sequence\":9}";
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX alias test failed: %s\n", message);
+    return 1;
+}
+
+static void test_clear(void)
+{
+    jsonx_test_voltage = 0U;
+    jsonx_test_temperature = 0;
+    jsonx_test_state[0] = '\0';
+    jsonx_test_cells[0] = 0U;
+    jsonx_test_cells[1] = 0U;
+    jsonx_test_sequence = 0U;
+}
+
+static bool test_values(void)
+{
+    return (jsonx_test_voltage == 3712U) && (jsonx_test_temperature == -4) &&
+           (strcmp(jsonx_test_state, "float") == 0) && (jsonx_test_cells[0] == 3700U) &&
+           (jsonx_test_cells[1] == 3724U) && (jsonx_test_sequence == 9U);
+}
+
+static int test_parse(JX_CONTEXT *context)
+{
+    static const char *const documents[] =
+    {
+        jsonx_test_full,
+        jsonx_test_short,
+        "{\"battery\":{\"bv\":3712,\"battery_temperature_c\":-4,\"cv\":[3700,3724]},\"cs\":\"float\",\"sequence\":9}"
+    };
+
+    for (size_t i = 0U; i < (sizeof(documents) / sizeof(documents[0])); ++i)
+    {
+        char input[JSONX_TEST_BUFFER_SIZE];
+
+        test_clear();
+        strcpy(input, documents[i]);
+        if ((jx_context_json_to_struct(context, input, jsonx_test_root, JSONX_TEST_ROOT_COUNT,
+                                       JX_MODE_STRICT) != JX_SUCCESS) || !test_values())
+        {
+            return test_fail(documents[i]);
+        }
+    }
+
+    /* Part of a name is neither the name nor its alias. */
+    if (jx_context_json_to_struct(context, "{\"battery\":{\"battery_voltage\":1}}", jsonx_test_root,
+                                  JSONX_TEST_ROOT_COUNT, JX_MODE_STRICT) != JX_ERROR)
+    {
+        return test_fail("partial name accepted");
+    }
+
+    return 0;
+}
+
+static int test_write(JX_CONTEXT *context)
+{
+    char output[JSONX_TEST_BUFFER_SIZE];
+
+    if ((jx_context_struct_to_json(context, jsonx_test_root, JSONX_TEST_ROOT_COUNT, output,
+                                   sizeof(output), JX_MINIFIED) != JX_SUCCESS) ||
+        (strcmp(output, jsonx_test_full) != 0))
+    {
+        return test_fail("full names");
+    }
+
+    if ((jx_context_struct_to_json(context, jsonx_test_root, JSONX_TEST_ROOT_COUNT, output, sizeof(output),
+                                   (JX_FORMAT)(JX_MINIFIED | JX_FORMAT_ALIASES)) != JX_SUCCESS) ||
+        (strcmp(output, jsonx_test_short) != 0))
+    {
+        return test_fail("aliases");
+    }
+
+    if ((jx_context_struct_to_json(context, jsonx_test_root, JSONX_TEST_ROOT_COUNT, output, sizeof(output),
+                                   (JX_FORMAT)(JX_FORMATTED_ASCII | JX_FORMAT_ALIASES)) != JX_SUCCESS) ||
+        (strstr(output, "\"bv\":") == NULL) || (strstr(output, "battery") != NULL))
+    {
+        return test_fail("formatted aliases");
+    }
+
+    if (jx_context_struct_to_json(context, jsonx_test_root, JSONX_TEST_ROOT_COUNT, output, sizeof(output),
+                                  (JX_FORMAT)(JX_FORMATTED_ASCII + 1)) != JX_ERROR)
+    {
+        return test_fail("unknown format accepted");
+    }
+
+    return 0;
+}
+
+/* A name copied over a longer one leaves its tail behind, which is not an alias. */
+static int test_stale_tail(JX_CONTEXT *context)
+{
+    char input[JSONX_TEST_BUFFER_SIZE];
+    char output[JSONX_TEST_BUFFER_SIZE];
+    JX_ELEMENT reused[] =
+    {
+        JX_PROPERTY_U32("", jsonx_test_sequence)
+    };
+
+    strcpy(reused[0].property, "sequence_number");
+    strcpy(reused[0].property, "seq");
+
+    strcpy(input, "{\"ence_number\":5}");
+    if (jx_context_json_to_struct(context, input, reused, 1U, JX_MODE_STRICT) != JX_ERROR)
+    {
+        return test_fail("stale tail matched as an alias");
+    }
+
+    strcpy(input, "{\"seq\":5}");
+    if ((jx_context_json_to_struct(context, input, reused, 1U, JX_MODE_STRICT) != JX_SUCCESS) ||
+        (jsonx_test_sequence != 5U) ||
+        (jx_context_struct_to_json(context, reused, 1U, output, sizeof(output),
+                                   (JX_FORMAT)(JX_MINIFIED | JX_FORMAT_ALIASES)) != JX_SUCCESS) ||
+        (strcmp(output, "{\"seq\":5}") != 0))
+    {
+        return test_fail("stale tail written as an alias");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+
+    if ((test_parse(&context) != 0) || (test_write(&context) != 0) || (test_stale_tail(&context) != 0))
+    {
+        return 1;
+    }
+
+    return 0;
+}
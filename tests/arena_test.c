@@ -0,0 +1,141 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_ARENA_SIZE      64U
+#define JSONX_TEST_POOL_SIZE      1024U
+#define JSONX_TEST_JSON_SIZE        64U
+
+static uint32_t jsonx_test_storage[JSONX_TEST_ARENA_SIZE / sizeof(uint32_t)];
+static uint32_t jsonx_test_pool[JSONX_TEST_POOL_SIZE / sizeof(uint32_t)];
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX arena test failed: %s\n", message);
+    return 1;
+}
+
+/* Sink that keeps each chunk in pool memory, as a caller might. */
+static bool test_keep_chunk(void *context, const char *data, size_t length)
+{
+    char **kept = (char **)context;
+
+    *kept = jx_arena_alloc(jx_get_arena(), length + 1U);
+    if (*kept == NULL)
+    {
+        return false;
+    }
+    memcpy(*kept, data, length);
+    (*kept)[length] = '\0';
+    return true;
+}
+
+/* Conversions leave the static pool alone, including blocks taken during the call. */
+static int test_pool(void)
+{
+    char json[JSONX_TEST_JSON_SIZE];
+    char chunk[JSONX_TEST_JSON_SIZE];
+    uint32_t value = 5U;
+    char *before;
+    char *during = NULL;
+    size_t used;
+
+    JX_ELEMENT root[] =
+    {
+        JX_PROPERTY_U32("value", value)
+    };
+
+    if (jx_init(jsonx_test_pool, sizeof(jsonx_test_pool)) != JX_SUCCESS)
+    {
+        return test_fail("jx_init");
+    }
+
+    before = jx_alloc_memory(8U);
+    used = jx_arena_used(jx_get_arena());
+    if ((before == NULL) ||
+        (jx_struct_to_json(root, 1U, json, sizeof(json), JX_MINIFIED) != JX_SUCCESS) ||
+        (jx_json_to_struct(json, root, 1U, JX_MODE_STRICT) != JX_SUCCESS) ||
+        (jx_arena_used(jx_get_arena()) != used))
+    {
+        jx_parser_deinit();
+        return test_fail("conversion touched the pool");
+    }
+
+    if ((jx_struct_to_json_chunked(root, 1U, chunk, sizeof(chunk), JX_MINIFIED,
+                                   test_keep_chunk, &during) != JX_SUCCESS) ||
+        (during == NULL) || (strcmp(during, json) != 0) ||
+        (jx_arena_alloc(jx_get_arena(), 4U) == (void *)during))
+    {
+        jx_parser_deinit();
+        return test_fail("sink allocation released");
+    }
+
+    jx_parser_deinit();
+    return 0;
+}
+
+int main(void)
+{
+    JX_ARENA arena;
+    JX_ARENA_MARK outer;
+    JX_ARENA_MARK inner;
+    uint8_t *first;
+    uint8_t *second;
+
+    if (jx_arena_init(&arena, jsonx_test_storage, sizeof(jsonx_test_storage)) != JX_SUCCESS)
+    {
+        return test_fail("jx_arena_init");
+    }
+
+    /* Allocations are 4-byte rounded and carved in order. */
+    first = jx_arena_alloc(&arena, 3U);
+    second = jx_arena_alloc(&arena, 8U);
+    if ((first == NULL) || (second != (first + 4)) || (jx_arena_used(&arena) != 12U))
+    {
+        return test_fail("bump order");
+    }
+
+    if ((jx_arena_alloc(&arena, JSONX_TEST_ARENA_SIZE) != NULL) ||
+        (jx_arena_alloc(&arena, SIZE_MAX) != NULL) ||
+        (jx_arena_alloc(&arena, 0U) != NULL))
+    {
+        return test_fail("oversized allocation accepted");
+    }
+
+    if (jx_arena_alloc(&arena, JSONX_TEST_ARENA_SIZE - 12U) == NULL)
+    {
+        return test_fail("exact fit rejected");
+    }
+
+    jx_arena_reset(&arena);
+    if ((jx_arena_used(&arena) != 0U) || (jx_arena_alloc(&arena, 1U) != first))
+    {
+        return test_fail("reset");
+    }
+
+    /* Nested scopes: inner release keeps outer data, stale marks are ignored. */
+    outer = jx_arena_mark(&arena);
+    second = jx_arena_alloc(&arena, 8U);
+    inner = jx_arena_mark(&arena);
+    if ((second == NULL) || (jx_arena_alloc(&arena, 16U) == NULL))
+    {
+        return test_fail("scoped allocation");
+    }
+
+    jx_arena_release(&arena, inner);
+    if ((jx_arena_used(&arena) != inner) || (jx_arena_alloc(&arena, 4U) != (second + 8)))
+    {
+        return test_fail("inner release");
+    }
+
+    jx_arena_release(&arena, outer);
+    jx_arena_release(&arena, inner);
+    if ((jx_arena_used(&arena) != outer) || (jx_arena_alloc(&arena, 4U) != second))
+    {
+        return test_fail("outer release");
+    }
+
+    return test_pool();
+}
@@ -0,0 +1,135 @@
+#include "jx_api.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_WORKERS            4U
+#define JSONX_TEST_DEVICES          600U
+#define JSONX_TEST_RANGE_SIZE        16U
+#define JSONX_TEST_BUFFER_SIZE       96U
+
+typedef struct
+{
+    uint32_t id;
+    int32_t  rssi;
+    char     state[12];
+} JsonX_TestDevice;
+
+static JsonX_TestDevice jsonx_test_devices[JSONX_TEST_DEVICES];
+static JX_ELEMENT jsonx_test_maps[JSONX_TEST_DEVICES][3];
+static char jsonx_test_output[JSONX_TEST_DEVICES][JSONX_TEST_BUFFER_SIZE];
+static JX_BATCH_JOB jsonx_test_jobs[JSONX_TEST_DEVICES];
+static JX_RANGE_JOB jsonx_test_job;
+static JX_STATUS jsonx_test_worker_status[JSONX_TEST_WORKERS];
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX batch test failed: %s\n", message);
+    return 1;
+}
+
+static void *jsonx_test_worker(void *argument)
+{
+    JX_STATUS *status = argument;
+
+    *status = jx_struct_to_json_batch_shared(&jsonx_test_job, jsonx_test_jobs);
+    return NULL;
+}
+
+static void jsonx_test_prepare(void)
+{
+    for (size_t i = 0U; i < JSONX_TEST_DEVICES; ++i)
+    {
+        memset(jsonx_test_output[i], 0, sizeof(jsonx_test_output[i]));
+        jsonx_test_jobs[i].status = JX_ERROR;
+    }
+}
+
+/* Every job must match a standalone serialization of its own mapping. */
+static int test_check_jobs(const char *step)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    char expected[JSONX_TEST_BUFFER_SIZE];
+
+    for (size_t i = 0U; i < JSONX_TEST_DEVICES; ++i)
+    {
+        if (i == 7U)
+        {
+            if (jsonx_test_jobs[i].status != JX_ERROR)
+            {
+                return test_fail("undersized job succeeded");
+            }
+            continue;
+        }
+
+        if ((jsonx_test_jobs[i].status != JX_SUCCESS) ||
+            (jx_context_struct_to_json(&context, jsonx_test_maps[i], 3U, expected, sizeof(expected),
+                                       JX_MINIFIED) != JX_SUCCESS) ||
+            (strcmp(expected, jsonx_test_output[i]) != 0))
+        {
+            return test_fail(step);
+        }
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    pthread_t workers[JSONX_TEST_WORKERS];
+
+    for (uint32_t i = 0U; i < JSONX_TEST_DEVICES; ++i)
+    {
+        jsonx_test_devices[i].id = 1000U + i;
+        jsonx_test_devices[i].rssi = -40 - (int32_t)(i % 50U);
+        snprintf(jsonx_test_devices[i].state, sizeof(jsonx_test_devices[i].state),
+                 (i % 3U) == 0U ? "idle" : "online");
+
+        jsonx_test_maps[i][0] = (JX_ELEMENT)JX_PROPERTY_U32("id", jsonx_test_devices[i].id);
+        jsonx_test_maps[i][1] = (JX_ELEMENT)JX_PROPERTY_I32("rssi", jsonx_test_devices[i].rssi);
+        jsonx_test_maps[i][2] = (JX_ELEMENT)JX_PROPERTY_STRING_BUFFER("state", jsonx_test_devices[i].state);
+
+        jsonx_test_jobs[i].element = jsonx_test_maps[i];
+        jsonx_test_jobs[i].element_size = 3U;
+        jsonx_test_jobs[i].buffer = jsonx_test_output[i];
+        jsonx_test_jobs[i].buffer_size = sizeof(jsonx_test_output[i]);
+        jsonx_test_jobs[i].format = JX_MINIFIED;
+    }
+
+    /* One job with a buffer too small fails alone. */
+    jsonx_test_jobs[7].buffer_size = 8U;
+
+    if (jx_struct_to_json_batch(NULL, 1U) != JX_ERROR)
+    {
+        return test_fail("invalid batch accepted");
+    }
+
+    jsonx_test_prepare();
+    if ((jx_struct_to_json_batch(jsonx_test_jobs, JSONX_TEST_DEVICES) != JX_ERROR) ||
+        (test_check_jobs("single-threaded batch") != 0))
+    {
+        return 1;
+    }
+
+    jsonx_test_prepare();
+    if (jx_range_job_init(&jsonx_test_job, JSONX_TEST_DEVICES, JSONX_TEST_RANGE_SIZE) != JX_SUCCESS)
+    {
+        return test_fail("jx_range_job_init");
+    }
+
+    for (size_t i = 0U; i < JSONX_TEST_WORKERS; ++i)
+    {
+        if (pthread_create(&workers[i], NULL, jsonx_test_worker, &jsonx_test_worker_status[i]) != 0)
+        {
+            return test_fail("pthread_create");
+        }
+    }
+    for (size_t i = 0U; i < JSONX_TEST_WORKERS; ++i)
+    {
+        pthread_join(workers[i], NULL);
+    }
+
+    return test_check_jobs("shared batch");
+}
@@ -0,0 +1,195 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_POOL_SIZE      2048U
+#define JSONX_TEST_BUFFER_SIZE     512U
+#define JSONX_TEST_BODY_SIZE      2048U
+
+static unsigned char jsonx_test_pool[JSONX_TEST_POOL_SIZE];
+static char jsonx_test_name[32];
+static uint32_t jsonx_test_position[2];
+static uint32_t jsonx_test_enabled;
+
+static JX_ELEMENT jsonx_test_position_items[] =
+{
+    JX_U32_VAL(jsonx_test_position[0]),
+    JX_U32_VAL(jsonx_test_position[1])
+};
+
+static JX_ELEMENT jsonx_test_root[] =
+{
+    JX_PROPERTY_STRING_BUFFER("name", jsonx_test_name),
+    JX_PROPERTY_ARRAY("position", jsonx_test_position_items),
+    JX_PROPERTY_U32("enabled", jsonx_test_enabled)
+};
+
+#define JSONX_TEST_ROOT_COUNT (sizeof(jsonx_test_root) / sizeof(jsonx_test_root[0]))
+
+static const char *const jsonx_test_documents[] =
+{
+    "{\"name\":\"Eve \\\"}\",\"position\":[56,78],\"enabled\":0}\r\n",
+    "{\"name\":\"Bob\",\"position\":[1,2],\"enabled\":1}"
+};
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX chunked test failed: %s\n", message);
+    jx_parser_deinit();
+    return 1;
+}
+
+/* Chunk @p payload the way a sender would, cycling through chunk sizes. */
+static size_t test_encode(char *body, size_t written, const char *payload, size_t chunk_size)
+{
+    size_t length = strlen(payload);
+    size_t pos = 0U;
+
+    while (pos < length)
+    {
+        size_t size = ((length - pos) < chunk_size) ? (length - pos) : chunk_size;
+
+        written += (size_t)snprintf(&body[written], JSONX_TEST_BODY_SIZE - written,
+                                    ((pos / chunk_size) % 2U) ? "%zX;part=%zu\r\n" : "%zx\r\n", size, pos);
+        memcpy(&body[written], &payload[pos], size);
+        written += size;
+        memcpy(&body[written], "\r\n", 2U);
+        written += 2U;
+        pos += size;
+        chunk_size = (chunk_size % 11U) + 1U;
+    }
+
+    written += (size_t)snprintf(&body[written], JSONX_TEST_BODY_SIZE - written, "0\r\nX-Trace: 7\r\n\r\n");
+    return written;
+}
+
+/* Two requests on one connection, received in slices of @p slice bytes. */
+static int test_loopback(size_t chunk_size, size_t slice)
+{
+    char body[JSONX_TEST_BODY_SIZE];
+    char stream_buffer[JSONX_TEST_BUFFER_SIZE];
+    JX_STREAM stream;
+    JX_CHUNKED chunked;
+    size_t length = test_encode(body, 0U, jsonx_test_documents[0], chunk_size);
+    size_t offset = 0U;
+    size_t documents = 0U;
+
+    length = test_encode(body, length, jsonx_test_documents[1], chunk_size + 3U);
+    if ((jx_stream_init(&stream, stream_buffer, sizeof(stream_buffer)) != JX_SUCCESS) ||
+        (jx_chunked_init(&chunked, &stream) != JX_SUCCESS))
+    {
+        return test_fail("init");
+    }
+
+    while (offset < length)
+    {
+        size_t available = ((length - offset) < slice) ? (length - offset) : slice;
+        size_t consumed;
+
+        if (jx_chunked_feed(&chunked, &body[offset], available, &consumed) != JX_SUCCESS)
+        {
+            return test_fail("jx_chunked_feed");
+        }
+        offset += consumed;
+
+        /* The body ends with its last chunk; what follows is the next request. */
+        if (jx_chunked_is_finished(&chunked))
+        {
+            if (!jx_stream_is_complete(&stream) ||
+                (jx_stream_parse(&stream, jsonx_test_root, JSONX_TEST_ROOT_COUNT, JX_MODE_STRICT) != JX_SUCCESS))
+            {
+                return test_fail("jx_stream_parse");
+            }
+
+            documents++;
+            if ((documents == 1U) &&
+                ((strcmp(jsonx_test_name, "Eve \"}") != 0) || (jsonx_test_position[1] != 78U) ||
+                 (jsonx_test_enabled != 0U)))
+            {
+                return test_fail("first document mismatch");
+            }
+            jx_chunked_reset(&chunked);
+        }
+    }
+
+    if ((documents != 2U) || (strcmp(jsonx_test_name, "Bob") != 0) || (jsonx_test_position[0] != 1U))
+    {
+        return test_fail("second document mismatch");
+    }
+
+    return 0;
+}
+
+static JX_STATUS test_feed(const char *body, size_t length)
+{
+    char stream_buffer[8];
+    JX_STREAM stream;
+    JX_CHUNKED chunked;
+    size_t consumed;
+
+    (void)jx_stream_init(&stream, stream_buffer, sizeof(stream_buffer));
+    (void)jx_chunked_init(&chunked, &stream);
+    return jx_chunked_feed(&chunked, body, length, &consumed);
+}
+
+static int test_framing(void)
+{
+    static const char *const broken[] =
+    {
+        "x\r\n{}\r\n0\r\n\r\n",             /* No size */
+        "2\n{}\r\n0\r\n\r\n",               /* Bare LF after the size */
+        "2\r\n{}X\r\n0\r\n\r\n",            /* Data longer than its size */
+        "1\r\n{\r\n1\r\n}\r\n0\r\nx\n",     /* Bare LF in a trailer */
+        "10000000000000000\r\n{}",          /* Size overflows */
+        "4\r\n[1,2\r\n4\r\n,3,4\r\n"        /* Payload larger than the stream buffer */
+    };
+
+    for (size_t i = 0U; i < (sizeof(broken) / sizeof(broken[0])); ++i)
+    {
+        if (test_feed(broken[i], strlen(broken[i])) != JX_ERROR)
+        {
+            return test_fail(broken[i]);
+        }
+    }
+
+    if ((test_feed("2\r\n{\0\r\n0\r\n\r\n", 12U) != JX_ERROR) ||
+        (test_feed("2 ; a=\"b\"\r\n{}\r\n0\r\n\r\n", 20U) != JX_SUCCESS) ||
+        (jx_chunked_init(NULL, NULL) != JX_ERROR) ||
+        (jx_chunked_feed(NULL, "0\r\n\r\n", 5U, NULL) != JX_ERROR))
+    {
+        return test_fail("framing");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    static const size_t slices[] = { 1U, 2U, 5U, 13U, JSONX_TEST_BODY_SIZE };
+
+    if (jx_init(jsonx_test_pool, sizeof(jsonx_test_pool)) != JX_SUCCESS)
+    {
+        return test_fail("jx_init");
+    }
+
+    for (size_t chunk_size = 1U; chunk_size <= 64U; chunk_size += 9U)
+    {
+        for (size_t i = 0U; i < (sizeof(slices) / sizeof(slices[0])); ++i)
+        {
+            if (test_loopback(chunk_size, slices[i]) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+
+    if (test_framing() != 0)
+    {
+        return 1;
+    }
+
+    jx_parser_deinit();
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include "jx_api.h"
+#include "jx_bench_corpus.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define JSONX_TEST_BUFFER_SIZE     512U
+
+static unsigned long jsonx_test_malloc_calls;
+static unsigned long jsonx_test_free_calls;
+
+static JX_CONTEXT jsonx_test_context = JX_CONTEXT_INIT;
+
+static void *jsonx_test_malloc(size_t size)
+{
+    jsonx_test_malloc_calls++;
+    return malloc(size);
+}
+
+static void jsonx_test_free(void *ptr)
+{
+    jsonx_test_free_calls++;
+    free(ptr);
+}
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX context test failed: %s\n", message);
+    return 1;
+}
+
+/* Parse, write and re-parse every corpus document through the context API. */
+static int test_corpus_with_context(void)
+{
+    for (size_t i = 0U; i < JX_BENCH_CORPUS_COUNT; ++i)
+    {
+        JX_BENCH_DEVICE device;
+        JX_BENCH_DEVICE copy;
+        JX_BENCH_MAPPING mapping;
+        char input[JSONX_TEST_BUFFER_SIZE];
+        char output[JSONX_TEST_BUFFER_SIZE];
+
+        memset(&device, 0, sizeof(device));
+        memset(&copy, 0, sizeof(copy));
+        strcpy(input, jx_bench_corpus[i]);
+
+        jx_bench_bind(&mapping, &device);
+        if (jx_context_json_to_struct(&jsonx_test_context, input, mapping.root,
+                                      JX_BENCH_ROOT_COUNT, JX_MODE_RELAXED) != JX_SUCCESS)
+        {
+            return test_fail("corpus parse");
+        }
+
+        if (jx_context_struct_to_json(&jsonx_test_context, mapping.root, JX_BENCH_ROOT_COUNT,
+                                      output, sizeof(output), JX_FORMATTED) != JX_SUCCESS)
+        {
+            return test_fail("corpus write");
+        }
+
+        jx_bench_bind(&mapping, &copy);
+        if ((jx_context_json_to_struct(&jsonx_test_context, output, mapping.root,
+                                       JX_BENCH_ROOT_COUNT, JX_MODE_STRICT) != JX_SUCCESS) ||
+            (memcmp(&device, &copy, sizeof(device)) != 0))
+        {
+            return test_fail("corpus round trip");
+        }
+
+        /* Trusted mode must read JsonX output exactly like the validating modes. */
+        jx_bench_bind(&mapping, &copy);
+        memset(&copy, 0, sizeof(copy));
+        if ((jx_context_json_to_struct(&jsonx_test_context, input, mapping.root,
+                                       JX_BENCH_ROOT_COUNT, JX_MODE_TRUSTED) != JX_SUCCESS) ||
+            (memcmp(&device, &copy, sizeof(device)) != 0))
+        {
+            return test_fail("corpus trusted parse");
+        }
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    JX_HOOKS hooks = { .malloc_fn = jsonx_test_malloc, .free_fn = jsonx_test_free };
+    JX_BENCH_DEVICE device;
+    JX_BENCH_MAPPING mapping;
+    char broken[] = "{\"id\":1,\"name\":}";
+    char truncated[] = "{\"id\":1,\"online\":tr";
+    char oversized[] = "{\"name\":\"0123456789abcdef0123456789\"}";
+
+    /* The context API works without jx_init(). */
+    if (test_corpus_with_context() != 0)
+    {
+        return 1;
+    }
+
+    jx_bench_bind(&mapping, &device);
+    if ((jx_context_json_to_struct(&jsonx_test_context, broken, mapping.root,
+                                   JX_BENCH_ROOT_COUNT, JX_MODE_RELAXED) != JX_ERROR) ||
+        (jx_context_get_last_error_offset(&jsonx_test_context, broken) != 15U) ||
+        (jx_get_last_error_offset(broken) != (size_t)-1))
+    {
+        return test_fail("context error offset");
+    }
+
+    /* Trusted mode still stops at the terminator and at mapped capacity. */
+    if ((jx_context_json_to_struct(&jsonx_test_context, truncated, mapping.root,
+                                   JX_BENCH_ROOT_COUNT, JX_MODE_TRUSTED) != JX_ERROR) ||
+        (jx_context_get_last_error_offset(&jsonx_test_context, truncated) > (sizeof(truncated) - 1U)) ||
+        (jx_context_json_to_struct(&jsonx_test_context, oversized, mapping.root,
+                                   JX_BENCH_ROOT_COUNT, JX_MODE_TRUSTED) != JX_ERROR))
+    {
+        return test_fail("trusted mode bounds");
+    }
+
+    /* With counting hooks installed, conversions must not reach them. */
+    if (jx_init(&hooks) != JX_SUCCESS)
+    {
+        return test_fail("jx_init");
+    }
+
+    jsonx_test_malloc_calls = 0UL;
+    jsonx_test_free_calls = 0UL;
+
+    if (test_corpus_with_context() != 0)
+    {
+        jx_parser_deinit();
+        return 1;
+    }
+
+    for (size_t i = 0U; i < JX_BENCH_CORPUS_COUNT; ++i)
+    {
+        char input[JSONX_TEST_BUFFER_SIZE];
+        char output[JSONX_TEST_BUFFER_SIZE];
+
+        strcpy(input, jx_bench_corpus[i]);
+        jx_bench_bind(&mapping, &device);
+        if ((jx_json_to_struct(input, mapping.root, JX_BENCH_ROOT_COUNT, JX_MODE_RELAXED) != JX_SUCCESS) ||
+            (jx_struct_to_json(mapping.root, JX_BENCH_ROOT_COUNT, output, sizeof(output), JX_MINIFIED) != JX_SUCCESS))
+        {
+            jx_parser_deinit();
+            return test_fail("global corpus conversion");
+        }
+    }
+
+    if ((jsonx_test_malloc_calls != 0UL) || (jsonx_test_free_calls != 0UL))
+    {
+        jx_parser_deinit();
+        return test_fail("allocator hook invoked");
+    }
+
+    jx_parser_deinit();
+    return 0;
+}
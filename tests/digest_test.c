@@ -0,0 +1,243 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_BUFFER_SIZE     256U
+#define JSONX_TEST_CHUNK_SIZE        7U
+
+typedef struct
+{
+    char data[JSONX_TEST_BUFFER_SIZE];
+    size_t length;
+} JsonX_TestSink;
+
+static char jsonx_test_name[32] = "pump \"A\"";
+static uint32_t jsonx_test_position[2] = { 56U, 78U };
+static uint32_t jsonx_test_enabled = 1U;
+
+static JX_ELEMENT jsonx_test_position_items[] =
+{
+    JX_U32_VAL(jsonx_test_position[0]),
+    JX_U32_VAL(jsonx_test_position[1])
+};
+
+static JX_ELEMENT jsonx_test_root[] =
+{
+    JX_PROPERTY_STRING_BUFFER("name", jsonx_test_name),
+    JX_PROPERTY_ARRAY("position", jsonx_test_position_items),
+    JX_PROPERTY_U32("enabled", jsonx_test_enabled)
+};
+
+#define JSONX_TEST_ROOT_COUNT (sizeof(jsonx_test_root) / sizeof(jsonx_test_root[0]))
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX digest test failed: %s\n", message);
+    return 1;
+}
+
+static bool test_sink(void *context, const char *data, size_t length)
+{
+    JsonX_TestSink *sink = (JsonX_TestSink *)context;
+
+    if ((sink->length + length) >= sizeof(sink->data))
+    {
+        return false;
+    }
+
+    memcpy(&sink->data[sink->length], data, length);
+    sink->length += length;
+    sink->data[sink->length] = '\0';
+    return true;
+}
+
+static void test_hex(const uint8_t *bytes, size_t length, char *text)
+{
+    static const char digits[] = "0123456789abcdef";
+
+    for (size_t i = 0U; i < length; ++i)
+    {
+        text[i * 2U] = digits[bytes[i] >> 4];
+        text[(i * 2U) + 1U] = digits[bytes[i] & 0x0FU];
+    }
+    text[length * 2U] = '\0';
+}
+
+/* Digests data in uneven slices so block boundaries fall everywhere. */
+static bool test_digest(JX_DIGEST_KIND kind, const uint8_t *key, size_t key_length,
+                        const char *data, size_t length, const char *expected)
+{
+    JX_DIGEST digest;
+    uint8_t out[32];
+    char text[65];
+    size_t offset = 0U;
+    size_t slice = 1U;
+    size_t written;
+
+    if (jx_digest_init(&digest, kind, key, key_length, NULL, NULL) != JX_SUCCESS)
+    {
+        return false;
+    }
+
+    while (offset < length)
+    {
+        size_t take = ((length - offset) < slice) ? (length - offset) : slice;
+
+        jx_digest_update(&digest, &data[offset], take);
+        offset += take;
+        slice = (slice * 3U) % 67U;
+    }
+
+    written = jx_digest_final(&digest, out, sizeof(out));
+    test_hex(out, written, text);
+    return strcmp(text, expected) == 0;
+}
+
+static int test_vectors(void)
+{
+    static const char two_block[] = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    static const char large_key_data[] = "Test Using Larger Than Block-Size Key - Hash Key First";
+    char block[64];
+    uint8_t short_key[20];
+    uint8_t large_key[131];
+    JX_DIGEST digest;
+    uint8_t out[32];
+
+    memset(block, 'a', sizeof(block));
+    memset(short_key, 0x0B, sizeof(short_key));
+    memset(large_key, 0xAA, sizeof(large_key));
+
+    if ((jx_crc32c(0U, "123456789", 9U) != 0xE3069283U) ||
+        (jx_crc32c(jx_crc32c(0U, "1234", 4U), "56789", 5U) != 0xE3069283U) ||
+        !test_digest(JX_DIGEST_CRC32C, NULL, 0U, "123456789", 9U, "e3069283"))
+    {
+        return test_fail("crc32c");
+    }
+
+    if (!test_digest(JX_DIGEST_SHA256, NULL, 0U, "", 0U,
+                     "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855") ||
+        !test_digest(JX_DIGEST_SHA256, NULL, 0U, "abc", 3U,
+                     "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad") ||
+        !test_digest(JX_DIGEST_SHA256, NULL, 0U, two_block, sizeof(two_block) - 1U,
+                     "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1") ||
+        !test_digest(JX_DIGEST_SHA256, NULL, 0U, block, sizeof(block),
+                     "ffe054fe7ae0cb6dc65c3af9b61d5209f439851db43d0ba5997337df154668eb"))
+    {
+        return test_fail("sha256");
+    }
+
+    /* RFC 4231 test cases 1, 2 and 6. */
+    if (!test_digest(JX_DIGEST_HMAC_SHA256, short_key, sizeof(short_key), "Hi There", 8U,
+                     "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7") ||
+        !test_digest(JX_DIGEST_HMAC_SHA256, (const uint8_t *)"Jefe", 4U, "what do ya want for nothing?", 28U,
+                     "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843") ||
+        !test_digest(JX_DIGEST_HMAC_SHA256, large_key, sizeof(large_key), large_key_data,
+                     sizeof(large_key_data) - 1U,
+                     "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54"))
+    {
+        return test_fail("hmac-sha256");
+    }
+
+    if ((jx_digest_init(NULL, JX_DIGEST_CRC32C, NULL, 0U, NULL, NULL) != JX_ERROR) ||
+        (jx_digest_init(&digest, JX_DIGEST_HMAC_SHA256, NULL, 4U, NULL, NULL) != JX_ERROR) ||
+        (jx_digest_init(&digest, JX_DIGEST_SHA256, NULL, 0U, NULL, NULL) != JX_SUCCESS) ||
+        (jx_digest_final(&digest, out, 31U) != 0U))
+    {
+        return test_fail("invalid arguments accepted");
+    }
+
+    return 0;
+}
+
+/* The sink stage digests exactly the bytes the next sink receives. */
+static int test_serialize(void)
+{
+    static const JX_DIGEST_KIND kinds[] = { JX_DIGEST_CRC32C, JX_DIGEST_SHA256, JX_DIGEST_HMAC_SHA256 };
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    char buffer[JSONX_TEST_BUFFER_SIZE];
+    char chunk[JSONX_TEST_CHUNK_SIZE];
+
+    if (jx_context_struct_to_json(&context, jsonx_test_root, JSONX_TEST_ROOT_COUNT,
+                                  buffer, sizeof(buffer), JX_MINIFIED) != JX_SUCCESS)
+    {
+        return test_fail("jx_context_struct_to_json");
+    }
+
+    for (size_t i = 0U; i < (sizeof(kinds) / sizeof(kinds[0])); ++i)
+    {
+        JsonX_TestSink sink = { { 0 }, 0U };
+        JX_DIGEST fused;
+        JX_DIGEST separate;
+        uint8_t fused_out[32];
+        uint8_t separate_out[32];
+        size_t length;
+
+        (void)jx_digest_init(&fused, kinds[i], (const uint8_t *)"key", 3U, test_sink, &sink);
+        (void)jx_digest_init(&separate, kinds[i], (const uint8_t *)"key", 3U, NULL, NULL);
+        jx_digest_update(&separate, buffer, strlen(buffer));
+
+        if ((jx_context_struct_to_json_chunked(&context, jsonx_test_root, JSONX_TEST_ROOT_COUNT, chunk,
+                                               sizeof(chunk), JX_MINIFIED, jx_digest_sink, &fused) != JX_SUCCESS) ||
+            (strcmp(sink.data, buffer) != 0))
+        {
+            return test_fail("chunked output through the digest stage");
+        }
+
+        length = jx_digest_final(&fused, fused_out, sizeof(fused_out));
+        if ((length == 0U) || (length != jx_digest_final(&separate, separate_out, sizeof(separate_out))) ||
+            (memcmp(fused_out, separate_out, length) != 0))
+        {
+            return test_fail("output digest differs");
+        }
+    }
+
+    return 0;
+}
+
+static int test_stream(void)
+{
+    static const char pipelined[] =
+        "{\"enabled\":0}"
+        "{\"enabled\":1}";
+    char stream_buffer[JSONX_TEST_BUFFER_SIZE];
+    JX_STREAM stream;
+    JX_DIGEST digest;
+    uint8_t out[4];
+    size_t consumed = 0U;
+
+    (void)jx_digest_init(&digest, JX_DIGEST_CRC32C, NULL, 0U, NULL, NULL);
+    if (jx_stream_init(&stream, stream_buffer, sizeof(stream_buffer)) != JX_SUCCESS)
+    {
+        return test_fail("jx_stream_init");
+    }
+    jx_stream_set_digest(&stream, &digest);
+
+    /* Only consumed bytes are digested; the rest belongs to the next document. */
+    if ((jx_stream_feed(&stream, pipelined, 5U, &consumed) != JX_SUCCESS) ||
+        (jx_stream_feed(&stream, &pipelined[5], sizeof(pipelined) - 6U, &consumed) != JX_SUCCESS) ||
+        !jx_stream_is_complete(&stream) || (consumed != 8U))
+    {
+        return test_fail("stream feed");
+    }
+
+    if ((jx_digest_final(&digest, out, sizeof(out)) != 4U) ||
+        ((((uint32_t)out[0] << 24) | ((uint32_t)out[1] << 16) | ((uint32_t)out[2] << 8) | out[3]) !=
+         jx_crc32c(0U, pipelined, 13U)))
+    {
+        return test_fail("input digest differs");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    if ((test_vectors() != 0) || (test_serialize() != 0) || (test_stream() != 0))
+    {
+        return 1;
+    }
+
+    return 0;
+}
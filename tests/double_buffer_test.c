@@ -0,0 +1,207 @@
+#include "jx_api.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_READERS         3U
+#define JSONX_TEST_UPDATES         20000U
+
+typedef struct
+{
+    uint32_t sequence;
+    uint32_t check;
+    char     label[16];
+} JsonX_TestConfig;
+
+typedef struct
+{
+    uint32_t id;
+} JsonX_TestRecord;
+
+typedef struct
+{
+    uint32_t         values[4];
+    JsonX_TestRecord records[2];
+} JsonX_TestLists;
+
+static JsonX_TestConfig jsonx_test_primary;
+static JsonX_TestConfig jsonx_test_secondary;
+static JX_DOUBLE_BUFFER jsonx_test_buffer;
+static volatile int jsonx_test_done;
+static volatile int jsonx_test_torn;
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX double buffer test failed: %s\n", message);
+    return 1;
+}
+
+static void *jsonx_test_reader(void *argument)
+{
+    (void)argument;
+
+    while (!jsonx_test_done)
+    {
+        const JsonX_TestConfig *config = jx_double_buffer_acquire(&jsonx_test_buffer);
+        char expected[16];
+
+        snprintf(expected, sizeof(expected), "v%lu", (unsigned long)config->sequence);
+        if ((config->check != (config->sequence ^ 0xA5A5A5A5U)) ||
+            (strcmp(config->label, expected) != 0))
+        {
+            jsonx_test_torn = 1;
+        }
+        jx_double_buffer_release(&jsonx_test_buffer, config);
+        sched_yield();
+    }
+
+    return NULL;
+}
+
+/* Array lengths would not follow the published copy, so such mappings are refused. */
+static int test_rejected_mappings(void)
+{
+    static JsonX_TestLists primary;
+    static JsonX_TestLists secondary;
+    static JX_DOUBLE_BUFFER buffer;
+    JX_RECORDS records = JX_RECORDS_INIT(primary.records, 0U);
+
+    JX_ELEMENT values[] =
+    {
+        JX_U32_VAL(primary.values[0]),
+        JX_U32_VAL(primary.values[1]),
+        JX_U32_VAL(primary.values[2]),
+        JX_U32_VAL(primary.values[3])
+    };
+    JX_ELEMENT nested[] =
+    {
+        JX_PROPERTY_ARRAY("values", values)
+    };
+    JX_ELEMENT with_array[] =
+    {
+        JX_PROPERTY_OBJECT("nested", nested)
+    };
+    JX_ELEMENT record[] =
+    {
+        JX_PROPERTY_U32("id", primary.records[0].id)
+    };
+    JX_ELEMENT with_records[] =
+    {
+        JX_PROPERTY_RECORD_ARRAY("records", records, record)
+    };
+
+    if (jx_double_buffer_init(&buffer, &primary, &secondary, sizeof(JsonX_TestLists),
+                              with_array, sizeof(with_array) / sizeof(with_array[0])) != JX_ERROR)
+    {
+        return test_fail("nested array accepted");
+    }
+
+    if (jx_double_buffer_init(&buffer, &primary, &secondary, sizeof(JsonX_TestLists),
+                              with_records, sizeof(with_records) / sizeof(with_records[0])) != JX_ERROR)
+    {
+        return test_fail("record array accepted");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    JX_ELEMENT root[] =
+    {
+        JX_PROPERTY_U32("sequence", jsonx_test_primary.sequence),
+        JX_PROPERTY_U32("check", jsonx_test_primary.check),
+        JX_PROPERTY_STRING_BUFFER("label", jsonx_test_primary.label)
+    };
+    pthread_t readers[JSONX_TEST_READERS];
+    const JsonX_TestConfig *config;
+    char json[96];
+    char broken[] = "{\"sequence\":7,\"check\":";
+    uint32_t published = 0U;
+
+    if (test_rejected_mappings() != 0)
+    {
+        return 1;
+    }
+
+    jsonx_test_primary.check = 0xA5A5A5A5U;
+    strcpy(jsonx_test_primary.label, "v0");
+    if (jx_double_buffer_init(&jsonx_test_buffer, &jsonx_test_primary, &jsonx_test_secondary,
+                              sizeof(JsonX_TestConfig), root, sizeof(root) / sizeof(root[0])) != JX_SUCCESS)
+    {
+        return test_fail("jx_double_buffer_init");
+    }
+
+    /* A failed parse publishes nothing. */
+    if (jx_double_buffer_parse(&jsonx_test_buffer, broken, JX_MODE_STRICT) != JX_ERROR)
+    {
+        return test_fail("broken document accepted");
+    }
+    config = jx_double_buffer_acquire(&jsonx_test_buffer);
+    if ((config != &jsonx_test_primary) || (config->sequence != 0U))
+    {
+        return test_fail("failed parse published");
+    }
+
+    /* The inactive copy is pinned by the reader above, so the writer backs off. */
+    snprintf(json, sizeof(json), "{\"sequence\":1,\"check\":%lu,\"label\":\"v1\"}",
+             (unsigned long)(1U ^ 0xA5A5A5A5U));
+    if ((jx_double_buffer_parse(&jsonx_test_buffer, json, JX_MODE_STRICT) != JX_SUCCESS) ||
+        (jx_double_buffer_parse(&jsonx_test_buffer, json, JX_MODE_STRICT) != JX_ERROR) ||
+        (config->sequence != 0U))
+    {
+        return test_fail("pinned copy overwritten");
+    }
+    jx_double_buffer_release(&jsonx_test_buffer, config);
+
+    /* Partial documents keep the other published fields. */
+    snprintf(json, sizeof(json), "{\"label\":\"v1\"}");
+    config = jx_double_buffer_acquire(&jsonx_test_buffer);
+    jx_double_buffer_release(&jsonx_test_buffer, config);
+    if ((jx_double_buffer_parse(&jsonx_test_buffer, json, JX_MODE_RELAXED) != JX_SUCCESS) ||
+        ((config = jx_double_buffer_acquire(&jsonx_test_buffer)) == NULL) ||
+        (config->sequence != 1U))
+    {
+        return test_fail("partial update");
+    }
+    jx_double_buffer_release(&jsonx_test_buffer, config);
+
+    for (size_t i = 0U; i < JSONX_TEST_READERS; ++i)
+    {
+        if (pthread_create(&readers[i], NULL, jsonx_test_reader, NULL) != 0)
+        {
+            return test_fail("pthread_create");
+        }
+    }
+
+    for (uint32_t sequence = 2U; published < JSONX_TEST_UPDATES; ++sequence)
+    {
+        snprintf(json, sizeof(json), "{\"sequence\":%lu,\"check\":%lu,\"label\":\"v%lu\"}",
+                 (unsigned long)sequence,
+                 (unsigned long)(sequence ^ 0xA5A5A5A5U),
+                 (unsigned long)sequence);
+        if (jx_double_buffer_parse(&jsonx_test_buffer, json, JX_MODE_STRICT) == JX_SUCCESS)
+        {
+            published++;
+        }
+
+        /* Let readers run; a failed parse means one still holds the old copy. */
+        sched_yield();
+    }
+
+    jsonx_test_done = 1;
+    for (size_t i = 0U; i < JSONX_TEST_READERS; ++i)
+    {
+        pthread_join(readers[i], NULL);
+    }
+
+    if (jsonx_test_torn)
+    {
+        return test_fail("reader observed a torn copy");
+    }
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_BUFFER_SIZE     256U
+
+static uint32_t jsonx_test_network_id;
+static char jsonx_test_ssid[16];
+static int32_t jsonx_test_rssi;
+static uint32_t jsonx_test_log_id;
+static char jsonx_test_level[8];
+static uint32_t jsonx_test_rotate;
+static uint32_t jsonx_test_limits[2];
+
+static JX_ELEMENT jsonx_test_wifi[] =
+{
+    JX_PROPERTY_STRING_BUFFER("ssid", jsonx_test_ssid),
+    JX_PROPERTY_I32("rssi", jsonx_test_rssi)
+};
+
+static JX_ELEMENT jsonx_test_log[] =
+{
+    JX_PROPERTY_STRING_BUFFER("level", jsonx_test_level),
+    JX_PROPERTY_U32("rotate", jsonx_test_rotate)
+};
+
+static JX_ELEMENT jsonx_test_limit_items[] =
+{
+    JX_U32_VAL(jsonx_test_limits[0]),
+    JX_U32_VAL(jsonx_test_limits[1])
+};
+
+static JX_ELEMENT jsonx_test_motor[] =
+{
+    JX_PROPERTY_ARRAY("limits", jsonx_test_limit_items)
+};
+
+/* Three subsystems; "id" is shared by the first two. */
+static JX_ELEMENT jsonx_test_network_root[] =
+{
+    JX_PROPERTY_U32("id", jsonx_test_network_id),
+    JX_PROPERTY_OBJECT("wifi", jsonx_test_wifi)
+};
+
+static JX_ELEMENT jsonx_test_log_root[] =
+{
+    JX_PROPERTY_U32("id", jsonx_test_log_id),
+    JX_PROPERTY_OBJECT("log", jsonx_test_log)
+};
+
+static JX_ELEMENT jsonx_test_motor_root[] =
+{
+    JX_PROPERTY_OBJECT("motor", jsonx_test_motor)
+};
+
+static const char jsonx_test_document[] =
+    "{\"id\":5,\"wifi\":{\"ssid\":\"plant\",\"rssi\":-60},\"extra\":[1,{\"log\":2}],"
+    "\"log\":{\"level\":\"warn\",\"rotate\":3},\"motor\":{\"limits\":[100,200]}}";
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX fanout test failed: %s\n", message);
+    return 1;
+}
+
+static void test_targets(JX_FANOUT_TARGET *targets)
+{
+    targets[0] = (JX_FANOUT_TARGET){ jsonx_test_network_root, 2U, JX_ERROR };
+    targets[1] = (JX_FANOUT_TARGET){ jsonx_test_log_root, 2U, JX_ERROR };
+    targets[2] = (JX_FANOUT_TARGET){ jsonx_test_motor_root, 1U, JX_ERROR };
+}
+
+static JX_STATUS test_parse(JX_CONTEXT *context, const char *json, JX_FANOUT_TARGET *targets, JX_PARSE_MODE mode)
+{
+    char input[JSONX_TEST_BUFFER_SIZE];
+
+    strcpy(input, json);
+    test_targets(targets);
+    return jx_context_json_to_struct_fanout(context, input, targets, 3U, mode);
+}
+
+static int test_values(JX_CONTEXT *context)
+{
+    JX_FANOUT_TARGET targets[3];
+
+    if ((test_parse(context, jsonx_test_document, targets, JX_MODE_STRICT) != JX_SUCCESS) ||
+        (targets[0].status != JX_SUCCESS) || (targets[1].status != JX_SUCCESS) ||
+        (targets[2].status != JX_SUCCESS) || (context->error_ptr != NULL))
+    {
+        return test_fail("strict fan-out");
+    }
+
+    if ((jsonx_test_network_id != 5U) || (jsonx_test_log_id != 5U) || (strcmp(jsonx_test_ssid, "plant") != 0) ||
+        (jsonx_test_rssi != -60) || (strcmp(jsonx_test_level, "warn") != 0) || (jsonx_test_rotate != 3U) ||
+        (jsonx_test_limits[0] != 100U) || (jsonx_test_limits[1] != 200U))
+    {
+        return test_fail("values");
+    }
+
+    return 0;
+}
+
+static int test_isolation(JX_CONTEXT *context)
+{
+    static const char too_long[] =
+        "{\"id\":6,\"wifi\":{\"ssid\":\"plant\",\"rssi\":-61},"
+        "\"log\":{\"level\":\"info\",\"rotate\":4},\"motor\":{\"limits\":[1,2,3]}}";
+    JX_FANOUT_TARGET targets[3];
+
+    /* A value one mapping cannot hold fails that mapping only. */
+    if ((test_parse(context, too_long, targets, JX_MODE_RELAXED) != JX_ERROR) ||
+        (targets[0].status != JX_SUCCESS) || (targets[1].status != JX_SUCCESS) ||
+        (targets[2].status != JX_ERROR) || (jsonx_test_log_id != 6U) || (jsonx_test_rotate != 4U) ||
+        (context->error_ptr == NULL) || (strncmp(context->error_ptr, "{\"limits\"", 9U) != 0))
+    {
+        return test_fail("one mapping failing");
+    }
+
+    /* Strict mode fails the mapping whose member is missing. */
+    if ((test_parse(context, "{\"id\":7,\"wifi\":{\"ssid\":\"a\",\"rssi\":1},\"motor\":{\"limits\":[]}}",
+                    targets, JX_MODE_STRICT) != JX_ERROR) ||
+        (targets[0].status != JX_SUCCESS) || (targets[1].status != JX_ERROR) ||
+        (targets[2].status != JX_SUCCESS) || (jsonx_test_network_id != 7U))
+    {
+        return test_fail("missing member");
+    }
+
+    /* A broken document fails every mapping, wherever the error is. */
+    if ((test_parse(context, "{\"id\":8,\"extra\":[1,,2]}", targets, JX_MODE_RELAXED) != JX_ERROR) ||
+        (targets[0].status != JX_ERROR) || (targets[1].status != JX_ERROR) || (targets[2].status != JX_ERROR) ||
+        (test_parse(context, "{\"id\":8} x", targets, JX_MODE_RELAXED) != JX_ERROR) ||
+        (targets[0].status != JX_ERROR) ||
+        (test_parse(context, "{\"motor\":{\"limits\":[1,2,]}}", targets, JX_MODE_RELAXED) != JX_ERROR) ||
+        (targets[1].status != JX_ERROR))
+    {
+        return test_fail("broken document accepted");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_FANOUT_TARGET targets[3];
+    char input[JSONX_TEST_BUFFER_SIZE];
+
+    if ((test_values(&context) != 0) || (test_isolation(&context) != 0))
+    {
+        return 1;
+    }
+
+    strcpy(input, jsonx_test_document);
+    test_targets(targets);
+    targets[1].element = NULL;
+    if ((jx_context_json_to_struct_fanout(&context, input, targets, 3U, JX_MODE_RELAXED) != JX_ERROR) ||
+        (jx_context_json_to_struct_fanout(&context, input, targets, 0U, JX_MODE_RELAXED) != JX_ERROR) ||
+        (jx_context_json_to_struct_fanout(NULL, input, targets, 1U, JX_MODE_RELAXED) != JX_ERROR))
+    {
+        return test_fail("invalid arguments accepted");
+    }
+
+    return 0;
+}
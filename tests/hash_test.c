@@ -0,0 +1,184 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_BUFFER_SIZE     256U
+
+static uint32_t jsonx_test_id;
+static int32_t jsonx_test_level;
+static char jsonx_test_mode[16];
+static uint32_t jsonx_test_limits[4];
+
+static JX_ELEMENT jsonx_test_limit_items[] =
+{
+    JX_U32_VAL(jsonx_test_limits[0]),
+    JX_U32_VAL(jsonx_test_limits[1]),
+    JX_U32_VAL(jsonx_test_limits[2]),
+    JX_U32_VAL(jsonx_test_limits[3])
+};
+
+static JX_ELEMENT jsonx_test_root[] =
+{
+    JX_PROPERTY_U32("id", jsonx_test_id),
+    JX_PROPERTY_I32("level", jsonx_test_level),
+    JX_PROPERTY_STRING_BUFFER("mode", jsonx_test_mode),
+    JX_PROPERTY_ARRAY("limits", jsonx_test_limit_items)
+};
+
+#define JSONX_TEST_ROOT_COUNT (sizeof(jsonx_test_root) / sizeof(jsonx_test_root[0]))
+
+static const char jsonx_test_desired[] =
+    "{\"id\":4,\"level\":-2,\"mode\":\"eco \\u00e9\",\"limits\":[10,20],\"note\":\"ignored\"}";
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX hash test failed: %s\n", message);
+    return 1;
+}
+
+static int test_hash(void)
+{
+    static const char text[] = "0123456789abcdefghijklmnopqrstuvwxyz0123456789";
+    uint64_t whole = jx_hash(text, sizeof(text) - 1U);
+
+    if ((whole != jx_hash(text, sizeof(text) - 1U)) ||
+        (whole == jx_hash(text, sizeof(text) - 2U)) ||
+        (jx_hash(text, 0U) == jx_hash(text, 1U)) ||
+        (jx_hash(NULL, 0U) != jx_hash(text, 0U)))
+    {
+        return test_fail("jx_hash");
+    }
+
+    /* Every tail length and lane position must reach the result. */
+    for (size_t length = 1U; length < sizeof(text); ++length)
+    {
+        char changed[sizeof(text)];
+
+        memcpy(changed, text, sizeof(text));
+        changed[length - 1U] ^= 0x01;
+        if (jx_hash(changed, length) == jx_hash(text, length))
+        {
+            return test_fail("jx_hash ignores a byte");
+        }
+    }
+
+    return 0;
+}
+
+static JX_STATUS test_equals(const char *json, bool *equal)
+{
+    *equal = false;
+    return jx_json_equals_struct(json, jsonx_test_root, JSONX_TEST_ROOT_COUNT, equal);
+}
+
+static int test_compare(void)
+{
+    static const char *const changed[] =
+    {
+        "{\"id\":5}",
+        "{\"level\":2}",
+        "{\"mode\":\"eco \\u00e8\"}",
+        "{\"mode\":\"eco\"}",
+        "{\"mode\":\"eco \\u00e9x\"}",
+        "{\"limits\":[10]}",
+        "{\"limits\":[10,21]}",
+        "{\"limits\":[10,20,30]}"
+    };
+    static const char *const unchanged[] =
+    {
+        "{}",
+        "{\"id\":4}",
+        "{ \"mode\" : \"eco \xC3\xA9\", \"other\" : [1, {\"x\": 2}] }",
+        "{\"limits\":[10,20],\"id\":\"text\"}"
+    };
+    bool equal;
+
+    for (size_t i = 0U; i < (sizeof(changed) / sizeof(changed[0])); ++i)
+    {
+        if ((test_equals(changed[i], &equal) != JX_SUCCESS) || equal)
+        {
+            return test_fail(changed[i]);
+        }
+    }
+
+    for (size_t i = 0U; i < (sizeof(unchanged) / sizeof(unchanged[0])); ++i)
+    {
+        if ((test_equals(unchanged[i], &equal) != JX_SUCCESS) || !equal)
+        {
+            return test_fail(unchanged[i]);
+        }
+    }
+
+    if ((test_equals("{\"id\":4,}", &equal) != JX_ERROR) ||
+        (test_equals("{\"mode\":\"longer than sixteen bytes\"}", &equal) != JX_ERROR) ||
+        (test_equals("{\"limits\":[1,2,3,4,5]}", &equal) != JX_ERROR))
+    {
+        return test_fail("invalid document compared");
+    }
+
+    /* Comparing never writes values or counts. */
+    if ((jsonx_test_id != 4U) || (jsonx_test_level != -2) || (strcmp(jsonx_test_mode, "eco \xC3\xA9") != 0) ||
+        (jsonx_test_root[3].value_len != 2U) || (jsonx_test_limits[2] != 0U))
+    {
+        return test_fail("comparison changed the mapping");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_APPLIED applied = JX_APPLIED_INIT;
+    char input[JSONX_TEST_BUFFER_SIZE];
+    bool changed = false;
+
+    if (test_hash() != 0)
+    {
+        return 1;
+    }
+
+    strcpy(input, jsonx_test_desired);
+    if ((jx_context_json_to_struct_if_changed(&context, &applied, input, jsonx_test_root,
+                                              JSONX_TEST_ROOT_COUNT, JX_MODE_RELAXED, &changed) != JX_SUCCESS) ||
+        !changed || !applied.valid || (jsonx_test_id != 4U) || (jsonx_test_limits[1] != 20U))
+    {
+        return test_fail("first document not applied");
+    }
+
+    /* The same document again is recognised without parsing. */
+    jsonx_test_id = 99U;
+    if ((jx_context_json_to_struct_if_changed(&context, &applied, input, jsonx_test_root,
+                                              JSONX_TEST_ROOT_COUNT, JX_MODE_RELAXED, &changed) != JX_SUCCESS) ||
+        changed || (jsonx_test_id != 99U))
+    {
+        return test_fail("repeated document parsed");
+    }
+    jsonx_test_id = 4U;
+
+    if (test_compare() != 0)
+    {
+        return 1;
+    }
+
+    /* A failed parse forgets the last document, so it is applied again afterwards. */
+    strcpy(input, "{\"id\":6,\"level\":}");
+    if ((jx_context_json_to_struct_if_changed(&context, &applied, input, jsonx_test_root,
+                                              JSONX_TEST_ROOT_COUNT, JX_MODE_RELAXED, &changed) != JX_ERROR) ||
+        changed || applied.valid)
+    {
+        return test_fail("failed document recorded");
+    }
+
+    strcpy(input, jsonx_test_desired);
+    if ((jx_context_json_to_struct_if_changed(&context, &applied, input, jsonx_test_root,
+                                              JSONX_TEST_ROOT_COUNT, JX_MODE_RELAXED, &changed) != JX_SUCCESS) ||
+        !changed || (jsonx_test_id != 4U))
+    {
+        return test_fail("document after failure not applied");
+    }
+
+    return 0;
+}
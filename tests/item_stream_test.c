@@ -0,0 +1,293 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_EVENT_COUNT    1000U
+#define JSONX_TEST_JSON_SIZE     (64U * 1024U)
+
+typedef struct
+{
+    uint32_t seen;
+    uint32_t id_sum;
+    uint32_t missing_kind;
+    uint32_t stop_at;
+    size_t   produce_count;
+} JsonX_TestEvents;
+
+static uint32_t jsonx_test_total;
+static uint32_t jsonx_test_id;
+static char jsonx_test_kind[8];
+static uint32_t jsonx_test_sample;
+static JsonX_TestEvents jsonx_test_state;
+static JX_ITEM_STREAM jsonx_test_events;
+static JX_ITEM_STREAM jsonx_test_samples;
+
+static JX_ELEMENT jsonx_test_event_template[] =
+{
+    JX_PROPERTY_U32("id", jsonx_test_id),
+    JX_PROPERTY_STRING_BUFFER("kind", jsonx_test_kind)
+};
+
+static JX_ELEMENT jsonx_test_sample_template[] =
+{
+    JX_U32_VAL(jsonx_test_sample)
+};
+
+static JX_ELEMENT jsonx_test_root[] =
+{
+    JX_PROPERTY_U32("total", jsonx_test_total),
+    JX_PROPERTY_ITEM_STREAM("events", jsonx_test_events, jsonx_test_event_template),
+    JX_PROPERTY_ITEM_STREAM("samples", jsonx_test_samples, jsonx_test_sample_template)
+};
+
+#define JSONX_TEST_ROOT_COUNT (sizeof(jsonx_test_root) / sizeof(jsonx_test_root[0]))
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX item stream test failed: %s\n", message);
+    return 1;
+}
+
+static bool test_consume_event(void *context, size_t index)
+{
+    JsonX_TestEvents *state = (JsonX_TestEvents *)context;
+
+    if ((index != state->seen) || (index == state->stop_at))
+    {
+        return false;
+    }
+
+    state->seen++;
+    state->id_sum += jsonx_test_id;
+    if (jsonx_test_event_template[1].status != JX_ELEMENT_UPDATED)
+    {
+        state->missing_kind++;
+    }
+    return true;
+}
+
+static bool test_consume_sample(void *context, size_t index)
+{
+    (void)index;
+    *(uint32_t *)context += jsonx_test_sample;
+    return true;
+}
+
+static bool test_produce_event(void *context, size_t index, bool *end)
+{
+    if (index >= ((JsonX_TestEvents *)context)->produce_count)
+    {
+        *end = true;
+        return true;
+    }
+
+    jsonx_test_id = (uint32_t)index;
+    (void)snprintf(jsonx_test_kind, sizeof(jsonx_test_kind), "k%u", (unsigned)(index % 10U));
+    return true;
+}
+
+static bool test_produce_sample(void *context, size_t index, bool *end)
+{
+    (void)context;
+    *end = (index >= 3U);
+    jsonx_test_sample = (uint32_t)(index + 1U) * 10U;
+    return true;
+}
+
+static bool test_produce_fail(void *context, size_t index, bool *end)
+{
+    (void)context;
+    (void)end;
+    return index < 2U;
+}
+
+static void test_reset(size_t produce_count, uint32_t *sample_sum)
+{
+    memset(&jsonx_test_state, 0, sizeof(jsonx_test_state));
+    jsonx_test_state.stop_at = UINT32_MAX;
+    jsonx_test_state.produce_count = produce_count;
+    jsonx_test_events = (JX_ITEM_STREAM)JX_ITEM_STREAM_INIT(test_consume_event, test_produce_event, &jsonx_test_state);
+    jsonx_test_samples = (JX_ITEM_STREAM)JX_ITEM_STREAM_INIT(test_consume_sample, test_produce_sample, sample_sum);
+}
+
+/* More events than any mapped array could hold, one template of storage. */
+static int test_parse(JX_CONTEXT *context)
+{
+    static char input[JSONX_TEST_JSON_SIZE];
+    uint32_t sample_sum = 0U;
+    size_t length;
+
+    length = (size_t)snprintf(input, sizeof(input), "{\"total\":%u,\"events\":[", JSONX_TEST_EVENT_COUNT);
+    for (uint32_t i = 0U; i < JSONX_TEST_EVENT_COUNT; ++i)
+    {
+        length += (size_t)snprintf(&input[length], sizeof(input) - length, "%s{\"id\":%u%s}",
+                                   (i != 0U) ? ", " : "", i, ((i % 100U) == 0U) ? "" : ",\"kind\":\"net\"");
+    }
+    (void)snprintf(&input[length], sizeof(input) - length, "],\"samples\":[1,2,3,4]}");
+
+    test_reset(0U, &sample_sum);
+    if ((jx_context_json_to_struct(context, input, jsonx_test_root, JSONX_TEST_ROOT_COUNT,
+                                   JX_MODE_RELAXED) != JX_SUCCESS) ||
+        (jsonx_test_events.count != JSONX_TEST_EVENT_COUNT) || (jsonx_test_state.seen != JSONX_TEST_EVENT_COUNT) ||
+        (jsonx_test_state.id_sum != ((JSONX_TEST_EVENT_COUNT * (JSONX_TEST_EVENT_COUNT - 1U)) / 2U)) ||
+        (jsonx_test_state.missing_kind != (JSONX_TEST_EVENT_COUNT / 100U)) || (sample_sum != 10U) ||
+        (jsonx_test_samples.count != 4U) || (jsonx_test_root[1].status != JX_ELEMENT_UPDATED))
+    {
+        return test_fail("streamed parse");
+    }
+
+    /* A callback that stops the parse fails it. */
+    test_reset(0U, &sample_sum);
+    jsonx_test_state.stop_at = 3U;
+    if ((jx_context_json_to_struct(context, input, jsonx_test_root, JSONX_TEST_ROOT_COUNT,
+                                   JX_MODE_RELAXED) != JX_ERROR) ||
+        (jsonx_test_state.seen != 3U) || (jsonx_test_events.count != 3U))
+    {
+        return test_fail("stopped parse");
+    }
+
+    test_reset(0U, &sample_sum);
+    if ((jx_context_json_to_struct(context, "{\"events\":[{\"id\":1},]}", jsonx_test_root,
+                                   JSONX_TEST_ROOT_COUNT, JX_MODE_RELAXED) != JX_ERROR) ||
+        (jx_context_json_to_struct(context, "{\"events\":[{\"id\":1} {\"id\":2}]}", jsonx_test_root,
+                                   JSONX_TEST_ROOT_COUNT, JX_MODE_RELAXED) != JX_ERROR) ||
+        (jx_context_json_to_struct(context, "{\"events\":[1]}", jsonx_test_root,
+                                   JSONX_TEST_ROOT_COUNT, JX_MODE_RELAXED) != JX_ERROR))
+    {
+        return test_fail("broken array accepted");
+    }
+
+    test_reset(0U, &sample_sum);
+    if ((jx_context_json_to_struct(context, "{\"events\":[ ],\"samples\":[]}", jsonx_test_root,
+                                   JSONX_TEST_ROOT_COUNT, JX_MODE_RELAXED) != JX_SUCCESS) ||
+        (jsonx_test_events.count != 0U) || (jsonx_test_state.seen != 0U))
+    {
+        return test_fail("empty array");
+    }
+
+    return 0;
+}
+
+static int test_write(JX_CONTEXT *context)
+{
+    static char output[JSONX_TEST_JSON_SIZE];
+    uint32_t sample_sum = 0U;
+
+    /* Three events written through the generator match the plain array form. */
+    {
+        static uint32_t ids[3] = { 0U, 1U, 2U };
+        static char kinds[3][8] = { "k0", "k1", "k2" };
+        static uint32_t samples[3] = { 10U, 20U, 30U };
+        static JX_ELEMENT event0[] = { JX_PROPERTY_U32("id", ids[0]), JX_PROPERTY_STRING_BUFFER("kind", kinds[0]) };
+        static JX_ELEMENT event1[] = { JX_PROPERTY_U32("id", ids[1]), JX_PROPERTY_STRING_BUFFER("kind", kinds[1]) };
+        static JX_ELEMENT event2[] = { JX_PROPERTY_U32("id", ids[2]), JX_PROPERTY_STRING_BUFFER("kind", kinds[2]) };
+        static JX_ELEMENT events[] = { JX_OBJECT_VAL(event0), JX_OBJECT_VAL(event1), JX_OBJECT_VAL(event2) };
+        static JX_ELEMENT sample_items[] =
+        {
+            JX_U32_VAL(samples[0]), JX_U32_VAL(samples[1]), JX_U32_VAL(samples[2])
+        };
+        static JX_ELEMENT plain[] =
+        {
+            JX_PROPERTY_U32("total", jsonx_test_total),
+            JX_PROPERTY_ARRAY("events", events),
+            JX_PROPERTY_ARRAY("samples", sample_items)
+        };
+        static char expected[512];
+        static const JX_FORMAT formats[] = { JX_MINIFIED, JX_FORMATTED };
+
+        for (size_t i = 0U; i < (sizeof(formats) / sizeof(formats[0])); ++i)
+        {
+            if (jx_context_struct_to_json(context, plain, 3U, expected, sizeof(expected), formats[i]) != JX_SUCCESS)
+            {
+                return test_fail("plain write");
+            }
+
+            test_reset(3U, &sample_sum);
+            if ((jx_context_struct_to_json(context, jsonx_test_root, JSONX_TEST_ROOT_COUNT, output, sizeof(output),
+                                           formats[i]) != JX_SUCCESS) ||
+                (strcmp(output, expected) != 0))
+            {
+                return test_fail(expected);
+            }
+        }
+    }
+
+    /* A long generated array parses back to the same events. */
+    test_reset(JSONX_TEST_EVENT_COUNT, &sample_sum);
+    if (jx_context_struct_to_json(context, jsonx_test_root, JSONX_TEST_ROOT_COUNT, output, sizeof(output),
+                                  JX_MINIFIED) != JX_SUCCESS)
+    {
+        return test_fail("long write");
+    }
+
+    test_reset(0U, &sample_sum);
+    if ((jx_context_json_to_struct(context, output, jsonx_test_root, JSONX_TEST_ROOT_COUNT,
+                                   JX_MODE_STRICT) != JX_SUCCESS) ||
+        (jsonx_test_state.seen != JSONX_TEST_EVENT_COUNT) || (jsonx_test_state.missing_kind != 0U) ||
+        (sample_sum != 60U))
+    {
+        return test_fail("round trip");
+    }
+
+    test_reset(0U, &sample_sum);
+    if (strcmp((jx_context_struct_to_json(context, jsonx_test_root, JSONX_TEST_ROOT_COUNT, output, sizeof(output),
+                                          JX_MINIFIED) == JX_SUCCESS) ? output : "",
+               "{\"total\":1000,\"events\":[],\"samples\":[10,20,30]}") != 0)
+    {
+        return test_fail("empty write");
+    }
+
+    test_reset(3U, &sample_sum);
+    jsonx_test_samples.produce = test_produce_fail;
+    if (jx_context_struct_to_json(context, jsonx_test_root, JSONX_TEST_ROOT_COUNT, output, sizeof(output),
+                                  JX_MINIFIED) != JX_ERROR)
+    {
+        return test_fail("failing generator accepted");
+    }
+
+    jsonx_test_samples.produce = NULL;
+    if (jx_context_struct_to_json(context, jsonx_test_root, JSONX_TEST_ROOT_COUNT, output, sizeof(output),
+                                  JX_MINIFIED) != JX_ERROR)
+    {
+        return test_fail("missing generator accepted");
+    }
+
+    return 0;
+}
+
+/* Delivered items are not kept, so they can never be proven unchanged. */
+static int test_equals(void)
+{
+    uint32_t sample_sum = 0U;
+    bool equal = true;
+
+    test_reset(0U, &sample_sum);
+    jsonx_test_total = 2U;
+    if ((jx_json_equals_struct("{\"total\":2,\"samples\":[1,2]}", jsonx_test_root,
+                               JSONX_TEST_ROOT_COUNT, &equal) != JX_SUCCESS) || equal || (sample_sum != 0U))
+    {
+        return test_fail("item stream compared equal");
+    }
+
+    if ((jx_json_equals_struct("{\"total\":2}", jsonx_test_root, JSONX_TEST_ROOT_COUNT, &equal) != JX_SUCCESS) ||
+        !equal)
+    {
+        return test_fail("document without the stream");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+
+    if ((test_parse(&context) != 0) || (test_write(&context) != 0) || (test_equals() != 0))
+    {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+#include "jx_api.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define JSONX_TEST_WORKERS            4U
+#define JSONX_TEST_RECORDS         5000U
+#define JSONX_TEST_RANGE_SIZE        64U
+#define JSONX_TEST_RANGE_BUFFER    4096U
+
+typedef struct
+{
+    uint32_t id;
+    uint64_t stamp;
+} JsonX_TestRecord;
+
+static JsonX_TestRecord jsonx_test_records[JSONX_TEST_RECORDS];
+static JX_RECORDS jsonx_test_set = JX_RECORDS_INIT(jsonx_test_records, JSONX_TEST_RECORDS);
+
+static JX_ELEMENT jsonx_test_template[] =
+{
+    JX_PROPERTY_U32("id", jsonx_test_records[0].id),
+    JX_PROPERTY_U64("stamp", jsonx_test_records[0].stamp)
+};
+
+static JX_ELEMENT jsonx_test_root[] =
+{
+    JX_PROPERTY_RECORD_ARRAY("log", jsonx_test_set, jsonx_test_template)
+};
+
+static JsonX_TestRecord jsonx_test_parsed[JSONX_TEST_RECORDS];
+static JX_RECORDS jsonx_test_parsed_set = JX_RECORDS_INIT(jsonx_test_parsed, 0U);
+
+static JX_ELEMENT jsonx_test_parsed_template[] =
+{
+    JX_PROPERTY_U32("id", jsonx_test_parsed[0].id),
+    JX_PROPERTY_U64("stamp", jsonx_test_parsed[0].stamp)
+};
+
+static JX_ELEMENT jsonx_test_parsed_root[] =
+{
+    JX_PROPERTY_RECORD_ARRAY("log", jsonx_test_parsed_set, jsonx_test_parsed_template)
+};
+
+static JX_RANGE_JOB jsonx_test_job;
+static const char *jsonx_test_bulk;
+static JX_SPAN jsonx_test_items[JSONX_TEST_RECORDS];
+static char (*jsonx_test_parts)[JSONX_TEST_RANGE_BUFFER];
+static size_t *jsonx_test_lengths;
+static volatile int jsonx_test_failed;
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX parallel write test failed: %s\n", message);
+    return 1;
+}
+
+static void *jsonx_test_worker(void *argument)
+{
+    size_t index;
+    size_t first;
+    size_t count;
+
+    (void)argument;
+
+    while (jx_range_job_claim(&jsonx_test_job, &index, &first, &count))
+    {
+        if (jx_struct_to_json_range(jsonx_test_root, 1U, &jsonx_test_root[0], first, count,
+                                    jsonx_test_parts[index], JSONX_TEST_RANGE_BUFFER,
+                                    JX_MINIFIED, &jsonx_test_lengths[index]) != JX_SUCCESS)
+        {
+            jsonx_test_failed = 1;
+        }
+    }
+
+    return NULL;
+}
+
+/* Each parse worker owns its context and its copy of the template. */
+static void *jsonx_test_parse_worker(void *argument)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_ELEMENT template[2];
+    JX_ELEMENT records_element = jsonx_test_parsed_root[0];
+    size_t index;
+    size_t first;
+    size_t count;
+
+    (void)argument;
+
+    memcpy(template, jsonx_test_parsed_template, sizeof(template));
+    records_element.element = template;
+
+    while (jx_range_job_claim(&jsonx_test_job, &index, &first, &count))
+    {
+        if (jx_records_parse_items(&context, jsonx_test_bulk, jsonx_test_items, first, count,
+                                   &records_element, JX_MODE_STRICT) != JX_SUCCESS)
+        {
+            jsonx_test_failed = 1;
+        }
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    pthread_t workers[JSONX_TEST_WORKERS];
+    size_t whole_size = JSONX_TEST_RECORDS * 48U;
+    char *whole;
+    char *joined;
+    size_t joined_length = 0U;
+    size_t ranges;
+    int result = 0;
+
+    for (uint32_t i = 0U; i < JSONX_TEST_RECORDS; ++i)
+    {
+        jsonx_test_records[i].id = i;
+        jsonx_test_records[i].stamp = 1700000000000ULL + i;
+    }
+
+    if ((jx_range_job_init(&jsonx_test_job, JSONX_TEST_RECORDS, JSONX_TEST_RANGE_SIZE) != JX_SUCCESS) ||
+        ((ranges = jx_range_job_count(&jsonx_test_job)) != 79U))
+    {
+        return test_fail("jx_range_job_init");
+    }
+
+    jsonx_test_parts = calloc(ranges, sizeof(*jsonx_test_parts));
+    jsonx_test_lengths = calloc(ranges, sizeof(*jsonx_test_lengths));
+    whole = malloc(whole_size);
+    joined = malloc(whole_size);
+    if ((jsonx_test_parts == NULL) || (jsonx_test_lengths == NULL) || (whole == NULL) || (joined == NULL))
+    {
+        return test_fail("allocation");
+    }
+
+    for (size_t i = 0U; i < JSONX_TEST_WORKERS; ++i)
+    {
+        if (pthread_create(&workers[i], NULL, jsonx_test_worker, NULL) != 0)
+        {
+            return test_fail("pthread_create");
+        }
+    }
+    for (size_t i = 0U; i < JSONX_TEST_WORKERS; ++i)
+    {
+        pthread_join(workers[i], NULL);
+    }
+
+    /* Ranges are joined in index order, whichever worker formatted them. */
+    for (size_t i = 0U; i < ranges; ++i)
+    {
+        memcpy(&joined[joined_length], jsonx_test_parts[i], jsonx_test_lengths[i]);
+        joined_length += jsonx_test_lengths[i];
+    }
+    joined[joined_length] = '\0';
+
+    if (jsonx_test_failed)
+    {
+        result = test_fail("range formatting");
+    }
+    else if ((jx_context_struct_to_json(&context, jsonx_test_root, 1U, whole, whole_size, JX_MINIFIED) != JX_SUCCESS) ||
+             (strcmp(whole, joined) != 0))
+    {
+        result = test_fail("joined output differs from single-threaded output");
+    }
+    else
+    {
+        size_t items = 0U;
+
+        /* Parse the bare record array back with the same workers. */
+        joined[joined_length - 1U] = '\0';
+        jsonx_test_bulk = strchr(joined, '[');
+        if ((jx_array_split(jsonx_test_bulk, jsonx_test_items, JSONX_TEST_RECORDS, &items) != JX_SUCCESS) ||
+            (items != JSONX_TEST_RECORDS) ||
+            (jx_range_job_init(&jsonx_test_job, items, JSONX_TEST_RANGE_SIZE) != JX_SUCCESS))
+        {
+            result = test_fail("jx_array_split");
+        }
+        else
+        {
+            for (size_t i = 0U; i < JSONX_TEST_WORKERS; ++i)
+            {
+                if (pthread_create(&workers[i], NULL, jsonx_test_parse_worker, NULL) != 0)
+                {
+                    return test_fail("pthread_create");
+                }
+            }
+            for (size_t i = 0U; i < JSONX_TEST_WORKERS; ++i)
+            {
+                pthread_join(workers[i], NULL);
+            }
+            jsonx_test_parsed_set.count = items;
+
+            if (jsonx_test_failed ||
+                (memcmp(jsonx_test_parsed, jsonx_test_records, sizeof(jsonx_test_records)) != 0))
+            {
+                result = test_fail("parallel parse differs from source records");
+            }
+        }
+    }
+
+    free(joined);
+    free(whole);
+    free(jsonx_test_lengths);
+    free(jsonx_test_parts);
+    return result;
+}
@@ -0,0 +1,148 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_BUFFER_SIZE     512U
+#define JSONX_TEST_CHUNK_SIZE        7U
+
+typedef struct
+{
+    char data[JSONX_TEST_BUFFER_SIZE];
+    size_t length;
+} JsonX_TestSink;
+
+static uint32_t jsonx_test_id = 12U;
+static char jsonx_test_name[16] = "pump \"B\"";
+static char jsonx_test_ssid[16] = "plant";
+static int32_t jsonx_test_rssi = -70;
+static uint32_t jsonx_test_samples[2] = { 5U, 6U };
+static uint32_t jsonx_test_rotate = 4U;
+
+static JX_ELEMENT jsonx_test_sample_items[] =
+{
+    JX_U32_VAL(jsonx_test_samples[0]),
+    JX_U32_VAL(jsonx_test_samples[1])
+};
+
+/* Subsystem mappings, as their owners keep them. */
+static JX_ELEMENT jsonx_test_identity[] =
+{
+    JX_PROPERTY_U32("id", jsonx_test_id),
+    JX_PROPERTY_STRING_BUFFER("name", jsonx_test_name)
+};
+
+static JX_ELEMENT jsonx_test_network[] =
+{
+    JX_PROPERTY_STRING_BUFFER("ssid", jsonx_test_ssid),
+    JX_PROPERTY_I32("rssi", jsonx_test_rssi),
+    JX_PROPERTY_ARRAY("samples", jsonx_test_sample_items)
+};
+
+static JX_ELEMENT jsonx_test_logging[] =
+{
+    JX_PROPERTY_U32("rotate", jsonx_test_rotate)
+};
+
+/* The combined root the parts replace. */
+static JX_ELEMENT jsonx_test_combined[] =
+{
+    JX_PROPERTY_U32("id", jsonx_test_id),
+    JX_PROPERTY_STRING_BUFFER("name", jsonx_test_name),
+    JX_PROPERTY_OBJECT("network", jsonx_test_network),
+    JX_PROPERTY_OBJECT("logging", jsonx_test_logging)
+};
+
+static const JX_DOCUMENT_PART jsonx_test_parts[] =
+{
+    { NULL, jsonx_test_identity, 2U },
+    { "network", jsonx_test_network, 3U },
+    { "logging", jsonx_test_logging, 1U }
+};
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX parts test failed: %s\n", message);
+    return 1;
+}
+
+static bool test_sink(void *context, const char *data, size_t length)
+{
+    JsonX_TestSink *sink = (JsonX_TestSink *)context;
+
+    if ((sink->length + length) >= sizeof(sink->data))
+    {
+        return false;
+    }
+
+    memcpy(&sink->data[sink->length], data, length);
+    sink->length += length;
+    sink->data[sink->length] = '\0';
+    return true;
+}
+
+/* Parts must produce exactly what the combined root produces. */
+static int test_format(JX_CONTEXT *context, JX_FORMAT format)
+{
+    char expected[JSONX_TEST_BUFFER_SIZE];
+    char output[JSONX_TEST_BUFFER_SIZE];
+    char chunk[JSONX_TEST_CHUNK_SIZE];
+    JsonX_TestSink sink = { { 0 }, 0U };
+
+    if (jx_context_struct_to_json(context, jsonx_test_combined, 4U, expected, sizeof(expected), format) != JX_SUCCESS)
+    {
+        return test_fail("combined root");
+    }
+
+    if ((jx_context_struct_to_json_parts(context, jsonx_test_parts, 3U, output, sizeof(output),
+                                         format) != JX_SUCCESS) ||
+        (strcmp(output, expected) != 0))
+    {
+        return test_fail(expected);
+    }
+
+    if ((jx_context_struct_to_json_parts_chunked(context, jsonx_test_parts, 3U, chunk, sizeof(chunk), format,
+                                                 test_sink, &sink) != JX_SUCCESS) ||
+        (strcmp(sink.data, expected) != 0))
+    {
+        return test_fail("chunked parts");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_DOCUMENT_PART parts[2];
+    char output[JSONX_TEST_BUFFER_SIZE];
+
+    if ((test_format(&context, JX_MINIFIED) != 0) || (test_format(&context, JX_FORMATTED) != 0) ||
+        (test_format(&context, (JX_FORMAT)(JX_MINIFIED_ASCII | JX_FORMAT_ALIASES)) != 0))
+    {
+        return 1;
+    }
+
+    /* Two unkeyed parts share the root; keys need escaping like any name. */
+    parts[0] = (JX_DOCUMENT_PART){ NULL, jsonx_test_logging, 1U };
+    parts[1] = (JX_DOCUMENT_PART){ "a\"b", jsonx_test_logging, 1U };
+    if ((jx_context_struct_to_json_parts(&context, parts, 2U, output, sizeof(output), JX_MINIFIED) != JX_SUCCESS) ||
+        (strcmp(output, "{\"rotate\":4,\"a\\\"b\":{\"rotate\":4}}") != 0))
+    {
+        return test_fail(output);
+    }
+
+    parts[1].element = NULL;
+    if ((jx_context_struct_to_json_parts(&context, parts, 2U, output, sizeof(output), JX_MINIFIED) != JX_ERROR) ||
+        (jx_context_struct_to_json_parts(&context, jsonx_test_parts, 0U, output, sizeof(output),
+                                         JX_MINIFIED) != JX_ERROR) ||
+        (jx_context_struct_to_json_parts(&context, jsonx_test_parts, 3U, output, 16U, JX_MINIFIED) != JX_ERROR) ||
+        (jx_context_struct_to_json_parts_chunked(&context, jsonx_test_parts, 3U, output, sizeof(output),
+                                                 JX_MINIFIED, NULL, NULL) != JX_ERROR))
+    {
+        return test_fail("invalid arguments accepted");
+    }
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include "jx_api.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_BUFFER_SIZE     256U
+
+static const char jsonx_test_document[] =
+    "{\n"
+    "  \"id\": 7,\n"
+    "  \"name\": \"sensor \\\"7\\\"\",\n"
+    "  \"blob\": { \"skip\": [1, 2, \"}]\"], \"more\": {} },\n"
+    "  \"samples\": [ 1, 2, 3 ],\n"
+    "  \"network\": { \"ssid\": \"plant-a\", \"rssi\": -61, \"extra\": null },\n"
+    "  \"status\": { \"code\": 3 }\n"
+    "}\n";
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX project test failed: %s\n", message);
+    return 1;
+}
+
+static int test_expect(const char *const *paths, size_t path_count, const char *expected)
+{
+    char output[JSONX_TEST_BUFFER_SIZE];
+    size_t written = 0U;
+
+    if ((jx_project(jsonx_test_document, paths, path_count, output, sizeof(output), &written) != JX_SUCCESS) ||
+        (strcmp(output, expected) != 0) || (written != strlen(expected)))
+    {
+        return test_fail(expected);
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    static const char *const top[] = { "id", "samples" };
+    static const char *const nested[] = { "network.rssi", "name", "network.ssid" };
+    static const char *const overlap[] = { "network.rssi", "network" };
+    static const char *const missing[] = { "status.reason", "network.rssi.value", "unknown", "samples.0" };
+    static const char *const invalid[] = { "id", "network..rssi" };
+    static const char *const deep_path[] = { "b.c.d.e" };
+    static const char broken[] = "{\"id\":1,\"skip\":[1,,2]}";
+    static const char deep[] = "{\"id\":1,\"b\":{\"c\":{\"d\":{\"e\":[[[2]]],\"f\":{\"g\":{}}}}}}";
+    char output[JSONX_TEST_BUFFER_SIZE];
+
+    if ((test_expect(top, 2U, "{\"id\":7,\"samples\":[ 1, 2, 3 ]}") != 0) ||
+        (test_expect(nested, 3U, "{\"name\":\"sensor \\\"7\\\"\",\"network\":{\"ssid\":\"plant-a\",\"rssi\":-61}}") != 0) ||
+        (test_expect(overlap, 2U, "{\"network\":{ \"ssid\": \"plant-a\", \"rssi\": -61, \"extra\": null }}") != 0) ||
+        (test_expect(missing, 4U, "{}") != 0))
+    {
+        return 1;
+    }
+
+    /* Skipped members are still validated. */
+    if ((jx_project(broken, top, 1U, output, sizeof(output), NULL) != JX_ERROR) ||
+        (jx_project("[1]", top, 1U, output, sizeof(output), NULL) != JX_ERROR) ||
+        (jx_project("{\"id\":1} x", top, 1U, output, sizeof(output), NULL) != JX_ERROR))
+    {
+        return test_fail("invalid document accepted");
+    }
+
+    /* Deep subtrees are skipped or followed past the mapping nesting limit. */
+    if ((jx_project(deep, top, 1U, output, sizeof(output), NULL) != JX_SUCCESS) ||
+        (strcmp(output, "{\"id\":1}") != 0) ||
+        (jx_project(deep, deep_path, 1U, output, sizeof(output), NULL) != JX_SUCCESS) ||
+        (strcmp(output, "{\"b\":{\"c\":{\"d\":{\"e\":[[[2]]]}}}}") != 0))
+    {
+        return test_fail("deep document");
+    }
+
+    if ((jx_project(jsonx_test_document, invalid, 2U, output, sizeof(output), NULL) != JX_ERROR) ||
+        (jx_project(jsonx_test_document, top, 0U, output, sizeof(output), NULL) != JX_ERROR) ||
+        (jx_project(jsonx_test_document, top, 2U, output, 16U, NULL) != JX_ERROR))
+    {
+        return test_fail("invalid arguments accepted");
+    }
+
+    return 0;
+}
@@ -0,0 +1,298 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_POOL_SIZE      1024U
+#define JSONX_TEST_RECORDS          10U
+#define JSONX_TEST_BUFFER_SIZE    2048U
+
+typedef struct
+{
+    uint32_t id;
+    int32_t  offset;
+    char     tag[8];
+} JsonX_TestRecord;
+
+static unsigned char jsonx_test_pool[JSONX_TEST_POOL_SIZE];
+static JsonX_TestRecord jsonx_test_records[JSONX_TEST_RECORDS];
+static JX_RECORDS jsonx_test_set = JX_RECORDS_INIT(jsonx_test_records, 0U);
+
+static JX_ELEMENT jsonx_test_template[] =
+{
+    JX_PROPERTY_U32("id", jsonx_test_records[0].id),
+    JX_PROPERTY_I32("offset", jsonx_test_records[0].offset),
+    JX_PROPERTY_STRING_BUFFER("tag", jsonx_test_records[0].tag)
+};
+
+static uint32_t jsonx_test_version = 3U;
+
+static JX_ELEMENT jsonx_test_root[] =
+{
+    JX_PROPERTY_U32("version", jsonx_test_version),
+    JX_PROPERTY_RECORD_ARRAY("items", jsonx_test_set, jsonx_test_template),
+    JX_PROPERTY_NULL("next")
+};
+
+#define JSONX_TEST_ROOT_COUNT (sizeof(jsonx_test_root) / sizeof(jsonx_test_root[0]))
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX records test failed: %s\n", message);
+    return 1;
+}
+
+static void test_fill(void)
+{
+    for (uint32_t i = 0U; i < JSONX_TEST_RECORDS; ++i)
+    {
+        jsonx_test_records[i].id = 100U + i;
+        jsonx_test_records[i].offset = -(int32_t)i;
+        snprintf(jsonx_test_records[i].tag, sizeof(jsonx_test_records[i].tag), "t%lu", (unsigned long)i);
+    }
+    jsonx_test_set.count = JSONX_TEST_RECORDS;
+}
+
+/* Brackets, commas and escaped quotes inside strings are not structure. */
+static int test_split(void)
+{
+    static const char bulk[] = " [ {\"id\":1,\"tag\":\"a]b\"} ,\n{\"id\":2,\"tag\":\"q\\\",{\"},"
+                               "{\"id\":3,\"tag\":\"\\\\\"}\t] ";
+    static const char broken[] = "[{\"id\":1},{\"id\":x}]";
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_SPAN items[4];
+    size_t count = 0U;
+
+    if ((jx_array_split(bulk, NULL, 0U, &count) != JX_SUCCESS) || (count != 3U) ||
+        (jx_array_split(bulk, items, 2U, &count) != JX_ERROR) ||
+        (jx_array_split(bulk, items, 4U, &count) != JX_SUCCESS) || (count != 3U) ||
+        (items[0].offset != 3U) || (bulk[items[0].offset + items[0].length - 1U] != '}') ||
+        (strncmp(&bulk[items[1].offset], "{\"id\":2", 7U) != 0))
+    {
+        return test_fail("jx_array_split");
+    }
+
+    if ((jx_array_split(" [ ] ", items, 4U, &count) != JX_SUCCESS) || (count != 0U) ||
+        (jx_array_split("[{},]", items, 4U, &count) != JX_ERROR) ||
+        (jx_array_split("[{},,{}]", items, 4U, &count) != JX_ERROR) ||
+        (jx_array_split("[{}", items, 4U, &count) != JX_ERROR) ||
+        (jx_array_split("[{\"a\":\"]}", items, 4U, &count) != JX_ERROR) ||
+        (jx_array_split("[{}}]", items, 4U, &count) != JX_ERROR) ||
+        (jx_array_split("[{}] x", items, 4U, &count) != JX_ERROR) ||
+        (jx_array_split("{}", items, 4U, &count) != JX_ERROR))
+    {
+        return test_fail("malformed array accepted");
+    }
+
+    (void)jx_array_split(bulk, items, 4U, &count);
+    memset(jsonx_test_records, 0, sizeof(jsonx_test_records));
+    if ((jx_records_parse_items(&context, bulk, items, 1U, 2U, &jsonx_test_root[1], JX_MODE_RELAXED) != JX_SUCCESS) ||
+        (jx_records_parse_items(&context, bulk, items, 0U, 1U, &jsonx_test_root[1], JX_MODE_RELAXED) != JX_SUCCESS) ||
+        (jsonx_test_records[0].id != 1U) || (strcmp(jsonx_test_records[0].tag, "a]b") != 0) ||
+        (jsonx_test_records[1].id != 2U) || (strcmp(jsonx_test_records[1].tag, "q\",{") != 0) ||
+        (jsonx_test_records[2].id != 3U) || (strcmp(jsonx_test_records[2].tag, "\\") != 0))
+    {
+        return test_fail("jx_records_parse_items");
+    }
+
+    /* Strict mode needs every template field in every item. */
+    if ((jx_records_parse_items(&context, bulk, items, 0U, 3U, &jsonx_test_root[1], JX_MODE_STRICT) != JX_ERROR) ||
+        (jx_records_parse_items(&context, bulk, items, JSONX_TEST_RECORDS, 1U, &jsonx_test_root[1], JX_MODE_RELAXED) != JX_ERROR) ||
+        (jx_records_parse_items(&context, bulk, items, 0U, 1U, &jsonx_test_root[0], JX_MODE_RELAXED) != JX_ERROR))
+    {
+        return test_fail("invalid item range accepted");
+    }
+
+    if ((jx_array_split(broken, items, 4U, &count) != JX_SUCCESS) ||
+        (jx_records_parse_items(&context, broken, items, 0U, 2U, &jsonx_test_root[1], JX_MODE_RELAXED) != JX_ERROR) ||
+        (jx_context_get_last_error_offset(&context, broken) != 16U))
+    {
+        return test_fail("invalid item accepted");
+    }
+
+    return 0;
+}
+
+/* Concatenated ranges of every size must equal the single-call output. */
+static int test_ranges(const char *whole, JX_FORMAT format)
+{
+    for (size_t range_size = 1U; range_size <= (JSONX_TEST_RECORDS + 1U); ++range_size)
+    {
+        char joined[JSONX_TEST_BUFFER_SIZE];
+        size_t joined_length = 0U;
+
+        for (size_t first = 0U; first < jsonx_test_set.count; first += range_size)
+        {
+            char part[JSONX_TEST_BUFFER_SIZE];
+            size_t count = jsonx_test_set.count - first;
+            size_t written = 0U;
+
+            if (count > range_size)
+            {
+                count = range_size;
+            }
+
+            if (jx_struct_to_json_range(jsonx_test_root, JSONX_TEST_ROOT_COUNT, &jsonx_test_root[1],
+                                        first, count, part, sizeof(part), format, &written) != JX_SUCCESS)
+            {
+                return test_fail("jx_struct_to_json_range");
+            }
+
+            memcpy(&joined[joined_length], part, written);
+            joined_length += written;
+        }
+
+        joined[joined_length] = '\0';
+        if (strcmp(joined, whole) != 0)
+        {
+            return test_fail("joined ranges differ from whole output");
+        }
+    }
+
+    return 0;
+}
+
+/* Columnar output parses back into the same records, with keys matched once. */
+static int test_columns(void)
+{
+    static const JX_FORMAT formats[] =
+    {
+        (JX_FORMAT)(JX_MINIFIED | JX_FORMAT_COLUMNS),
+        (JX_FORMAT)(JX_FORMATTED | JX_FORMAT_COLUMNS)
+    };
+    static const char *const invalid[] =
+    {
+        "{\"items\":{\"cols\":[\"id\",\"tag\"],\"rows\":[[1]]}}",
+        "{\"items\":{\"cols\":[\"id\",\"tag\"],\"rows\":[[1,\"a\",2]]}}",
+        "{\"items\":{\"rows\":[[1]],\"cols\":[\"id\"]}}",
+        "{\"items\":{\"cols\":[\"id\"],\"rows\":[[1],]}}",
+        "{\"items\":{\"cols\":[\"id\"],\"rows\":[{\"id\":1}]}}",
+        "{\"items\":{\"cols\":[\"id\"],\"rows\":[[\"text\"]],\"more\":1}}"
+    };
+    char row_form[JSONX_TEST_BUFFER_SIZE];
+    char whole[JSONX_TEST_BUFFER_SIZE];
+    char input[JSONX_TEST_BUFFER_SIZE];
+
+    test_fill();
+    (void)jx_struct_to_json(jsonx_test_root, JSONX_TEST_ROOT_COUNT, row_form, sizeof(row_form), JX_MINIFIED);
+    for (size_t i = 0U; i < (sizeof(formats) / sizeof(formats[0])); ++i)
+    {
+        if ((jx_struct_to_json(jsonx_test_root, JSONX_TEST_ROOT_COUNT, whole, sizeof(whole), formats[i]) != JX_SUCCESS) ||
+            (test_ranges(whole, formats[i]) != 0))
+        {
+            return test_fail("columnar ranges");
+        }
+
+        memset(jsonx_test_records, 0, sizeof(jsonx_test_records));
+        jsonx_test_set.count = 0U;
+        if ((jx_json_to_struct(whole, jsonx_test_root, JSONX_TEST_ROOT_COUNT, JX_MODE_STRICT) != JX_SUCCESS) ||
+            (jsonx_test_set.count != JSONX_TEST_RECORDS) || (jsonx_test_records[9].id != 109U) ||
+            (jsonx_test_records[9].offset != -9) || (strcmp(jsonx_test_records[4].tag, "t4") != 0))
+        {
+            return test_fail("columnar parse");
+        }
+    }
+
+    (void)jx_struct_to_json(jsonx_test_root, JSONX_TEST_ROOT_COUNT, whole, sizeof(whole), formats[0]);
+    if ((strncmp(whole, "{\"version\":3,\"items\":{\"cols\":[\"id\",\"offset\",\"tag\"],"
+                        "\"rows\":[[100,0,\"t0\"],[101,-1,\"t1\"],", 72U) != 0) ||
+        (strlen(whole) >= ((strlen(row_form) * 3U) / 5U)))
+    {
+        return test_fail("columnar output");
+    }
+
+    /* Columns come in any order; unknown ones are skipped whatever their value. */
+    strcpy(input, "{\"items\":{ \"cols\" : [\"tag\", \"extra\", \"id\"] , \"rows\" : [ [\"x\", \"],[\", 7] , [\"y\",null,8] ] }}");
+    if ((jx_json_to_struct(input, jsonx_test_root, JSONX_TEST_ROOT_COUNT, JX_MODE_RELAXED) != JX_SUCCESS) ||
+        (jsonx_test_set.count != 2U) || (jsonx_test_records[0].id != 7U) ||
+        (strcmp(jsonx_test_records[1].tag, "y") != 0) ||
+        (jx_json_to_struct(input, jsonx_test_root, JSONX_TEST_ROOT_COUNT, JX_MODE_STRICT) != JX_ERROR))
+    {
+        return test_fail("columnar columns");
+    }
+
+    for (size_t i = 0U; i < (sizeof(invalid) / sizeof(invalid[0])); ++i)
+    {
+        strcpy(input, invalid[i]);
+        if (jx_json_to_struct(input, jsonx_test_root, JSONX_TEST_ROOT_COUNT, JX_MODE_RELAXED) != JX_ERROR)
+        {
+            return test_fail(invalid[i]);
+        }
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    char whole[JSONX_TEST_BUFFER_SIZE];
+    char part[JSONX_TEST_BUFFER_SIZE];
+    char overflow[] = "{\"items\":[{\"id\":1},{\"id\":2},{\"id\":3},{\"id\":4},{\"id\":5},"
+                      "{\"id\":6},{\"id\":7},{\"id\":8},{\"id\":9},{\"id\":10},{\"id\":11}]}";
+
+    test_fill();
+
+    if (jx_init(jsonx_test_pool, sizeof(jsonx_test_pool)) != JX_SUCCESS)
+    {
+        return test_fail("jx_init");
+    }
+
+    if ((jx_struct_to_json(jsonx_test_root, JSONX_TEST_ROOT_COUNT, whole, sizeof(whole), JX_MINIFIED) != JX_SUCCESS) ||
+        (strncmp(whole, "{\"version\":3,\"items\":[{\"id\":100,\"offset\":0,\"tag\":\"t0\"},{\"id\":101,", 65U) != 0))
+    {
+        jx_parser_deinit();
+        return test_fail("record array output");
+    }
+
+    if (test_ranges(whole, JX_MINIFIED) != 0)
+    {
+        jx_parser_deinit();
+        return 1;
+    }
+
+    if ((jx_struct_to_json(jsonx_test_root, JSONX_TEST_ROOT_COUNT, whole, sizeof(whole), JX_FORMATTED) != JX_SUCCESS) ||
+        (test_ranges(whole, JX_FORMATTED) != 0))
+    {
+        jx_parser_deinit();
+        return test_fail("formatted ranges");
+    }
+
+    if ((jx_struct_to_json_range(jsonx_test_root, JSONX_TEST_ROOT_COUNT, &jsonx_test_root[1],
+                                 8U, 3U, part, sizeof(part), JX_MINIFIED, NULL) != JX_ERROR) ||
+        (jx_struct_to_json_range(jsonx_test_root, JSONX_TEST_ROOT_COUNT, &jsonx_test_root[0],
+                                 0U, 1U, part, sizeof(part), JX_MINIFIED, NULL) != JX_ERROR))
+    {
+        jx_parser_deinit();
+        return test_fail("invalid range accepted");
+    }
+
+    /* Parsing fills consecutive records through the template. */
+    (void)jx_struct_to_json(jsonx_test_root, JSONX_TEST_ROOT_COUNT, whole, sizeof(whole), JX_MINIFIED);
+    memset(jsonx_test_records, 0, sizeof(jsonx_test_records));
+    jsonx_test_set.count = 0U;
+    if ((jx_json_to_struct(whole, jsonx_test_root, JSONX_TEST_ROOT_COUNT, JX_MODE_STRICT) != JX_SUCCESS) ||
+        (jsonx_test_set.count != JSONX_TEST_RECORDS) ||
+        (jsonx_test_records[9].id != 109U) ||
+        (jsonx_test_records[9].offset != -9) ||
+        (strcmp(jsonx_test_records[4].tag, "t4") != 0))
+    {
+        jx_parser_deinit();
+        return test_fail("record array parse");
+    }
+
+    if (jx_json_to_struct(overflow, jsonx_test_root, JSONX_TEST_ROOT_COUNT, JX_MODE_RELAXED) != JX_ERROR)
+    {
+        jx_parser_deinit();
+        return test_fail("record capacity overflow accepted");
+    }
+
+    if ((test_split() != 0) || (test_columns() != 0))
+    {
+        jx_parser_deinit();
+        return 1;
+    }
+
+    jx_parser_deinit();
+    return 0;
+}
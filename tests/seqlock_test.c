@@ -0,0 +1,141 @@
+#include "jx_api.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_SNAPSHOTS       5000U
+#define JSONX_TEST_BUFFER_SIZE     160U
+
+typedef struct
+{
+    uint32_t counter;
+    uint32_t inverse;
+    uint64_t tripled;
+    char     label[12];
+} JsonX_TestStatus;
+
+static JsonX_TestStatus jsonx_test_status;
+static JX_SEQUENCE jsonx_test_sequence = JX_SEQUENCE_INIT;
+static volatile int jsonx_test_done;
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX seqlock test failed: %s\n", message);
+    return 1;
+}
+
+/* Control task: updates never wait for the serializer. */
+static void *jsonx_test_writer(void *argument)
+{
+    uint32_t counter = 0U;
+
+    (void)argument;
+
+    while (!jsonx_test_done)
+    {
+        counter++;
+        jx_seqlock_write_begin(&jsonx_test_sequence);
+        jsonx_test_status.counter = counter;
+        jsonx_test_status.inverse = ~counter;
+        jsonx_test_status.tripled = (uint64_t)counter * 3U;
+        snprintf(jsonx_test_status.label, sizeof(jsonx_test_status.label), "n%lu", (unsigned long)counter);
+        jx_seqlock_write_end(&jsonx_test_sequence);
+
+        if ((counter % 64U) == 0U)
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    JX_ELEMENT root[] =
+    {
+        JX_PROPERTY_U32("counter", jsonx_test_status.counter),
+        JX_PROPERTY_U32("inverse", jsonx_test_status.inverse),
+        JX_PROPERTY_U64("tripled", jsonx_test_status.tripled),
+        JX_PROPERTY_STRING_BUFFER("label", jsonx_test_status.label)
+    };
+    JsonX_TestStatus copy;
+    JX_ELEMENT check[] =
+    {
+        JX_PROPERTY_U32("counter", copy.counter),
+        JX_PROPERTY_U32("inverse", copy.inverse),
+        JX_PROPERTY_U64("tripled", copy.tripled),
+        JX_PROPERTY_STRING_BUFFER("label", copy.label)
+    };
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    uint64_t staging[4];
+    char json[JSONX_TEST_BUFFER_SIZE];
+    char expected[sizeof(copy.label)];
+    JX_SEQUENCE busy = 1U;
+    pthread_t writer;
+    unsigned long consistent = 0UL;
+
+    /* Two u32, one aligned u64 and the 12-byte label. */
+    if (jx_struct_snapshot_size(root, 4U) != 28U)
+    {
+        return test_fail("snapshot size");
+    }
+
+    if ((jx_struct_to_json_consistent(&busy, root, 4U, staging, sizeof(staging),
+                                      json, sizeof(json), JX_MINIFIED) != JX_ERROR) ||
+        (jx_struct_to_json_consistent(&jsonx_test_sequence, root, 4U, staging, 16U,
+                                      json, sizeof(json), JX_MINIFIED) != JX_ERROR))
+    {
+        return test_fail("unstable or undersized snapshot accepted");
+    }
+
+    if (pthread_create(&writer, NULL, jsonx_test_writer, NULL) != 0)
+    {
+        return test_fail("pthread_create");
+    }
+
+    for (uint32_t i = 0U; i < JSONX_TEST_SNAPSHOTS; ++i)
+    {
+        if (jx_struct_to_json_consistent(&jsonx_test_sequence, root, 4U, staging, sizeof(staging),
+                                         json, sizeof(json), JX_MINIFIED) != JX_SUCCESS)
+        {
+            sched_yield();
+            continue;
+        }
+
+        memset(&copy, 0, sizeof(copy));
+        if (jx_context_json_to_struct(&context, json, check, 4U, JX_MODE_STRICT) != JX_SUCCESS)
+        {
+            jsonx_test_done = 1;
+            pthread_join(writer, NULL);
+            return test_fail("snapshot output does not parse");
+        }
+
+        snprintf(expected, sizeof(expected), "n%lu", (unsigned long)copy.counter);
+        if ((copy.counter != 0U) &&
+            ((copy.inverse != ~copy.counter) ||
+             (copy.tripled != ((uint64_t)copy.counter * 3U)) ||
+             (strcmp(copy.label, expected) != 0)))
+        {
+            jsonx_test_done = 1;
+            pthread_join(writer, NULL);
+            return test_fail("torn snapshot");
+        }
+
+        consistent++;
+        sched_yield();
+    }
+
+    jsonx_test_done = 1;
+    pthread_join(writer, NULL);
+
+    if (consistent == 0UL)
+    {
+        return test_fail("no snapshot succeeded");
+    }
+
+    return 0;
+}
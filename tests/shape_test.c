@@ -0,0 +1,259 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_BUFFER_SIZE     256U
+#define JSONX_TEST_RECORDS           3U
+#define JSONX_TEST_SLOTS            32U
+
+typedef struct
+{
+    uint32_t id;
+    char     tag[8];
+} JsonX_TestRecord;
+
+typedef struct
+{
+    uint32_t         id;
+    char             name[16];
+    uint32_t         limits[2];
+    JsonX_TestRecord records[JSONX_TEST_RECORDS];
+} JsonX_TestValues;
+
+/* Everything a parse leaves behind: values, counts and element status. */
+typedef struct
+{
+    JX_STATUS        status;
+    JsonX_TestValues values;
+    size_t           record_count;
+    uint8_t          limit_count;
+    JX_ELEMENT_STATUS element_status[8];
+} JsonX_TestResult;
+
+static JsonX_TestValues jsonx_test_values;
+static JX_RECORDS jsonx_test_set = JX_RECORDS_INIT(jsonx_test_values.records, 0U);
+
+static JX_ELEMENT jsonx_test_limit_items[] =
+{
+    JX_U32_VAL(jsonx_test_values.limits[0]),
+    JX_U32_VAL(jsonx_test_values.limits[1])
+};
+
+static JX_ELEMENT jsonx_test_template[] =
+{
+    JX_PROPERTY_U32("id", jsonx_test_values.records[0].id),
+    JX_PROPERTY_STRING_BUFFER("tag", jsonx_test_values.records[0].tag)
+};
+
+static JX_ELEMENT jsonx_test_root[] =
+{
+    JX_PROPERTY_U32("id", jsonx_test_values.id),
+    JX_PROPERTY_STRING_BUFFER("name", jsonx_test_values.name),
+    JX_PROPERTY_ARRAY("limits", jsonx_test_limit_items),
+    JX_PROPERTY_RECORD_ARRAY("items", jsonx_test_set, jsonx_test_template)
+};
+
+#define JSONX_TEST_ROOT_COUNT (sizeof(jsonx_test_root) / sizeof(jsonx_test_root[0]))
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX shape test failed: %s\n", message);
+    return 1;
+}
+
+static void test_clear(void)
+{
+    memset(&jsonx_test_values, 0, sizeof(jsonx_test_values));
+    jsonx_test_set.count = 0U;
+    jsonx_test_root[2].value_len = 2U;
+    for (size_t i = 0U; i < JSONX_TEST_ROOT_COUNT; ++i)
+    {
+        jsonx_test_root[i].status = JX_ELEMENT_NOT_UPDATED;
+    }
+    jsonx_test_limit_items[0].status = JX_ELEMENT_NOT_UPDATED;
+    jsonx_test_limit_items[1].status = JX_ELEMENT_NOT_UPDATED;
+    jsonx_test_template[0].status = JX_ELEMENT_NOT_UPDATED;
+    jsonx_test_template[1].status = JX_ELEMENT_NOT_UPDATED;
+}
+
+static void test_capture(JX_STATUS status, JsonX_TestResult *result)
+{
+    memset(result, 0, sizeof(*result));
+    result->status = status;
+    result->values = jsonx_test_values;
+    result->record_count = jsonx_test_set.count;
+    result->limit_count = jsonx_test_root[2].value_len;
+    for (size_t i = 0U; i < JSONX_TEST_ROOT_COUNT; ++i)
+    {
+        result->element_status[i] = jsonx_test_root[i].status;
+    }
+    result->element_status[4] = jsonx_test_limit_items[0].status;
+    result->element_status[5] = jsonx_test_limit_items[1].status;
+    result->element_status[6] = jsonx_test_template[0].status;
+    result->element_status[7] = jsonx_test_template[1].status;
+}
+
+/* A shaped parse must leave exactly what a plain parse leaves. */
+static bool test_same(JX_CONTEXT *context, JX_SHAPE *shape, const char *json, JX_PARSE_MODE mode)
+{
+    char input[JSONX_TEST_BUFFER_SIZE];
+    JsonX_TestResult plain;
+    JsonX_TestResult shaped;
+
+    test_clear();
+    strcpy(input, json);
+    test_capture(jx_context_json_to_struct(context, input, jsonx_test_root, JSONX_TEST_ROOT_COUNT, mode), &plain);
+
+    test_clear();
+    strcpy(input, json);
+    test_capture(jx_context_json_to_struct_shaped(context, shape, input, jsonx_test_root,
+                                                  JSONX_TEST_ROOT_COUNT, mode), &shaped);
+
+    return memcmp(&plain, &shaped, sizeof(plain)) == 0;
+}
+
+static int test_sequence(JX_CONTEXT *context, JX_SHAPE *shape)
+{
+    static const char *const documents[] =
+    {
+        "{\"id\":7,\"name\":\"pump\",\"limits\":[10,20],\"note\":{\"a\":[1]},"
+        "\"items\":[{\"id\":1,\"tag\":\"a\"},{\"id\":2,\"tag\":\"b\"}]}",
+        /* Same layout, other values: replayed. */
+        "{\"id\":812,\"name\":\"p\\u00fcmp \\\"2\\\"\",\"limits\":[3,4],\"note\":{\"b\":[]},"
+        "\"items\":[{\"id\":41,\"tag\":\"x\"},{\"id\":42,\"tag\":\"yz\"}]}",
+        /* A value of another kind: cleared in relaxed mode. */
+        "{\"id\":\"text\",\"name\":\"pump\",\"limits\":[10,20],\"note\":{\"a\":[1]},"
+        "\"items\":[{\"id\":1,\"tag\":\"a\"},{\"id\":2,\"tag\":\"b\"}]}",
+        "{\"id\":7,\"name\":{\"x\":1},\"limits\":[10,20],\"note\":{\"a\":[1]},"
+        "\"items\":[{\"id\":1,\"tag\":\"a\"},{\"id\":2,\"tag\":\"b\"}]}",
+        /* Another layout: recorded again. */
+        "{\"items\":[{\"id\":5,\"tag\":\"c\"}], \"limits\":[9],\"id\":1}",
+        "{\"items\":[{\"id\":6,\"tag\":\"d\"}], \"limits\":[8],\"id\":2}",
+        /* Broken or trailing bytes after a matching prefix. */
+        "{\"items\":[{\"id\":6,\"tag\":\"d\"}], \"limits\":[8],\"id\":2} x",
+        "{\"items\":[{\"id\":6,\"tag\":\"d\"}], \"limits\":[8],\"id\":2x}",
+        "{\"items\":[{\"id\":6,\"tag\":\"d\"}], \"limits\":[8],\"id\":",
+        "{\"items\":[{\"id\":6,\"tag\":\"d\"}], \"limits\":[8],\"id\":3}\n"
+    };
+
+    for (size_t i = 0U; i < (sizeof(documents) / sizeof(documents[0])); ++i)
+    {
+        if (!test_same(context, shape, documents[i], JX_MODE_RELAXED))
+        {
+            return test_fail(documents[i]);
+        }
+    }
+
+    /* Values of another kind still match the layout; trailing bytes do not. */
+    if (!shape->valid || (shape->hits != 4U) || (shape->misses != 6U))
+    {
+        return test_fail("hit counters");
+    }
+
+    return 0;
+}
+
+static int test_replay(JX_CONTEXT *context, JX_SHAPE *shape)
+{
+    char input[JSONX_TEST_BUFFER_SIZE];
+    uint32_t hits;
+
+    jx_shape_reset(shape);
+    strcpy(input, "{\"id\":1,\"limits\":[1,2],\"items\":[{\"id\":1,\"tag\":\"a\"},{\"id\":2,\"tag\":\"b\"}]}");
+    if ((jx_context_json_to_struct_shaped(context, shape, input, jsonx_test_root, JSONX_TEST_ROOT_COUNT,
+                                          JX_MODE_RELAXED) != JX_SUCCESS) || !shape->valid)
+    {
+        return test_fail("record");
+    }
+
+    hits = shape->hits;
+    strcpy(input, "{\"id\":9,\"limits\":[5,6],\"items\":[{\"id\":7,\"tag\":\"q\"},{\"id\":8,\"tag\":\"r\"}]}");
+    if ((jx_context_json_to_struct_shaped(context, shape, input, jsonx_test_root, JSONX_TEST_ROOT_COUNT,
+                                          JX_MODE_RELAXED) != JX_SUCCESS) || (shape->hits != (hits + 1U)))
+    {
+        return test_fail("replay");
+    }
+
+    /* Record members land in their own record, not the template's. */
+    if ((jsonx_test_values.id != 9U) || (jsonx_test_values.limits[1] != 6U) || (jsonx_test_set.count != 2U) ||
+        (jsonx_test_values.records[0].id != 7U) || (strcmp(jsonx_test_values.records[1].tag, "r") != 0) ||
+        (jsonx_test_values.records[1].id != 8U))
+    {
+        return test_fail("replayed values");
+    }
+
+    /* Another value kind keeps the layout; relaxed mode leaves the member unmarked. */
+    strcpy(input, "{\"id\":\"x\",\"limits\":[5,6],\"items\":[{\"id\":7,\"tag\":\"q\"},{\"id\":8,\"tag\":\"r\"}]}");
+    if ((jx_context_json_to_struct_shaped(context, shape, input, jsonx_test_root, JSONX_TEST_ROOT_COUNT,
+                                          JX_MODE_RELAXED) != JX_SUCCESS) || (shape->hits != (hits + 2U)) ||
+        (jsonx_test_values.id != 9U) || (jsonx_test_root[0].status == JX_ELEMENT_UPDATED))
+    {
+        return test_fail("value kind replay");
+    }
+
+    /* Another mode records again. */
+    if ((jx_context_json_to_struct_shaped(context, shape, input, jsonx_test_root, JSONX_TEST_ROOT_COUNT,
+                                          JX_MODE_TRUSTED) != JX_SUCCESS) || (shape->hits != (hits + 2U)) ||
+        (shape->mode != JX_MODE_TRUSTED))
+    {
+        return test_fail("mode change");
+    }
+
+    return 0;
+}
+
+/* A layout that does not fit is parsed in full every time. */
+static int test_small(JX_CONTEXT *context)
+{
+    char skeleton[16];
+    JX_SHAPE_SLOT slots[2];
+    JX_SHAPE shape;
+
+    if (jx_shape_init(&shape, skeleton, sizeof(skeleton), slots, 2U) != JX_SUCCESS)
+    {
+        return test_fail("jx_shape_init");
+    }
+
+    for (size_t i = 0U; i < 3U; ++i)
+    {
+        if (!test_same(context, &shape, "{\"id\":3,\"name\":\"long enough\",\"limits\":[1,2]}", JX_MODE_STRICT) ||
+            shape.valid || (shape.hits != 0U))
+        {
+            return test_fail("small shape");
+        }
+    }
+
+    if ((jx_shape_init(NULL, skeleton, sizeof(skeleton), slots, 2U) != JX_ERROR) ||
+        (jx_shape_init(&shape, skeleton, 0U, slots, 2U) != JX_ERROR) ||
+        (jx_shape_init(&shape, skeleton, sizeof(skeleton), NULL, 2U) != JX_ERROR) ||
+        (jx_context_json_to_struct_shaped(context, &shape, NULL, jsonx_test_root,
+                                          JSONX_TEST_ROOT_COUNT, JX_MODE_RELAXED) != JX_ERROR))
+    {
+        return test_fail("invalid arguments accepted");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    static char skeleton[JSONX_TEST_BUFFER_SIZE];
+    static JX_SHAPE_SLOT slots[JSONX_TEST_SLOTS];
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    JX_SHAPE shape;
+
+    if (jx_shape_init(&shape, skeleton, sizeof(skeleton), slots, JSONX_TEST_SLOTS) != JX_SUCCESS)
+    {
+        return test_fail("jx_shape_init");
+    }
+
+    if ((test_sequence(&context, &shape) != 0) || (test_replay(&context, &shape) != 0) ||
+        (test_small(&context) != 0))
+    {
+        return 1;
+    }
+
+    return 0;
+}
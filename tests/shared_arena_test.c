@@ -0,0 +1,159 @@
+#include "jx_api.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define JSONX_TEST_WORKERS            4U
+#define JSONX_TEST_POOL_SIZE      16384U
+#define JSONX_TEST_MAX_BLOCKS      4096U
+
+typedef struct
+{
+    uint8_t *start;
+    size_t   size;
+} JsonX_TestBlock;
+
+typedef struct
+{
+    size_t          seed;
+    size_t          count;
+    size_t          bytes;
+    JsonX_TestBlock blocks[JSONX_TEST_MAX_BLOCKS];
+} JsonX_TestWorker;
+
+static uint32_t jsonx_test_storage[JSONX_TEST_POOL_SIZE / sizeof(uint32_t)];
+static JX_ARENA jsonx_test_arena;
+static JsonX_TestWorker jsonx_test_workers[JSONX_TEST_WORKERS];
+static JsonX_TestBlock jsonx_test_all[JSONX_TEST_WORKERS * JSONX_TEST_MAX_BLOCKS];
+static int jsonx_test_start;
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX shared arena test failed: %s\n", message);
+    return 1;
+}
+
+/* Allocates varied sizes until the pool is full, then fills what is left with 4-byte blocks. */
+static void *jsonx_test_worker(void *argument)
+{
+    JsonX_TestWorker *worker = argument;
+    bool full = false;
+
+    while (__atomic_load_n(&jsonx_test_start, __ATOMIC_ACQUIRE) == 0)
+    {
+    }
+
+    while (worker->count < JSONX_TEST_MAX_BLOCKS)
+    {
+        size_t size = full ? 4U : (4U * (((worker->seed + worker->count) % 5U) + 1U));
+        uint8_t *block = jx_arena_alloc(&jsonx_test_arena, size);
+
+        if (block == NULL)
+        {
+            if (full)
+            {
+                break;
+            }
+            full = true;
+            continue;
+        }
+
+        /* Writing the whole block makes overlaps visible to sanitizers too. */
+        memset(block, (int)worker->seed, size);
+        worker->blocks[worker->count].start = block;
+        worker->blocks[worker->count].size = size;
+        worker->count++;
+        worker->bytes += size;
+    }
+
+    return NULL;
+}
+
+static int test_compare_blocks(const void *left, const void *right)
+{
+    const uint8_t *a = ((const JsonX_TestBlock *)left)->start;
+    const uint8_t *b = ((const JsonX_TestBlock *)right)->start;
+
+    return (a < b) ? -1 : ((a > b) ? 1 : 0);
+}
+
+int main(void)
+{
+    pthread_t threads[JSONX_TEST_WORKERS];
+    size_t total = 0U;
+    size_t bytes = 0U;
+    JX_ARENA_MARK mark;
+
+    if (jx_arena_init_shared(&jsonx_test_arena, jsonx_test_storage, sizeof(jsonx_test_storage)) != JX_SUCCESS)
+    {
+        return test_fail("jx_arena_init_shared");
+    }
+
+    for (size_t i = 0U; i < JSONX_TEST_WORKERS; ++i)
+    {
+        jsonx_test_workers[i].seed = i;
+        if (pthread_create(&threads[i], NULL, jsonx_test_worker, &jsonx_test_workers[i]) != 0)
+        {
+            return test_fail("pthread_create");
+        }
+    }
+
+    __atomic_store_n(&jsonx_test_start, 1, __ATOMIC_RELEASE);
+    for (size_t i = 0U; i < JSONX_TEST_WORKERS; ++i)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (size_t i = 0U; i < JSONX_TEST_WORKERS; ++i)
+    {
+        memcpy(&jsonx_test_all[total], jsonx_test_workers[i].blocks,
+               jsonx_test_workers[i].count * sizeof(JsonX_TestBlock));
+        total += jsonx_test_workers[i].count;
+        bytes += jsonx_test_workers[i].bytes;
+    }
+
+    /* Every byte went to exactly one block. */
+    if ((bytes != jx_arena_used(&jsonx_test_arena)) || (bytes != sizeof(jsonx_test_storage)))
+    {
+        return test_fail("final offset");
+    }
+
+    qsort(jsonx_test_all, total, sizeof(JsonX_TestBlock), test_compare_blocks);
+    for (size_t i = 0U; i < total; ++i)
+    {
+        const JsonX_TestBlock *block = &jsonx_test_all[i];
+
+        if ((block->start < (uint8_t *)jsonx_test_storage) ||
+            ((block->start + block->size) > ((uint8_t *)jsonx_test_storage + sizeof(jsonx_test_storage))) ||
+            ((i + 1U < total) && ((block->start + block->size) > jsonx_test_all[i + 1U].start)))
+        {
+            return test_fail("overlapping blocks");
+        }
+    }
+
+    /* An exhausted pool fails cleanly and keeps its offset. */
+    if ((jx_arena_alloc(&jsonx_test_arena, 4U) != NULL) ||
+        (jx_arena_used(&jsonx_test_arena) != sizeof(jsonx_test_storage)))
+    {
+        return test_fail("exhausted pool");
+    }
+
+    /* Other threads may hold memory above a mark, so release leaves a shared arena alone. */
+    jx_arena_reset(&jsonx_test_arena);
+    mark = jx_arena_mark(&jsonx_test_arena);
+    if (jx_arena_alloc(&jsonx_test_arena, 8U) == NULL)
+    {
+        return test_fail("allocation after reset");
+    }
+
+    jx_arena_release(&jsonx_test_arena, mark);
+    if (jx_arena_used(&jsonx_test_arena) != 8U)
+    {
+        return test_fail("shared release");
+    }
+
+    return 0;
+}
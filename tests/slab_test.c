@@ -0,0 +1,246 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_POOL_SIZE      4096U
+#define JSONX_TEST_BUFFER_SIZE     128U
+#define JSONX_TEST_LARGE_SIZE     ((JX_SLAB_MIN_BLOCK_SIZE << JX_SLAB_CLASS_COUNT) + 4U)
+
+static uint32_t jsonx_test_pool[JSONX_TEST_POOL_SIZE / sizeof(uint32_t)];
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX slab test failed: %s\n", message);
+    jx_parser_deinit();
+    return 1;
+}
+
+/* Each test starts from an empty pool. */
+static bool test_init(JX_ALLOCATOR_STATS *stats)
+{
+    jx_parser_deinit();
+    return (jx_init(jsonx_test_pool, sizeof(jsonx_test_pool)) == JX_SUCCESS) &&
+           (jx_get_allocator_stats(stats) == JX_SUCCESS);
+}
+
+static int test_reuse(void)
+{
+    JX_ALLOCATOR_STATS before;
+    JX_ALLOCATOR_STATS after;
+
+    if (!test_init(&before))
+    {
+        return test_fail("jx_init");
+    }
+
+    for (size_t class_index = 0U; class_index < JX_SLAB_CLASS_COUNT; ++class_index)
+    {
+        size_t block_size = (size_t)JX_SLAB_MIN_BLOCK_SIZE << class_index;
+        uint8_t *first = jx_alloc_memory(block_size);
+        uint8_t *second;
+
+        if (first == NULL)
+        {
+            return test_fail("class allocation");
+        }
+
+        /* A smaller request of the same class takes the freed block back. */
+        jx_free_memory(first);
+        second = jx_alloc_memory((block_size / 2U) + 4U);
+        if (second != first)
+        {
+            return test_fail("free-list reuse");
+        }
+        jx_free_memory(second);
+    }
+
+    /* Reuse carved nothing beyond one block per class. */
+    if ((jx_get_allocator_stats(&after) != JX_SUCCESS) ||
+        (after.carved_bytes != (before.carved_bytes +
+                                (4U * JX_SLAB_CLASS_COUNT) +
+                                ((size_t)JX_SLAB_MIN_BLOCK_SIZE * ((1U << JX_SLAB_CLASS_COUNT) - 1U)))) ||
+        (after.live_allocations != before.live_allocations))
+    {
+        return test_fail("carved bytes after reuse");
+    }
+
+    return 0;
+}
+
+static int test_double_free(void)
+{
+    JX_ALLOCATOR_STATS before;
+    JX_ALLOCATOR_STATS after;
+    uint8_t *block;
+    uint8_t *first;
+    uint8_t *second;
+
+    if (!test_init(&before))
+    {
+        return test_fail("jx_init");
+    }
+
+    block = jx_alloc_memory(20U);
+    jx_free_memory(block);
+    jx_free_memory(block);
+    if ((block == NULL) || (jx_get_allocator_stats(&after) != JX_SUCCESS) ||
+        (after.live_allocations != before.live_allocations) ||
+        (after.live_bytes != before.live_bytes) ||
+        (after.free_list_bytes != (before.free_list_bytes + 32U)))
+    {
+        return test_fail("double free counted twice");
+    }
+
+    /* The block sits in its free list once, so it is handed out once. */
+    first = jx_alloc_memory(20U);
+    second = jx_alloc_memory(20U);
+    if ((first != block) || (second == NULL) || (second == block))
+    {
+        return test_fail("double free corrupted the free list");
+    }
+
+    return 0;
+}
+
+static int test_large_tail(void)
+{
+    JX_ALLOCATOR_STATS before;
+    JX_ALLOCATOR_STATS stats;
+    uint8_t *large;
+    uint8_t *small;
+
+    if (!test_init(&before))
+    {
+        return test_fail("jx_init");
+    }
+
+    large = jx_alloc_memory(JSONX_TEST_LARGE_SIZE);
+    if ((large == NULL) || (jx_get_allocator_stats(&stats) != JX_SUCCESS) ||
+        (stats.carved_bytes != (before.carved_bytes + 4U + JSONX_TEST_LARGE_SIZE)))
+    {
+        return test_fail("large allocation");
+    }
+
+    jx_free_memory(large);
+    if ((jx_get_allocator_stats(&stats) != JX_SUCCESS) ||
+        (stats.carved_bytes != before.carved_bytes) ||
+        (stats.live_allocations != before.live_allocations))
+    {
+        return test_fail("tail large block not reclaimed");
+    }
+
+    /* Behind another carve, a large block stays carved. */
+    large = jx_alloc_memory(JSONX_TEST_LARGE_SIZE);
+    small = jx_alloc_memory(4U);
+    jx_free_memory(large);
+    if ((large == NULL) || (small == NULL) || (jx_get_allocator_stats(&stats) != JX_SUCCESS) ||
+        (stats.carved_bytes != (before.carved_bytes + 4U + JSONX_TEST_LARGE_SIZE + 4U + JX_SLAB_MIN_BLOCK_SIZE)))
+    {
+        return test_fail("inner large block reclaimed");
+    }
+
+    return 0;
+}
+
+static int test_stats(void)
+{
+    JX_ALLOCATOR_STATS before;
+    JX_ALLOCATOR_STATS stats;
+    uint8_t *a;
+    uint8_t *b;
+    uint8_t *c;
+
+    if (!test_init(&before))
+    {
+        return test_fail("jx_init");
+    }
+
+    /* Requests are rounded to 4 bytes: 12 in 16, 100 in 128, 24 in 32. */
+    a = jx_alloc_memory(10U);
+    b = jx_alloc_memory(100U);
+    c = jx_alloc_memory(24U);
+    jx_free_memory(b);
+    if ((a == NULL) || (b == NULL) || (c == NULL) ||
+        (jx_alloc_memory(JSONX_TEST_POOL_SIZE) != NULL) ||
+        (jx_get_allocator_stats(&stats) != JX_SUCCESS))
+    {
+        return test_fail("mixed sequence");
+    }
+
+    if ((stats.pool_size != before.pool_size) ||
+        (stats.carved_bytes != (before.carved_bytes + 20U + 132U + 36U)) ||
+        (stats.live_bytes != (before.live_bytes + 36U)) ||
+        (stats.live_block_bytes != (before.live_block_bytes + 48U)) ||
+        (stats.free_list_bytes != (before.free_list_bytes + 128U)) ||
+        (stats.live_allocations != (before.live_allocations + 2U)) ||
+        (stats.failed_allocations != (before.failed_allocations + 1U)))
+    {
+        return test_fail("allocator stats");
+    }
+
+    return 0;
+}
+
+/* Conversions free their own blocks, so caller blocks survive them. */
+static int test_conversion(void)
+{
+    JX_ALLOCATOR_STATS before;
+    JX_ALLOCATOR_STATS after;
+    char json_buffer[JSONX_TEST_BUFFER_SIZE];
+    uint32_t value = 7U;
+    uint8_t *kept;
+    uint8_t *next;
+
+    JX_ELEMENT root[] =
+    {
+        JX_PROPERTY_U32("value", value)
+    };
+
+    if (!test_init(&before))
+    {
+        return test_fail("jx_init");
+    }
+
+    kept = jx_alloc_memory(32U);
+    if ((kept == NULL) || (jx_get_allocator_stats(&before) != JX_SUCCESS))
+    {
+        return test_fail("caller block");
+    }
+    memset(kept, 0xA5, 32U);
+
+    if ((jx_struct_to_json(root, 1U, json_buffer, sizeof(json_buffer), JX_MINIFIED) != JX_SUCCESS) ||
+        (jx_json_to_struct(json_buffer, root, 1U, JX_MODE_STRICT) != JX_SUCCESS) ||
+        (jx_get_allocator_stats(&after) != JX_SUCCESS))
+    {
+        return test_fail("conversion");
+    }
+
+    if ((after.live_allocations != before.live_allocations) ||
+        (after.live_bytes != before.live_bytes) ||
+        (kept[0] != 0xA5U) || (kept[31] != 0xA5U))
+    {
+        return test_fail("conversion released caller memory");
+    }
+
+    next = jx_alloc_memory(32U);
+    if ((next == NULL) || (next == kept))
+    {
+        return test_fail("caller block handed out again");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    if ((test_reuse() != 0) || (test_double_free() != 0) || (test_large_tail() != 0) ||
+        (test_stats() != 0) || (test_conversion() != 0))
+    {
+        return 1;
+    }
+
+    jx_parser_deinit();
+    return 0;
+}
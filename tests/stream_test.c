@@ -0,0 +1,151 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_POOL_SIZE      2048U
+#define JSONX_TEST_BUFFER_SIZE     256U
+#define JSONX_TEST_CHUNK_SIZE        7U
+
+typedef struct
+{
+    char name[32];
+    uint32_t position[2];
+    uint32_t enabled;
+} JsonX_TestModel;
+
+typedef struct
+{
+    char data[JSONX_TEST_BUFFER_SIZE];
+    size_t length;
+    size_t calls;
+} JsonX_TestSink;
+
+static unsigned char jsonx_test_pool[JSONX_TEST_POOL_SIZE];
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX stream test failed: %s\n", message);
+    jx_parser_deinit();
+    return 1;
+}
+
+static bool test_sink(void *context, const char *data, size_t length)
+{
+    JsonX_TestSink *sink = (JsonX_TestSink *)context;
+
+    if ((sink->length + length) >= sizeof(sink->data))
+    {
+        return false;
+    }
+
+    memcpy(&sink->data[sink->length], data, length);
+    sink->length += length;
+    sink->data[sink->length] = '\0';
+    sink->calls++;
+    return true;
+}
+
+int main(void)
+{
+    static const char pipelined[] =
+        "{\"name\":\"Eve \\\"}\",\"position\":[56,78],\"enabled\":0}"
+        "{\"name\":\"Bob\",\"position\":[1,2],\"enabled\":1}";
+    JsonX_TestModel model;
+    JsonX_TestSink sink;
+    char json_buffer[JSONX_TEST_BUFFER_SIZE];
+    char chunk[JSONX_TEST_CHUNK_SIZE];
+    char stream_buffer[JSONX_TEST_BUFFER_SIZE];
+    JX_STREAM stream;
+    size_t offset = 0U;
+    size_t documents = 0U;
+
+    memset(&model, 0, sizeof(model));
+    strncpy(model.name, "Adam", sizeof(model.name) - 1U);
+    model.position[0] = 12U;
+    model.position[1] = 34U;
+    model.enabled = 1U;
+
+    JX_PROPERTY_U32_ARRAY_2(position_array, model.position);
+
+    JX_ELEMENT root[] =
+    {
+        JX_PROPERTY_STRING_BUFFER("name", model.name),
+        JX_PROPERTY_ARRAY("position", position_array),
+        JX_PROPERTY_U32("enabled", model.enabled)
+    };
+    const size_t root_size = sizeof(root) / sizeof(root[0]);
+
+    if (jx_init(jsonx_test_pool, sizeof(jsonx_test_pool)) != JX_SUCCESS)
+    {
+        return test_fail("jx_init");
+    }
+
+    /* Chunked output must match the single-buffer writer byte for byte. */
+    if (jx_struct_to_json(root, root_size, json_buffer, sizeof(json_buffer), JX_FORMATTED) != JX_SUCCESS)
+    {
+        return test_fail("jx_struct_to_json");
+    }
+
+    memset(&sink, 0, sizeof(sink));
+    if (jx_struct_to_json_chunked(root, root_size, chunk, sizeof(chunk),
+                                  JX_FORMATTED, test_sink, &sink) != JX_SUCCESS)
+    {
+        return test_fail("jx_struct_to_json_chunked");
+    }
+
+    if ((strcmp(sink.data, json_buffer) != 0) || (sink.calls < 2U))
+    {
+        return test_fail("chunked output mismatch");
+    }
+
+    /* Feed two pipelined documents one byte at a time. */
+    if (jx_stream_init(&stream, stream_buffer, sizeof(stream_buffer)) != JX_SUCCESS)
+    {
+        return test_fail("jx_stream_init");
+    }
+
+    while (offset < (sizeof(pipelined) - 1U))
+    {
+        size_t consumed;
+
+        if (jx_stream_feed(&stream, &pipelined[offset], 1U, &consumed) != JX_SUCCESS)
+        {
+            return test_fail("jx_stream_feed");
+        }
+        offset += consumed;
+
+        if (jx_stream_is_complete(&stream))
+        {
+            if (jx_stream_parse(&stream, root, root_size, JX_MODE_STRICT) != JX_SUCCESS)
+            {
+                return test_fail("jx_stream_parse");
+            }
+
+            documents++;
+            if ((documents == 1U) &&
+                ((strcmp(model.name, "Eve \"}") != 0) || (model.position[1] != 78U) ||
+                 (model.enabled != 0U)))
+            {
+                return test_fail("first document mismatch");
+            }
+        }
+    }
+
+    if ((documents != 2U) || (strcmp(model.name, "Bob") != 0) ||
+        (model.position[0] != 1U) || (model.enabled != 1U))
+    {
+        return test_fail("second document mismatch");
+    }
+
+    /* A document that does not fit must be rejected, not truncated. */
+    if ((jx_stream_init(&stream, stream_buffer, 8U) != JX_SUCCESS) ||
+        (jx_stream_feed(&stream, pipelined, sizeof(pipelined) - 1U, NULL) != JX_ERROR))
+    {
+        return test_fail("stream overflow accepted");
+    }
+
+    jx_parser_deinit();
+    return 0;
+}
@@ -0,0 +1,260 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_TEXT_SIZE      2048U
+#define JSONX_TEST_JSON_SIZE      8192U
+#define JSONX_TEST_PULL_SIZE         5U
+
+typedef struct
+{
+    char   data[JSONX_TEST_TEXT_SIZE];
+    size_t length;
+    size_t calls;
+    bool   valid;
+    bool   refuse;
+} JsonX_TestSink;
+
+typedef struct
+{
+    const char *data;
+    size_t      length;
+    size_t      pos;
+    bool        fail;
+} JsonX_TestSource;
+
+static JsonX_TestSink jsonx_test_sink;
+static JsonX_TestSource jsonx_test_source;
+static JX_STRING_STREAM jsonx_test_stream;
+static uint32_t jsonx_test_id;
+static char jsonx_test_text[JSONX_TEST_TEXT_SIZE];
+
+static JX_ELEMENT jsonx_test_root[] =
+{
+    JX_PROPERTY_U32("id", jsonx_test_id),
+    JX_PROPERTY_STRING_STREAM("body", jsonx_test_stream)
+};
+
+/* The same document with the string held in memory; too long for a parse buffer. */
+static JX_ELEMENT jsonx_test_buffered[] =
+{
+    JX_PROPERTY_U32("id", jsonx_test_id),
+    { .property = "body", .type = JX_STRING, .value_p = jsonx_test_text }
+};
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX string stream test failed: %s\n", message);
+    return 1;
+}
+
+static bool test_sink(void *context, const char *data, size_t length)
+{
+    JsonX_TestSink *sink = (JsonX_TestSink *)context;
+
+    if (sink->refuse || ((sink->length + length) >= sizeof(sink->data)))
+    {
+        return false;
+    }
+
+    /* Every chunk must stand alone as UTF-8. */
+    sink->valid = sink->valid && (length <= JX_STRING_STREAM_CHUNK) && jx_utf8_validate(data, length);
+    memcpy(&sink->data[sink->length], data, length);
+    sink->length += length;
+    sink->data[sink->length] = '\0';
+    sink->calls++;
+    return true;
+}
+
+/* Hands out a few bytes per pull, cutting multi-byte sequences. */
+static bool test_source(void *context, char *data, size_t size, size_t *length)
+{
+    JsonX_TestSource *source = (JsonX_TestSource *)context;
+    size_t count = source->length - source->pos;
+
+    if (source->fail)
+    {
+        return false;
+    }
+
+    count = (count < JSONX_TEST_PULL_SIZE) ? count : JSONX_TEST_PULL_SIZE;
+    count = (count < size) ? count : size;
+    memcpy(data, &source->data[source->pos], count);
+    source->pos += count;
+    *length = count;
+    return true;
+}
+
+static void test_reset(void)
+{
+    memset(&jsonx_test_sink, 0, sizeof(jsonx_test_sink));
+    jsonx_test_sink.valid = true;
+    jsonx_test_stream = (JX_STRING_STREAM){ test_sink, &jsonx_test_sink, test_source, &jsonx_test_source, 0U };
+    jsonx_test_source.pos = 0U;
+}
+
+/* Escapes, two- to four-byte sequences and \u escapes, repeated well past a chunk. */
+static void test_build(char *json, char *text)
+{
+    static const char json_piece[] = "a\\\"b\\\\c\\n\\u00e9\\ud83d\\ude00 \xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80/";
+    static const char text_piece[] = "a\"b\\c\n\xc3\xa9\xf0\x9f\x98\x80 \xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80/";
+
+    strcpy(json, "{\"id\":4,\"body\":\"");
+    text[0] = '\0';
+    for (size_t i = 0U; i < 40U; ++i)
+    {
+        strcat(json, json_piece);
+        strcat(text, text_piece);
+    }
+    strcat(json, "\"}");
+}
+
+static int test_parse(JX_CONTEXT *context, const char *json, const char *text)
+{
+    static char input[JSONX_TEST_JSON_SIZE];
+
+    test_reset();
+    strcpy(input, json);
+    if ((jx_context_json_to_struct(context, input, jsonx_test_root, 2U, JX_MODE_STRICT) != JX_SUCCESS) ||
+        (jsonx_test_id != 4U) || (strcmp(jsonx_test_sink.data, text) != 0) ||
+        (jsonx_test_stream.length != strlen(text)) || !jsonx_test_sink.valid ||
+        (jsonx_test_sink.calls < (strlen(text) / JX_STRING_STREAM_CHUNK)))
+    {
+        return test_fail("streamed parse");
+    }
+
+    /* A sink that refuses data fails the parse. */
+    test_reset();
+    jsonx_test_sink.refuse = true;
+    strcpy(input, json);
+    if (jx_context_json_to_struct(context, input, jsonx_test_root, 2U, JX_MODE_STRICT) != JX_ERROR)
+    {
+        return test_fail("refused chunk accepted");
+    }
+
+    /* Broken strings are rejected as for any string. */
+    test_reset();
+    strcpy(input, "{\"body\":\"abc\\x\"}");
+    if (jx_context_json_to_struct(context, input, jsonx_test_root, 2U, JX_MODE_RELAXED) != JX_ERROR)
+    {
+        return test_fail("bad escape accepted");
+    }
+
+    test_reset();
+    strcpy(input, "{\"body\":\"abc\xc3\"}");
+    if (jx_context_json_to_struct(context, input, jsonx_test_root, 2U, JX_MODE_RELAXED) != JX_ERROR)
+    {
+        return test_fail("bad sequence accepted");
+    }
+
+    /* Another kind of value never reaches the sink. */
+    test_reset();
+    strcpy(input, "{\"id\":1,\"body\":[1,2]}");
+    if ((jx_context_json_to_struct(context, input, jsonx_test_root, 2U, JX_MODE_RELAXED) != JX_SUCCESS) ||
+        (jsonx_test_sink.calls != 0U))
+    {
+        return test_fail("mismatched value");
+    }
+
+    return 0;
+}
+
+static int test_write(JX_CONTEXT *context, const char *text, JX_FORMAT format)
+{
+    static char expected[JSONX_TEST_JSON_SIZE];
+    static char output[JSONX_TEST_JSON_SIZE];
+
+    strcpy(jsonx_test_text, text);
+    if (jx_context_struct_to_json(context, jsonx_test_buffered, 2U, expected, sizeof(expected), format) != JX_SUCCESS)
+    {
+        return test_fail("buffered write");
+    }
+
+    test_reset();
+    jsonx_test_source.data = text;
+    jsonx_test_source.length = strlen(text);
+    if ((jx_context_struct_to_json(context, jsonx_test_root, 2U, output, sizeof(output), format) != JX_SUCCESS) ||
+        (strcmp(output, expected) != 0))
+    {
+        return test_fail("streamed write");
+    }
+
+    /* What was written parses back to the same text. */
+    test_reset();
+    if ((jx_context_json_to_struct(context, output, jsonx_test_root, 2U, JX_MODE_STRICT) != JX_SUCCESS) ||
+        (strcmp(jsonx_test_sink.data, text) != 0))
+    {
+        return test_fail("round trip");
+    }
+
+    return 0;
+}
+
+static int test_write_errors(JX_CONTEXT *context)
+{
+    char output[64];
+
+    test_reset();
+    jsonx_test_source.fail = true;
+    if (jx_context_struct_to_json(context, jsonx_test_root, 2U, output, sizeof(output), JX_MINIFIED) != JX_ERROR)
+    {
+        return test_fail("failing source accepted");
+    }
+
+    /* A source that ends inside a sequence. */
+    test_reset();
+    jsonx_test_source = (JsonX_TestSource){ "ab\xe2\x82", 4U, 0U, false };
+    if (jx_context_struct_to_json(context, jsonx_test_root, 2U, output, sizeof(output), JX_MINIFIED_ASCII) != JX_ERROR)
+    {
+        return test_fail("cut sequence accepted");
+    }
+
+    test_reset();
+    jsonx_test_stream.source = NULL;
+    if (jx_context_struct_to_json(context, jsonx_test_root, 2U, output, sizeof(output), JX_MINIFIED) != JX_ERROR)
+    {
+        return test_fail("missing source accepted");
+    }
+
+    return 0;
+}
+
+/* Streamed text is not kept, so it can never be proven unchanged. */
+static int test_equals(const char *json)
+{
+    bool equal = true;
+
+    test_reset();
+    jsonx_test_id = 4U;
+    if ((jx_json_equals_struct(json, jsonx_test_root, 2U, &equal) != JX_SUCCESS) || equal ||
+        (jsonx_test_sink.calls != 0U))
+    {
+        return test_fail("streamed string compared equal");
+    }
+
+    if ((jx_json_equals_struct("{\"id\":4}", jsonx_test_root, 2U, &equal) != JX_SUCCESS) || !equal)
+    {
+        return test_fail("document without the stream");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    static char json[JSONX_TEST_JSON_SIZE];
+    static char text[JSONX_TEST_TEXT_SIZE];
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+
+    test_build(json, text);
+    if ((test_parse(&context, json, text) != 0) || (test_write(&context, text, JX_MINIFIED) != 0) ||
+        (test_write(&context, text, JX_FORMATTED_ASCII) != 0) || (test_write_errors(&context) != 0) ||
+        (test_equals(json) != 0))
+    {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,212 @@
+#include "jx_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_BUFFER_SIZE     128U
+
+static char jsonx_test_text[16];
+static JX_ELEMENT jsonx_test_root[] =
+{
+    JX_PROPERTY_STRING_BUFFER("text", jsonx_test_text)
+};
+
+static char jsonx_test_long[64];
+static JX_ELEMENT jsonx_test_long_root[] =
+{
+    JX_PROPERTY_STRING_BUFFER("long", jsonx_test_long)
+};
+
+static char jsonx_test_chunked[256];
+static size_t jsonx_test_chunked_length;
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX UTF-8 test failed: %s\n", message);
+    return 1;
+}
+
+static JX_STATUS test_parse(const char *json, JX_PARSE_MODE mode)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    char input[JSONX_TEST_BUFFER_SIZE];
+
+    strcpy(input, json);
+    memset(jsonx_test_text, 0, sizeof(jsonx_test_text));
+    return jx_context_json_to_struct(&context, input, jsonx_test_root, 1U, mode);
+}
+
+static int test_validator(void)
+{
+    static const char *const valid[] =
+    {
+        "plain ascii text longer than one word",
+        "caf\xC3\xA9",
+        "\xE2\x82\xAC and \xF0\x9F\x98\x80 in the middle of ASCII padding",
+        "\xED\x9F\xBF\xEE\x80\x80\xF4\x8F\xBF\xBF"
+    };
+    static const char *const invalid[] =
+    {
+        "\x80",
+        "\xC0\xAF",
+        "\xC3",
+        "\xE0\x9F\x80",
+        "\xED\xA0\x80",
+        "\xF0\x8F\xBF\xBF",
+        "\xF4\x90\x80\x80",
+        "\xF5\x80\x80\x80",
+        "ascii prefix of eight+ bytes \xE2\x82"
+    };
+
+    for (size_t i = 0U; i < (sizeof(valid) / sizeof(valid[0])); ++i)
+    {
+        if (!jx_utf8_validate(valid[i], strlen(valid[i])))
+        {
+            return test_fail("valid UTF-8 rejected");
+        }
+    }
+
+    for (size_t i = 0U; i < (sizeof(invalid) / sizeof(invalid[0])); ++i)
+    {
+        if (jx_utf8_validate(invalid[i], strlen(invalid[i])))
+        {
+            return test_fail("invalid UTF-8 accepted");
+        }
+    }
+
+    /* Length bounds the check: a sequence cut by the length is truncated. */
+    if (jx_utf8_validate("\xC3\xA9", 1U) || !jx_utf8_validate("a\0b", 3U) || !jx_utf8_validate(NULL, 0U))
+    {
+        return test_fail("bounded validation");
+    }
+
+    return 0;
+}
+
+static bool test_sink(void *context, const char *data, size_t length)
+{
+    (void)context;
+
+    if ((jsonx_test_chunked_length + length) >= sizeof(jsonx_test_chunked))
+    {
+        return false;
+    }
+
+    memcpy(&jsonx_test_chunked[jsonx_test_chunked_length], data, length);
+    jsonx_test_chunked_length += length;
+    jsonx_test_chunked[jsonx_test_chunked_length] = '\0';
+    return true;
+}
+
+/* ASCII formats escape every non-ASCII scalar and read back identically. */
+static int test_ensure_ascii(void)
+{
+    static const char expected[] =
+        "{\"long\":\"plain ascii run, caf\\u00e9 \\u20ac\\ud83d\\ude00 \\\"q\\\" \\u0001 tail text\"}";
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    char output[JSONX_TEST_BUFFER_SIZE];
+    char original[sizeof(jsonx_test_long)];
+
+    strcpy(jsonx_test_long, "plain ascii run, caf\xC3\xA9 \xE2\x82\xAC\xF0\x9F\x98\x80 \"q\" \x01 tail text");
+    strcpy(original, jsonx_test_long);
+
+    if ((jx_context_struct_to_json(&context, jsonx_test_long_root, 1U, output, sizeof(output),
+                                   JX_MINIFIED_ASCII) != JX_SUCCESS) ||
+        (strcmp(output, expected) != 0))
+    {
+        return test_fail("ensure-ASCII output");
+    }
+
+    memset(jsonx_test_long, 0, sizeof(jsonx_test_long));
+    if ((jx_context_json_to_struct(&context, output, jsonx_test_long_root, 1U, JX_MODE_STRICT) != JX_SUCCESS) ||
+        (strcmp(jsonx_test_long, original) != 0))
+    {
+        return test_fail("ensure-ASCII round trip");
+    }
+
+    /* Small chunks split escapes and plain runs across sink calls. */
+    jsonx_test_chunked_length = 0U;
+    if ((jx_context_struct_to_json_chunked(&context, jsonx_test_long_root, 1U, output, 5U,
+                                           JX_MINIFIED_ASCII, test_sink, NULL) != JX_SUCCESS) ||
+        (strcmp(jsonx_test_chunked, expected) != 0))
+    {
+        return test_fail("chunked ensure-ASCII output");
+    }
+
+    /* Raw formats keep UTF-8 bytes as they are. */
+    if ((jx_context_struct_to_json(&context, jsonx_test_long_root, 1U, output, sizeof(output),
+                                   JX_MINIFIED) != JX_SUCCESS) ||
+        (strstr(output, "caf\xC3\xA9 \xE2\x82\xAC") == NULL))
+    {
+        return test_fail("raw UTF-8 output");
+    }
+
+    strcpy(jsonx_test_long, "broken \xC3\x28");
+    if ((jx_context_struct_to_json(&context, jsonx_test_long_root, 1U, output, sizeof(output),
+                                   JX_FORMATTED_ASCII) != JX_ERROR) ||
+        (jx_context_struct_to_json(&context, jsonx_test_long_root, 1U, output, sizeof(output),
+                                   (JX_FORMAT)7) != JX_ERROR))
+    {
+        return test_fail("invalid ensure-ASCII input accepted");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    JX_CONTEXT context = JX_CONTEXT_INIT;
+    char output[JSONX_TEST_BUFFER_SIZE];
+
+    if (test_validator() != 0)
+    {
+        return 1;
+    }
+
+    /* Escapes decode to UTF-8, including surrogate pairs. */
+    if ((test_parse("{\"text\":\"caf\\u00e9 \\u20AC\"}", JX_MODE_STRICT) != JX_SUCCESS) ||
+        (strcmp(jsonx_test_text, "caf\xC3\xA9 \xE2\x82\xAC") != 0) ||
+        (test_parse("{\"text\":\"\\ud83d\\ude00!\"}", JX_MODE_STRICT) != JX_SUCCESS) ||
+        (strcmp(jsonx_test_text, "\xF0\x9F\x98\x80!") != 0) ||
+        (test_parse("{\"text\":\"raw \xC3\xA9\"}", JX_MODE_STRICT) != JX_SUCCESS) ||
+        (strcmp(jsonx_test_text, "raw \xC3\xA9") != 0))
+    {
+        return test_fail("unicode decoding");
+    }
+
+    if ((test_parse("{\"text\":\"\\ud83d\"}", JX_MODE_STRICT) != JX_ERROR) ||
+        (test_parse("{\"text\":\"\\ude00\"}", JX_MODE_STRICT) != JX_ERROR) ||
+        (test_parse("{\"text\":\"\\ud83d\\u0041\"}", JX_MODE_STRICT) != JX_ERROR) ||
+        (test_parse("{\"text\":\"\\u0000\"}", JX_MODE_STRICT) != JX_ERROR) ||
+        (test_parse("{\"text\":\"\xC3\x28\"}", JX_MODE_STRICT) != JX_ERROR) ||
+        (test_parse("{\"text\":\"\xED\xA0\x80\"}", JX_MODE_STRICT) != JX_ERROR) ||
+        (test_parse("{\"skip\":\"\xFF\",\"text\":\"\"}", JX_MODE_STRICT) != JX_ERROR))
+    {
+        return test_fail("invalid unicode accepted");
+    }
+
+    /* Capacity counts encoded bytes: 15 bytes fit, a 16th does not. */
+    if ((test_parse("{\"text\":\"\\u20ac\\u20ac\\u20ac\\u20ac\\u20ac\"}", JX_MODE_STRICT) != JX_SUCCESS) ||
+        (test_parse("{\"text\":\"\\u20ac\\u20ac\\u20ac\\u20ac\\u20aca\"}", JX_MODE_STRICT) != JX_ERROR) ||
+        (test_parse("{\"text\":\"aaaaaaaaaaaaaa\xC3\xA9\"}", JX_MODE_STRICT) != JX_ERROR))
+    {
+        return test_fail("encoded capacity");
+    }
+
+    /* Control escapes decode and are written back escaped. */
+    if ((test_parse("{\"text\":\"a\\u0001b\"}", JX_MODE_STRICT) != JX_SUCCESS) ||
+        (strcmp(jsonx_test_text, "a\x01" "b") != 0) ||
+        (jx_context_struct_to_json(&context, jsonx_test_root, 1U, output, sizeof(output), JX_MINIFIED) != JX_SUCCESS) ||
+        (strcmp(output, "{\"text\":\"a\\u0001b\"}") != 0))
+    {
+        return test_fail("control escape round trip");
+    }
+
+    if (test_ensure_ascii() != 0)
+    {
+        return 1;
+    }
+
+    return 0;
+}
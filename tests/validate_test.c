@@ -0,0 +1,205 @@
+#include "jx_api.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define JSONX_TEST_BUFFER_SIZE     256U
+
+static int test_fail(const char *message)
+{
+    fprintf(stderr, "JsonX validate test failed: %s\n", message);
+    return 1;
+}
+
+static JX_STATUS test_validate(const char *json)
+{
+    return jx_validate(json, strlen(json));
+}
+
+static int test_documents(void)
+{
+    static const char *const valid[] =
+    {
+        "{}",
+        " [ ] ",
+        "{\"a\":1,\"b\":[true,false,null],\"c\":{\"d\":-1.5e3}}",
+        "\n{\n  \"text\": \"brackets ]}[{ , : and \\\"quotes\\\" \\\\\",\n  \"u\": \"\\u00e9\\ud83d\\ude00\"\n}\n",
+        "[\"caf\xC3\xA9\",0,-0,1E+2,\"\"]",
+        "[[[1]]]",
+        "{\"a\":{\"b\":{\"c\":{\"d\":1}}}}",
+        "[[[[1]]]]",
+        "{\"a\":\"\\u0000\"}",
+        "42",
+        " -0.5e-3 ",
+        "true",
+        "null",
+        "\"x\"",
+        "\"\\u0000\""
+    };
+    static const char *const invalid[] =
+    {
+        "",
+        "01",
+        "1.",
+        "-",
+        "1 2",
+        "tru",
+        "\"a\" \"b\"",
+        "1{}",
+        "{}{}",
+        "{} x",
+        "[1 2]",
+        "[tr ue]",
+        "[true false]",
+        "[01]",
+        "[1.]",
+        "[truth]",
+        "{\"a\":1,}",
+        "{\"a\" 1}",
+        "{\"a\":1]",
+        "[1,,2]",
+        "{\"a\":\"b",
+        "{\"a\":\"\\x\"}",
+        "{\"a\":\"\\ud800\"}",
+        "{\"a\":\"\x01\"}",
+        "{\"a\":\"\xC3\"}",
+        "]["
+    };
+
+    for (size_t i = 0U; i < (sizeof(valid) / sizeof(valid[0])); ++i)
+    {
+        if (test_validate(valid[i]) != JX_SUCCESS)
+        {
+            return test_fail(valid[i]);
+        }
+    }
+
+    for (size_t i = 0U; i < (sizeof(invalid) / sizeof(invalid[0])); ++i)
+    {
+        if (test_validate(invalid[i]) != JX_ERROR)
+        {
+            return test_fail(invalid[i]);
+        }
+    }
+
+    return 0;
+}
+
+/* Nesting is bounded by JX_VALIDATE_MAX_DEPTH, not by the mapping limit. */
+static int test_depth(void)
+{
+    char deep[(2U * (JX_VALIDATE_MAX_DEPTH + 1U)) + 2U];
+    char output[sizeof(deep)];
+    size_t depth;
+
+    for (depth = 0U; depth < JX_VALIDATE_MAX_DEPTH; ++depth)
+    {
+        deep[depth] = '[';
+        deep[JX_VALIDATE_MAX_DEPTH + 1U + depth] = ']';
+    }
+    deep[JX_VALIDATE_MAX_DEPTH] = '1';
+    deep[(2U * JX_VALIDATE_MAX_DEPTH) + 1U] = '\0';
+
+    if ((jx_validate(deep, strlen(deep)) != JX_SUCCESS) ||
+        (jx_minify(deep, strlen(deep), output, NULL) != JX_SUCCESS))
+    {
+        return test_fail("JX_VALIDATE_MAX_DEPTH levels");
+    }
+
+    /* One level more. */
+    memmove(&deep[1], deep, strlen(deep) + 1U);
+    deep[0] = '[';
+    strcat(deep, "]");
+    if ((jx_validate(deep, strlen(deep)) != JX_ERROR) ||
+        (jx_minify(deep, strlen(deep), output, NULL) != JX_ERROR))
+    {
+        return test_fail("nesting deeper than JX_VALIDATE_MAX_DEPTH");
+    }
+
+    return 0;
+}
+
+/* Only length bytes belong to the document, whatever follows them. */
+static int test_bounds(void)
+{
+    static const char tail[] = "{\"a\":12}]]";
+    static const char nul[] = "{\"a\":\"x\0y\"}";
+    static const char number[] = "12345";
+    static const char literal[] = "falsetto";
+
+    if ((jx_validate(tail, 8U) != JX_SUCCESS) ||
+        (jx_validate(tail, 7U) != JX_ERROR) ||
+        (jx_validate(tail, 6U) != JX_ERROR) ||
+        (jx_validate(tail, 9U) != JX_ERROR) ||
+        (jx_validate(nul, sizeof(nul) - 1U) != JX_ERROR) ||
+        (jx_validate(number, 2U) != JX_SUCCESS) ||
+        (jx_validate(literal, 5U) != JX_SUCCESS) ||
+        (jx_validate(literal, 4U) != JX_ERROR) ||
+        (jx_validate(NULL, 2U) != JX_ERROR))
+    {
+        return test_fail("document bounds");
+    }
+
+    return 0;
+}
+
+static int test_minify(void)
+{
+    static const char formatted[] =
+        "{\n"
+        "  \"id\": 7,\n"
+        "  \"name\": \"two  spaces\\t\\\" kept\",\n"
+        "  \"samples\": [ 1, 2,\t3 ],\r\n"
+        "  \"network\": { \"ssid\": \"plant a\", \"rssi\": -61 }\n"
+        "}\n";
+    static const char expected[] =
+        "{\"id\":7,\"name\":\"two  spaces\\t\\\" kept\",\"samples\":[1,2,3],"
+        "\"network\":{\"ssid\":\"plant a\",\"rssi\":-61}}";
+    char buffer[JSONX_TEST_BUFFER_SIZE];
+    char output[JSONX_TEST_BUFFER_SIZE];
+    size_t written = 0U;
+
+    if ((jx_minify(formatted, sizeof(formatted) - 1U, output, &written) != JX_SUCCESS) ||
+        (written != (sizeof(expected) - 1U)) || (strcmp(output, expected) != 0))
+    {
+        return test_fail("jx_minify");
+    }
+
+    /* In place, then again on already minified text. */
+    strcpy(buffer, formatted);
+    if ((jx_minify(buffer, strlen(buffer), buffer, NULL) != JX_SUCCESS) ||
+        (strcmp(buffer, expected) != 0) ||
+        (jx_minify(buffer, strlen(buffer), buffer, &written) != JX_SUCCESS) ||
+        (strcmp(buffer, expected) != 0) || (written != strlen(expected)))
+    {
+        return test_fail("jx_minify in place");
+    }
+
+    if ((jx_minify("[1 2]", 5U, output, NULL) != JX_ERROR) ||
+        (jx_minify("{\"a\": tr ue}", 12U, output, NULL) != JX_ERROR) ||
+        (jx_minify("{\"a\":1} {}", 10U, output, NULL) != JX_ERROR) ||
+        (jx_minify(formatted, sizeof(formatted) - 1U, NULL, NULL) != JX_ERROR))
+    {
+        return test_fail("jx_minify accepted an invalid document");
+    }
+
+    if ((jx_minify(" 42 ", 4U, output, &written) != JX_SUCCESS) || (strcmp(output, "42") != 0) ||
+        (jx_minify(" \"a b\"\n", 7U, output, &written) != JX_SUCCESS) || (strcmp(output, "\"a b\"") != 0) ||
+        (jx_minify("1 2", 3U, output, NULL) != JX_ERROR) ||
+        (jx_minify("\"a\" 1", 5U, output, NULL) != JX_ERROR))
+    {
+        return test_fail("jx_minify scalar documents");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    if ((test_documents() != 0) || (test_depth() != 0) || (test_bounds() != 0) || (test_minify() != 0))
+    {
+        return 1;
+    }
+
+    return 0;
+}